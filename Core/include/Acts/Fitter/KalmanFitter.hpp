@@ -725,7 +725,7 @@ class KalmanFitter {
 
         // Not creating bound state here, so need manually reinitialize
         // jacobian
-        state.stepping.jacobian = BoundMatrix::Identity();
+        state.stepping.jacobian.setIdentity();
 
         // Update state and stepper with material effects
         materialInteractor(surface, state, stepper);
@@ -123,6 +123,22 @@ class BoundarySurfaceT {
   /// The Surface Representation of this
   virtual const Surface& surfaceRepresentation() const;
 
+  /// The single volume opposite to the surface normal, if any
+  const volume_t* oppositeVolume() const { return m_oppositeVolume; }
+
+  /// The single volume along the surface normal, if any
+  const volume_t* alongVolume() const { return m_alongVolume; }
+
+  /// The volume array opposite to the surface normal, if any
+  const std::shared_ptr<const VolumeArray>& oppositeVolumeArray() const {
+    return m_oppositeVolumeArray;
+  }
+
+  /// The volume array along the surface normal, if any
+  const std::shared_ptr<const VolumeArray>& alongVolumeArray() const {
+    return m_alongVolumeArray;
+  }
+
   /// Helper method: attach a Volume to this BoundarySurfaceT
   /// this is done during the geometry construction.
   ///
@@ -134,6 +134,36 @@ fieldMapperXYZ(const std::function<size_t(std::array<size_t, 3> binsXYZ,
                double lengthUnit = UnitConstants::mm,
                double BFieldUnit = UnitConstants::T, bool firstOctant = false);
 
+/// Method to setup the FieldMapper for an already filled r/z grid
+///
+/// @param[in] grid The grid with the magnetic field values (Br,Bz) in native
+/// units, including the under-/overflow bins
+///
+/// This can e.g. be used with a grid that views the values of a field map
+/// file in place.
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+fieldMapperRZ(Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                                 Acts::detail::EquidistantAxis>
+                  grid);
+
+/// Method to setup the FieldMapper for an already filled x/y/z grid
+///
+/// @param[in] grid The grid with the magnetic field values (Bx,By,Bz) in
+/// native units, including the under-/overflow bins
+///
+/// This can e.g. be used with a grid that views the values of a field map
+/// file in place.
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+fieldMapperXYZ(
+    Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>
+        grid);
+
 /// Function which takes an existing SolenoidBField instance and
 /// creates a field mapper by sampling grid points from the analytical
 /// solenoid field.
@@ -8,10 +8,13 @@
 
 #pragma once
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <vector>
+
 namespace Acts {
 
 /// @class BinnedSurfaceMaterial
@@ -94,6 +97,13 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   /// @copydoc SurfaceMaterial::materialSlab(size_t, size_t)
   const MaterialSlab& materialSlab(size_t bin0, size_t bin1) const final;
 
+  /// @copydoc ISurfaceMaterial::interactionConstants(const Vector3D&)
+  const MaterialInteractionConstants* interactionConstants(
+      const Vector3D& gp) const final;
+
+  /// Precompute the interaction constants for the material of every bin
+  void tabulateInteractionConstants();
+
   /// Output Method for std::ostream, to be overloaded by child classes
   std::ostream& toStream(std::ostream& sl) const final;
 
@@ -103,6 +113,9 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
 
   /// The five different MaterialSlab
   MaterialSlabMatrix m_fullMaterial;
+
+  /// The interaction constants for every bin, empty if not tabulated
+  std::vector<std::vector<MaterialInteractionConstants>> m_interactionConstants;
 };
 
 inline const BinUtility& BinnedSurfaceMaterial::binUtility() const {
@@ -9,9 +9,12 @@
 #pragma once
 
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <optional>
+
 namespace Acts {
 
 /// @class HomogeneousSurfaceMaterial
@@ -83,6 +86,15 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
   /// @note the input parameter is ignored
   const MaterialSlab& materialSlab(size_t ib0, size_t ib1) const final;
 
+  /// @copydoc ISurfaceMaterial::interactionConstants(const Vector3D&)
+  ///
+  /// @note the input parameter is ignored
+  const MaterialInteractionConstants* interactionConstants(
+      const Vector3D& gp) const final;
+
+  /// Precompute the interaction constants for the material
+  void tabulateInteractionConstants();
+
   /// The inherited methods - for MaterialSlab access
   using ISurfaceMaterial::materialSlab;
 
@@ -97,6 +109,9 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
  private:
   /// The five different MaterialSlab
   MaterialSlab m_fullMaterial = MaterialSlab();
+
+  /// The interaction constants of the material, if tabulated
+  std::optional<MaterialInteractionConstants> m_interactionConstants;
 };
 
 inline const MaterialSlab& HomogeneousSurfaceMaterial::materialSlab(
@@ -114,6 +129,11 @@ inline const MaterialSlab& HomogeneousSurfaceMaterial::materialSlab(
   return (m_fullMaterial);
 }
 
+inline const MaterialInteractionConstants*
+HomogeneousSurfaceMaterial::interactionConstants(const Vector3D& /*gp*/) const {
+  return m_interactionConstants ? &(*m_interactionConstants) : nullptr;
+}
+
 inline bool HomogeneousSurfaceMaterial::operator==(
     const HomogeneousSurfaceMaterial& hsm) const {
   return (m_fullMaterial == hsm.m_fullMaterial);
@@ -16,6 +16,8 @@
 
 namespace Acts {
 
+struct MaterialInteractionConstants;
+
 /// @class ISurfaceMaterial
 ///
 /// Virtual base class of surface based material description
@@ -63,6 +65,26 @@ class ISurfaceMaterial {
   /// @param ib1 is the material bin in dimension 1
   virtual const MaterialSlab& materialSlab(size_t ib0, size_t ib1) const = 0;
 
+  /// Return the precomputed interaction constants of the material
+  /// - from the global coordinates
+  ///
+  /// @param gp is the global position used for the (eventual) lookup
+  ///
+  /// @return the constants for the material returned by materialSlab(gp),
+  ///         nullptr if they have not been tabulated
+  virtual const MaterialInteractionConstants* interactionConstants(
+      const Vector3D& /*gp*/) const {
+    return nullptr;
+  }
+
+  /// Return the material that carries the concrete material description
+  ///
+  /// Material that only forwards to another material, e.g. to decode it on
+  /// first access, returns the material it forwards to. Code that needs the
+  /// concrete type, e.g. writers or the material mapping, should cast this
+  /// instead of the material itself.
+  virtual const ISurfaceMaterial& concreteMaterial() const { return *this; }
+
   /// Update pre factor
   ///
   /// @param pDir is the navigation direction through the surface
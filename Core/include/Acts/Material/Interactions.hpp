@@ -15,6 +15,30 @@
 
 namespace Acts {
 
+/// Momentum-independent material terms of the ionisation energy loss.
+///
+/// The ionisation formulas need the mean excitation energy, the electron
+/// density, and the plasma energy of the traversed material. Computing them
+/// requires a power, a square root, and a logarithm that are evaluated again
+/// at every crossing of the same material. The terms can instead be computed
+/// once, e.g. for all bins of a surface material map, and be kept next to the
+/// material by its owner, see `ISurfaceMaterial::interactionConstants`. The
+/// energy loss functions below that accept them use the stored values and
+/// combine the remaining logarithms.
+struct MaterialInteractionConstants {
+  /// Epsilon pre-factor per thickness and q²/beta², i.e. (K/2) * (Z/A)*rho.
+  float epsilonPerThickness = 0.0f;
+  /// Inverse squared mean excitation energy 1/I².
+  float invMeanExcitationEnergy2 = 0.0f;
+  /// Constant part log(plasmaEnergy/I) - 1/2 of the density correction.
+  float deltaHalfOffset = 0.0f;
+
+  /// Construct without any material.
+  MaterialInteractionConstants() = default;
+  /// Compute the terms for the given material.
+  explicit MaterialInteractionConstants(const Material& material);
+};
+
 /// Compute the mean energy loss due to ionisation and excitation.
 ///
 /// @param slab      The traversed material and its properties
@@ -32,6 +56,15 @@ namespace Acts {
 /// for intermediate particle energies.
 float computeEnergyLossBethe(const MaterialSlab& slab, int pdg, float m,
                              float qOverP, float q = UnitConstants::e);
+/// Compute the mean ionisation energy loss with precomputed material terms.
+///
+/// @param constants The terms computed from the material of the slab
+///
+/// @see computeEnergyLossBethe for the other parameters description
+float computeEnergyLossBethe(const MaterialSlab& slab,
+                             const MaterialInteractionConstants& constants,
+                             int pdg, float m, float qOverP,
+                             float q = UnitConstants::e);
 /// Derivative of the Bethe energy loss with respect to q/p.
 ///
 /// @see computeEnergyLossBethe for parameters description
@@ -48,6 +81,15 @@ float deriveEnergyLossBetheQOverP(const MaterialSlab& slab, int pdg, float m,
 /// for intermediate particle energies.
 float computeEnergyLossLandau(const MaterialSlab& slab, int pdg, float m,
                               float qOverP, float q = UnitConstants::e);
+/// Compute the most probable ionisation energy loss with precomputed terms.
+///
+/// @param constants The terms computed from the material of the slab
+///
+/// @see computeEnergyLossBethe for the other parameters description
+float computeEnergyLossLandau(const MaterialSlab& slab,
+                              const MaterialInteractionConstants& constants,
+                              int pdg, float m, float qOverP,
+                              float q = UnitConstants::e);
 /// Derivative of the most probable ionisation energy loss with respect to q/p.
 ///
 /// @see computeEnergyLossBethe for parameters description
@@ -17,6 +17,7 @@
 #include "Acts/Propagator/EigenStepperError.hpp"
 #include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Propagator/detail/Auctioneer.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Result.hpp"
@@ -42,9 +43,17 @@ using namespace Acts::UnitLiterals;
 /// with s being the arc length of the track, q the charge of the particle,
 /// p its momentum and B the magnetic field
 ///
+/// The scalar type @p scalar_t sets the precision of the transport jacobians
+/// and of the covariance that are carried in the stepper state. Using
+/// @c float gives a mixed-precision mode where the track parameters are
+/// integrated in double precision while the (dominant) jacobian accumulation
+/// and covariance transport are performed in single precision. The resulting
+/// bound and curvilinear states are always returned in double precision.
+///
 template <typename bfield_t,
           typename extensionlist_t = StepperExtensionList<DefaultExtension>,
-          typename auctioneer_t = detail::VoidAuctioneer>
+          typename auctioneer_t = detail::VoidAuctioneer,
+          typename scalar_t = double>
 class EigenStepper {
  public:
   /// Jacobian, Covariance and State defintions
@@ -55,6 +64,15 @@ class EigenStepper {
       std::tuple<CurvilinearTrackParameters, Jacobian, double>;
   using BField = bfield_t;
 
+  /// Scalar type and matrix types of the covariance transport
+  using TransportScalar = scalar_t;
+  using TransportJacobian = detail::TransportBoundMatrix<scalar_t>;
+  using TransportCovariance = detail::TransportBoundSymMatrix<scalar_t>;
+  using TransportFreeMatrix = detail::TransportFreeMatrix<scalar_t>;
+  using TransportFreeVector = detail::TransportFreeVector<scalar_t>;
+  using TransportBoundToFreeMatrix =
+      detail::TransportBoundToFreeMatrix<scalar_t>;
+
   /// @brief State for track parameter propagation
   ///
   /// It contains the stepping information and is provided thread local
@@ -95,9 +113,11 @@ class EigenStepper {
         const auto& surface = par.referenceSurface();
         // set the covariance transport flag to true and copy
         covTransport = true;
-        cov = BoundSymMatrix(*par.covariance());
-        surface.initJacobianToGlobal(gctx, jacToGlobal, pos, dir,
+        cov = par.covariance()->template cast<scalar_t>();
+        BoundToFreeMatrix initJacToGlobal = BoundToFreeMatrix::Zero();
+        surface.initJacobianToGlobal(gctx, initJacToGlobal, pos, dir,
                                      par.parameters());
+        jacToGlobal = initJacToGlobal.template cast<scalar_t>();
       }
     }
 
@@ -120,21 +140,21 @@ class EigenStepper {
     NavigationDirection navDir;
 
     /// The full jacobian of the transport entire transport
-    Jacobian jacobian = Jacobian::Identity();
+    TransportJacobian jacobian = TransportJacobian::Identity();
 
     /// Jacobian from local to the global frame
-    BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+    TransportBoundToFreeMatrix jacToGlobal = TransportBoundToFreeMatrix::Zero();
 
     /// Pure transport jacobian part from runge kutta integration
-    FreeMatrix jacTransport = FreeMatrix::Identity();
+    TransportFreeMatrix jacTransport = TransportFreeMatrix::Identity();
 
     /// The propagation derivative
-    FreeVector derivative = FreeVector::Zero();
+    TransportFreeVector derivative = TransportFreeVector::Zero();
 
     /// Covariance matrix (and indicator)
     //// associated with the initial error on track parameters
     bool covTransport = false;
-    Covariance cov = Covariance::Zero();
+    TransportCovariance cov = TransportCovariance::Zero();
 
     /// Accummulated path length state
     double pathAccumulated = 0.;
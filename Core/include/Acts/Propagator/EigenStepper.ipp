@@ -9,12 +9,12 @@
 #include "Acts/EventData/detail/TransformationBoundToFree.hpp"
 #include "Acts/Propagator/detail/CovarianceEngine.hpp"
 
-template <typename B, typename E, typename A>
-Acts::EigenStepper<B, E, A>::EigenStepper(B bField)
+template <typename B, typename E, typename A, typename S>
+Acts::EigenStepper<B, E, A, S>::EigenStepper(B bField)
     : m_bField(std::move(bField)) {}
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::resetState(State& state,
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::resetState(State& state,
                                              const BoundVector& boundParams,
                                              const BoundSymMatrix& cov,
                                              const Surface& surface,
@@ -30,15 +30,17 @@ void Acts::EigenStepper<B, E, A>::resetState(State& state,
   state.pathAccumulated = 0.;
 
   // Reinitialize the stepping jacobian
-  surface.initJacobianToGlobal(state.geoContext, state.jacToGlobal,
-                               position(state), direction(state), boundParams);
-  state.jacobian = BoundMatrix::Identity();
-  state.jacTransport = FreeMatrix::Identity();
-  state.derivative = FreeVector::Zero();
+  BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+  surface.initJacobianToGlobal(state.geoContext, jacToGlobal, position(state),
+                               direction(state), boundParams);
+  state.jacToGlobal = jacToGlobal.template cast<S>();
+  state.jacobian = TransportJacobian::Identity();
+  state.jacTransport = TransportFreeMatrix::Identity();
+  state.derivative = TransportFreeVector::Zero();
 }
 
-template <typename B, typename E, typename A>
-auto Acts::EigenStepper<B, E, A>::boundState(State& state,
+template <typename B, typename E, typename A, typename S>
+auto Acts::EigenStepper<B, E, A, S>::boundState(State& state,
                                              const Surface& surface) const
     -> BoundState {
   FreeVector parameters;
@@ -50,8 +52,8 @@ auto Acts::EigenStepper<B, E, A>::boundState(State& state,
                             state.pathAccumulated, surface);
 }
 
-template <typename B, typename E, typename A>
-auto Acts::EigenStepper<B, E, A>::curvilinearState(State& state) const
+template <typename B, typename E, typename A, typename S>
+auto Acts::EigenStepper<B, E, A, S>::curvilinearState(State& state) const
     -> CurvilinearState {
   FreeVector parameters;
   parameters << state.pos[0], state.pos[1], state.pos[2], state.t, state.dir[0],
@@ -61,8 +63,8 @@ auto Acts::EigenStepper<B, E, A>::curvilinearState(State& state) const
       state.jacToGlobal, parameters, state.covTransport, state.pathAccumulated);
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::update(State& state,
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::update(State& state,
                                          const FreeVector& parameters,
                                          const Covariance& covariance) const {
   state.pos = parameters.template segment<3>(eFreePos0);
@@ -70,11 +72,11 @@ void Acts::EigenStepper<B, E, A>::update(State& state,
   state.p = std::abs(1. / parameters[eFreeQOverP]);
   state.t = parameters[eFreeTime];
 
-  state.cov = covariance;
+  state.cov = covariance.template cast<S>();
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::update(State& state,
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::update(State& state,
                                          const Vector3D& uposition,
                                          const Vector3D& udirection, double up,
                                          double time) const {
@@ -84,14 +86,14 @@ void Acts::EigenStepper<B, E, A>::update(State& state,
   state.t = time;
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::covarianceTransport(State& state) const {
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::covarianceTransport(State& state) const {
   detail::covarianceTransport(state.cov, state.jacobian, state.jacTransport,
                               state.derivative, state.jacToGlobal, state.dir);
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::covarianceTransport(
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::covarianceTransport(
     State& state, const Surface& surface) const {
   FreeVector parameters;
   parameters << state.pos[0], state.pos[1], state.pos[2], state.t, state.dir[0],
@@ -101,9 +103,9 @@ void Acts::EigenStepper<B, E, A>::covarianceTransport(
                               state.jacToGlobal, parameters, surface);
 }
 
-template <typename B, typename E, typename A>
+template <typename B, typename E, typename A, typename S>
 template <typename propagator_state_t>
-Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
+Acts::Result<double> Acts::EigenStepper<B, E, A, S>::step(
     propagator_state_t& state) const {
   using namespace UnitLiterals;
 
@@ -202,7 +204,8 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
     }
 
     // for moment, only update the transport part
-    state.stepping.jacTransport = D * state.stepping.jacTransport;
+    state.stepping.jacTransport =
+        D.template cast<S>() * state.stepping.jacTransport;
   } else {
     if (!state.stepping.extension.finalize(state, *this, h)) {
       return EigenStepperError::StepInvalid;
@@ -215,8 +218,10 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
   state.stepping.dir += h / 6. * (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4);
   state.stepping.dir /= state.stepping.dir.norm();
   if (state.stepping.covTransport) {
-    state.stepping.derivative.template head<3>() = state.stepping.dir;
-    state.stepping.derivative.template segment<3>(4) = sd.k4;
+    state.stepping.derivative.template head<3>() =
+        state.stepping.dir.template cast<S>();
+    state.stepping.derivative.template segment<3>(4) =
+        sd.k4.template cast<S>();
   }
   state.stepping.pathAccumulated += h;
   return h;
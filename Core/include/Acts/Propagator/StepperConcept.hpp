@@ -69,7 +69,8 @@ using step_size_t = decltype(std::declval<T>().stepSize);
     template <typename S>
     constexpr bool StepperStateConcept
       = require<has_member<S, cov_transport_t, bool>,
-                has_member<S, cov_t, BoundSymMatrix>,
+                either<has_member<S, cov_t, BoundSymMatrix>,
+                       has_member<S, cov_t, ActsSymMatrixF<eBoundSize>>>,
                 has_member<S, nav_dir_t, NavigationDirection>,
                 has_member<S, path_accumulated_t, double>,
                 has_member<S, step_size_t, ConstrainedStep>
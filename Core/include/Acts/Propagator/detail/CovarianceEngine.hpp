@@ -26,13 +26,33 @@ namespace Acts {
 /// with some additional data. Since this is a purely algebraic problem the
 /// calculations are identical for @c StraightLineStepper and @c EigenStepper.
 /// As a consequence the methods can be located in a seperate file.
+///
+/// The Jacobians and the covariance are templated on their scalar type such
+/// that the transport can be performed in reduced (single) precision. The
+/// nominal track parameters, the surface interface and the returned states
+/// always use the default (double) precision. Instantiations are provided for
+/// @c double and @c float.
 namespace detail {
 
+/// Transport matrix and vector types for a given scalar precision
+template <typename scalar_t>
+using TransportBoundMatrix = ActsMatrix<scalar_t, eBoundSize, eBoundSize>;
+template <typename scalar_t>
+using TransportBoundSymMatrix = ActsSymMatrix<scalar_t, eBoundSize>;
+template <typename scalar_t>
+using TransportFreeMatrix = ActsMatrix<scalar_t, eFreeSize, eFreeSize>;
+template <typename scalar_t>
+using TransportFreeVector = ActsVector<scalar_t, eFreeSize>;
+template <typename scalar_t>
+using TransportBoundToFreeMatrix = ActsMatrix<scalar_t, eFreeSize, eBoundSize>;
+
 /// Create and return the bound state at the current position
 ///
 /// @brief It does not check if the transported state is at the surface, this
 /// needs to be guaranteed by the propagator
 ///
+/// @tparam scalar_t Scalar type of the transport jacobians and covariance
+///
 /// @param [in] geoContext The geometry context
 /// @param [in, out] covarianceMatrix The covariance matrix of the state
 /// @param [in, out] jacobian Full jacobian since the last reset
@@ -51,17 +71,23 @@ namespace detail {
 ///   - the parameters at the surface
 ///   - the stepwise jacobian towards it (from last bound)
 ///   - and the path length (from start - for ordering)
+template <typename scalar_t>
 std::tuple<BoundTrackParameters, BoundMatrix, double> boundState(
     std::reference_wrapper<const GeometryContext> geoContext,
-    BoundSymMatrix& covarianceMatrix, BoundMatrix& jacobian,
-    FreeMatrix& transportJacobian, FreeVector& derivatives,
-    BoundToFreeMatrix& jacobianLocalToGlobal, const FreeVector& parameters,
-    bool covTransport, double accumulatedPath, const Surface& surface);
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, bool covTransport, double accumulatedPath,
+    const Surface& surface);
 
 /// Create and return a curvilinear state at the current position
 ///
 /// @brief This creates a curvilinear state.
 ///
+/// @tparam scalar_t Scalar type of the transport jacobians and covariance
+///
 /// @param [in, out] covarianceMatrix The covariance matrix of the state
 /// @param [in, out] jacobian Full jacobian since the last reset
 /// @param [in, out] transportJacobian Global jacobian since the last reset
@@ -78,15 +104,20 @@ std::tuple<BoundTrackParameters, BoundMatrix, double> boundState(
 ///   - the curvilinear parameters at given position
 ///   - the stepweise jacobian towards it (from last bound)
 ///   - and the path length (from start - for ordering)
+template <typename scalar_t>
 std::tuple<CurvilinearTrackParameters, BoundMatrix, double> curvilinearState(
-    BoundSymMatrix& covarianceMatrix, BoundMatrix& jacobian,
-    FreeMatrix& transportJacobian, FreeVector& derivatives,
-    BoundToFreeMatrix& jacobianLocalToGlobal, const FreeVector& parameters,
-    bool covTransport, double accumulatedPath);
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, bool covTransport, double accumulatedPath);
 
 /// @brief Method for on-demand transport of the covariance to a new frame at
 /// current position in parameter space
 ///
+/// @tparam scalar_t Scalar type of the transport jacobians and covariance
+///
 /// @param [in] geoContext The geometry context
 /// @param [in, out] covarianceMatrix The covariance matrix of the state
 /// @param [in, out] jacobian Full jacobian since the last reset
@@ -99,16 +130,21 @@ std::tuple<CurvilinearTrackParameters, BoundMatrix, double> curvilinearState(
 /// @param [in] surface is the surface to which the covariance is
 ///        forwarded to
 /// @note No check is done if the position is actually on the surface
+template <typename scalar_t>
 void covarianceTransport(
     std::reference_wrapper<const GeometryContext> geoContext,
-    BoundSymMatrix& covarianceMatrix, BoundMatrix& jacobian,
-    FreeMatrix& transportJacobian, FreeVector& derivatives,
-    BoundToFreeMatrix& jacobianLocalToGlobal, const FreeVector& parameters,
-    const Surface& surface);
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, const Surface& surface);
 
 /// @brief Method for on-demand transport of the covariance to a new frame at
 /// current position in parameter space
 ///
+/// @tparam scalar_t Scalar type of the transport jacobians and covariance
+///
 /// @param [in, out] covarianceMatrix The covariance matrix of the state
 /// @param [in, out] jacobian Full jacobian since the last reset
 /// @param [in, out] transportJacobian Global jacobian since the last reset
@@ -117,10 +153,13 @@ void covarianceTransport(
 /// @param [in, out] jacobianLocalToGlobal Projection jacobian of the last bound
 /// parametrisation to free parameters
 /// @param [in] direction Normalised direction vector
-void covarianceTransport(BoundSymMatrix& covarianceMatrix,
-                         BoundMatrix& jacobian, FreeMatrix& transportJacobian,
-                         FreeVector& derivatives,
-                         BoundToFreeMatrix& jacobianLocalToGlobal,
-                         const Vector3D& direction);
+template <typename scalar_t>
+void covarianceTransport(
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const Vector3D& direction);
 }  // namespace detail
 }  // namespace Acts
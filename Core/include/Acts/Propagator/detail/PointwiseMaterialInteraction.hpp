@@ -42,6 +42,8 @@ struct PointwiseMaterialInteraction {
 
   /// The effective, passed material properties including the path correction.
   MaterialSlab slab;
+  /// The precomputed interaction constants of the material, if available.
+  const MaterialInteractionConstants* interactionConstants = nullptr;
   /// The path correction factor due to non-zero incidence on the surface.
   double pathCorrection;
   /// Expected phi variance due to the interactions.
@@ -99,8 +101,10 @@ struct PointwiseMaterialInteraction {
     }
 
     // Retrieve the material properties
-    slab = state.navigation.currentSurface->surfaceMaterial()->materialSlab(
-        pos, nav, updateStage);
+    const auto* surfaceMaterial =
+        state.navigation.currentSurface->surfaceMaterial();
+    slab = surfaceMaterial->materialSlab(pos, nav, updateStage);
+    interactionConstants = surfaceMaterial->interactionConstants(pos);
 
     // Correct the material properties for non-zero incidence
     pathCorrection = surface->pathCorrection(state.geoContext, pos, dir);
@@ -0,0 +1,130 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <vector>
+
+namespace Acts {
+
+/// @brief Batch intersection of a fixed set of surfaces
+///
+/// The surfaces handed to the batch are grouped by surface and bounds type
+/// at construction. For the common homogeneous groups - planes with
+/// rectangular (or no) bounds, discs with full azimuthal radial bounds and
+/// full azimuthal cylinders - the placement and bounds of the given geometry
+/// context are copied into contiguous arrays, which are intersected with
+/// dedicated inlined kernels without any virtual dispatch. All other
+/// surfaces fall back to the virtual @c Surface::intersect call.
+///
+/// The results are identical to calling @c Surface::intersect on each
+/// surface individually with the geometry context given at construction.
+/// The batch needs to be rebuilt if that context changes.
+class SurfaceBatch {
+ public:
+  /// Constructor from a list of surfaces
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param surfaces The surfaces to be grouped, the batch does not take
+  ///        ownership and they have to outlive it
+  SurfaceBatch(const GeometryContext& gctx,
+               const std::vector<const Surface*>& surfaces);
+
+  /// Intersect all surfaces of the batch with a straight line
+  ///
+  /// @param position The start position of the intersection attempt
+  /// @param direction The direction of the intersection attempt,
+  ///        @note expected to be normalized
+  /// @param bcheck The boundary check directive
+  /// @param [out] intersections The intersections, one entry per input
+  ///        surface in the order given at construction
+  void intersect(const Vector3D& position, const Vector3D& direction,
+                 const BoundaryCheck& bcheck,
+                 std::vector<SurfaceIntersection>& intersections) const;
+
+  /// Intersect all surfaces of the batch with a straight line
+  ///
+  /// @param position The start position of the intersection attempt
+  /// @param direction The direction of the intersection attempt,
+  ///        @note expected to be normalized
+  /// @param bcheck The boundary check directive
+  ///
+  /// @return The intersections, one entry per input surface in the order
+  ///         given at construction
+  std::vector<SurfaceIntersection> intersect(const Vector3D& position,
+                                             const Vector3D& direction,
+                                             const BoundaryCheck& bcheck) const;
+
+  /// The number of surfaces in the batch
+  size_t size() const { return m_surfaces.size(); }
+
+  /// The number of surfaces that are handled by the dedicated kernels
+  size_t vectorizedSize() const {
+    return m_planes.size() + m_discs.size() + m_cylinders.size();
+  }
+
+  /// The surfaces in the order given at construction
+  const std::vector<const Surface*>& surfaces() const { return m_surfaces; }
+
+ private:
+  /// Contiguous placement data: the local axes and the center, stored as
+  /// one array per coordinate for the kernels to run on
+  struct PlacementBlock {
+    std::vector<size_t> index;
+    std::vector<double> cx, cy, cz;
+    std::vector<double> ux, uy, uz;
+    std::vector<double> vx, vy, vz;
+    std::vector<double> nx, ny, nz;
+
+    void push_back(size_t idx, const Transform3D& transform);
+    size_t size() const { return index.size(); }
+  };
+
+  /// Planes with rectangle (or no) bounds
+  struct PlaneBlock : public PlacementBlock {
+    std::vector<Vector2D> min, max;
+  };
+
+  /// Discs with full azimuthal radial (or no) bounds
+  struct DiscBlock : public PlacementBlock {
+    std::vector<double> rMin, rMax;
+  };
+
+  /// Cylinders with full azimuthal coverage
+  struct CylinderBlock : public PlacementBlock {
+    std::vector<double> r, halfZ;
+  };
+
+  void intersectPlanes(const Vector3D& position, const Vector3D& direction,
+                       const BoundaryCheck& bcheck,
+                       std::vector<SurfaceIntersection>& intersections) const;
+
+  void intersectDiscs(const Vector3D& position, const Vector3D& direction,
+                      const BoundaryCheck& bcheck,
+                      std::vector<SurfaceIntersection>& intersections) const;
+
+  void intersectCylinders(
+      const Vector3D& position, const Vector3D& direction,
+      const BoundaryCheck& bcheck,
+      std::vector<SurfaceIntersection>& intersections) const;
+
+  GeometryContext m_gctx;
+  std::vector<const Surface*> m_surfaces;
+  PlaneBlock m_planes;
+  DiscBlock m_discs;
+  CylinderBlock m_cylinders;
+  /// Indices of the surfaces that use the virtual interface
+  std::vector<size_t> m_others;
+};
+
+}  // namespace Acts
@@ -14,8 +14,10 @@
 #include "Acts/Utilities/detail/grid_helper.hpp"
 
 #include <array>
+#include <memory>
 #include <numeric>
 #include <set>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -56,8 +58,42 @@ class Grid final {
   /// @param [in] axes actual axis objects spanning the grid
   Grid(std::tuple<Axes...> axes) : m_axes(std::move(axes)) {
     m_values.resize(size());
+    attachValues();
   }
 
+  /// @brief constructor for a read-only grid viewing external values
+  ///
+  /// @param [in] axes actual axis objects spanning the grid
+  /// @param [in] values the values of all bins, including under-/overflow
+  ///                    bins, in global bin order
+  ///
+  /// The values are not copied. The grid and all its copies share ownership
+  /// of the values, e.g. of a memory mapped file through a custom deleter.
+  ///
+  /// @pre @p values must point to at least @c size() values.
+  /// @note Mutable access to the values of such a grid throws.
+  Grid(std::tuple<Axes...> axes, std::shared_ptr<const T> values)
+      : m_axes(std::move(axes)), m_view(std::move(values)) {
+    attachValues();
+  }
+
+  Grid(const Grid& other)
+      : m_axes(other.m_axes), m_values(other.m_values), m_view(other.m_view) {
+    attachValues();
+  }
+  // moving the value store keeps its buffer and thus the value pointer valid
+  Grid(Grid&& other) = default;
+  ~Grid() = default;
+
+  Grid& operator=(const Grid& other) {
+    m_axes = other.m_axes;
+    m_values = other.m_values;
+    m_view = other.m_view;
+    attachValues();
+    return *this;
+  }
+  Grid& operator=(Grid&& other) = default;
+
   /// @brief access value stored in bin for a given point
   ///
   /// @tparam Point any type with point semantics supporting component access
@@ -74,7 +110,7 @@ class Grid final {
   //
   template <class Point>
   reference atPosition(const Point& point) {
-    return m_values.at(globalBinFromPosition(point));
+    return mutableValue(globalBinFromPosition(point));
   }
 
   /// @brief access value stored in bin for a given point
@@ -93,7 +129,7 @@ class Grid final {
   ///       Therefore, the look-up will never fail.
   template <class Point>
   const_reference atPosition(const Point& point) const {
-    return m_values.at(globalBinFromPosition(point));
+    return value(globalBinFromPosition(point));
   }
 
   /// @brief access value stored in bin with given global bin number
@@ -101,14 +137,14 @@ class Grid final {
   /// @param  [in] bin global bin number
   /// @return reference to value stored in bin containing the given
   ///         point
-  reference at(size_t bin) { return m_values.at(bin); }
+  reference at(size_t bin) { return mutableValue(bin); }
 
   /// @brief access value stored in bin with given global bin number
   ///
   /// @param  [in] bin global bin number
   /// @return const-reference to value stored in bin containing the given
   ///         point
-  const_reference at(size_t bin) const { return m_values.at(bin); }
+  const_reference at(size_t bin) const { return value(bin); }
 
   /// @brief access value stored in bin with given local bin numbers
   ///
@@ -119,7 +155,7 @@ class Grid final {
   /// @pre All local bin indices must be a valid index for the corresponding
   ///      axis (including the under-/overflow bin for this axis).
   reference atLocalBins(const index_t& localBins) {
-    return m_values.at(globalBinFromLocalBins(localBins));
+    return mutableValue(globalBinFromLocalBins(localBins));
   }
 
   /// @brief access value stored in bin with given local bin numbers
@@ -131,7 +167,7 @@ class Grid final {
   /// @pre All local bin indices must be a valid index for the corresponding
   ///      axis (including the under-/overflow bin for this axis).
   const_reference atLocalBins(const index_t& localBins) const {
-    return m_values.at(globalBinFromLocalBins(localBins));
+    return value(globalBinFromLocalBins(localBins));
   }
 
   /// @brief get global bin indices for closest points on grid
@@ -425,6 +461,37 @@ class Grid final {
   std::tuple<Axes...> m_axes;
   /// linear value store for each bin
   std::vector<T> m_values;
+  /// external values viewed instead of the value store, if set
+  std::shared_ptr<const T> m_view;
+  /// values used for read access, either the value store or the view
+  const T* m_data = nullptr;
+  /// number of values used for read access
+  size_t m_size = 0;
+
+  // Read access does not distinguish between stored and viewed values; the
+  // value pointer is fixed up whenever the value store is (re)assigned.
+  void attachValues() {
+    m_data = m_view ? m_view.get() : m_values.data();
+    m_size = m_view ? size() : m_values.size();
+  }
+
+  const_reference value(size_t bin) const {
+    if (bin >= m_size) {
+      throw std::out_of_range("Grid bin is out of range");
+    }
+    return m_data[bin];
+  }
+
+  reference mutableValue(size_t bin) {
+    // the value store of a view is empty, i.e. this is the only check needed
+    if (bin >= m_values.size()) {
+      if (m_view) {
+        throw std::logic_error("Values of a grid view can not be modified");
+      }
+      throw std::out_of_range("Grid bin is out of range");
+    }
+    return m_values[bin];
+  }
 
   // Part of closestPointsIndices that goes after local bins resolution.
   // Used as an interpolation performance optimization, but not exposed as it
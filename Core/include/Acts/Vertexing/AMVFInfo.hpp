@@ -10,9 +10,15 @@
 
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
+#include <deque>
+#include <limits>
 #include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -42,10 +48,107 @@ struct VertexInfo {
   // Needs relinearization bool
   bool relinearize = true;
 
-  // Vector of all track currently held by vertex
-  std::vector<const input_track_t*> trackLinks;
+  // Indices of all tracks currently held by vertex
+  std::vector<size_t> trackLinks;
 
-  std::map<const input_track_t*, const BoundTrackParameters> ip3dParams;
+  std::map<size_t, const BoundTrackParameters> ip3dParams;
 };
 
-}  // namespace Acts
\ No newline at end of file
+/// @brief Flat storage of the vertices and their VertexInfo objects
+///
+/// Each vertex is given a consecutive index when it is added, i.e. when the
+/// vertex finder creates it, and all further accesses use that index.
+/// References stay valid when further vertices are added.
+template <typename input_track_t>
+class VertexInfoStore {
+ public:
+  using Vertex_t = Vertex<input_track_t>;
+
+  /// Add a vertex with its info
+  ///
+  /// @return The index of the vertex
+  size_t add(Vertex_t& vtx,
+             VertexInfo<input_track_t> info = VertexInfo<input_track_t>()) {
+    m_vertices.push_back(&vtx);
+    m_infos.push_back(std::move(info));
+    return m_vertices.size() - 1;
+  }
+
+  /// Access the info of a vertex
+  VertexInfo<input_track_t>& operator[](size_t iVtx) { return m_infos[iVtx]; }
+
+  /// Access the info of a vertex, throws if the index is unknown
+  VertexInfo<input_track_t>& at(size_t iVtx) { return m_infos.at(iVtx); }
+
+  /// Access a vertex
+  Vertex_t& vertex(size_t iVtx) const { return *m_vertices[iVtx]; }
+
+  /// The number of vertices
+  size_t size() const { return m_vertices.size(); }
+
+ private:
+  std::vector<Vertex_t*> m_vertices;
+  std::deque<VertexInfo<input_track_t>> m_infos;
+};
+
+/// @brief Flat storage of the TrackAtVertex objects of all
+/// (track, vertex) pairs
+///
+/// Tracks and vertices are identified by their indices. The TrackAtVertex
+/// objects are stored in insertion order and each vertex has a row indexed
+/// by the track index that holds the slot of the pair, i.e. a lookup is two
+/// array accesses. References stay valid when further pairs are added.
+template <typename input_track_t>
+class TrackAtVertexStore {
+ public:
+  /// Add a TrackAtVertex for a (track, vertex) pair
+  ///
+  /// @return False if the pair already exists, which is then unchanged
+  bool emplace(size_t iTrk, size_t iVtx,
+               TrackAtVertex<input_track_t> trkAtVtx) {
+    if (iVtx >= m_rows.size()) {
+      m_rows.resize(iVtx + 1);
+    }
+    auto& row = m_rows[iVtx];
+    if (iTrk >= row.size()) {
+      row.resize(iTrk + 1, s_noSlot);
+    } else if (row[iTrk] != s_noSlot) {
+      return false;
+    }
+    row[iTrk] = m_tracks.size();
+    m_tracks.push_back(std::move(trkAtVtx));
+    return true;
+  }
+
+  /// Access the TrackAtVertex of a pair, throws if the pair is unknown
+  TrackAtVertex<input_track_t>& at(size_t iTrk, size_t iVtx) {
+    auto* trkAtVtx = find(iTrk, iVtx);
+    if (trkAtVtx == nullptr) {
+      throw std::out_of_range("TrackAtVertexStore: unknown pair");
+    }
+    return *trkAtVtx;
+  }
+
+  /// Find the TrackAtVertex of a pair
+  ///
+  /// @return Pointer to the object or nullptr if the pair is unknown
+  TrackAtVertex<input_track_t>* find(size_t iTrk, size_t iVtx) {
+    if (iVtx >= m_rows.size() or iTrk >= m_rows[iVtx].size() or
+        m_rows[iVtx][iTrk] == s_noSlot) {
+      return nullptr;
+    }
+    return &m_tracks[m_rows[iVtx][iTrk]];
+  }
+
+  /// The number of (track, vertex) pairs
+  size_t size() const { return m_tracks.size(); }
+
+ private:
+  static constexpr size_t s_noSlot = std::numeric_limits<size_t>::max();
+
+  // Slots of the pairs, indexed by vertex and track
+  std::vector<std::vector<size_t>> m_rows;
+  std::deque<TrackAtVertex<input_track_t>> m_tracks;
+};
+
+}  // namespace Acts
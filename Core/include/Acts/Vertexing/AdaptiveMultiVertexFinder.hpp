@@ -17,6 +17,7 @@
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <functional>
 #include <type_traits>
 
 namespace Acts {
@@ -126,6 +127,11 @@ class AdaptiveMultiVertexFinder {
     double minWeight = 0.0001;
 
     // Maximal number of iterations in the finding procedure
+    //
+    // Note: With useZSlices, the finding runs independently in every
+    // z-slice and this is the maximal number of iterations per slice,
+    // i.e. an event may take up to maxIterations times the number of
+    // slices iterations in total.
     int maxIterations = 100;
 
     // Include also single track vertices
@@ -155,10 +161,58 @@ class AdaptiveMultiVertexFinder {
     // So definitely consider setting this to true.
     bool useVertexCovForIPEstimation = false;
 
+    // Partition the tracks into z-slices that are separated by gaps of at
+    // least zSliceGap in the track z positions, and find the vertices in
+    // every slice independently. Vertices of neighbouring slices that are
+    // compatible with each other (see isMergedVertex) are merged afterwards:
+    // the tracks of both vertices are refitted into a single vertex, such
+    // that no track is lost at a slice boundary.
+    //
+    // Note: The gap should be larger than tracksMaxZinterval, such that
+    // no track of one slice could have been added to a vertex of another.
+    //
+    // The slice boundaries are not taken from the seed finder: the seed
+    // finders are iterative and return one seed per call from the tracks
+    // that are still unassigned, so no list of seeds exists before the
+    // finding. A gap is used instead. The track density of the Gaussian
+    // seed finders is a sum of per-track kernels of about the track z
+    // resolution, so it vanishes in a gap that is wide compared to that
+    // resolution, and no seed can be placed there.
+    //
+    // Tracks closer than zSliceGap in z always end up in the same slice. A
+    // vertex is hence only split if its own tracks have an empty z interval
+    // of more than zSliceGap. Its two parts are then found in neighbouring
+    // slices and merged as described above, or, if they are not compatible
+    // (see maxMergeVertexSignificance), both are kept as separate vertices.
+    // Vertices are only compared with the vertices of the neighbouring
+    // slice, vertices of slices further apart are never merged.
+    //
+    // Note: This changes the meaning of maxIterations, see there.
+    bool useZSlices = false;
+
+    // Minimum gap between the z positions of two tracks in different slices
+    double zSliceGap = 6. * Acts::UnitConstants::mm;
+
+    // Executes the finding in the z-slices: called with the number of
+    // slices and a function to be called once for every slice index.
+    // The calls for different indices are independent and may run
+    // concurrently, e.g. in a tbb::parallel_for. Runs them sequentially
+    // by default.
+    std::function<void(size_t, const std::function<void(size_t)>&)>
+        zSliceExecutor = [](size_t nSlices,
+                            const std::function<void(size_t)>& func) {
+          for (size_t i = 0; i < nSlices; ++i) {
+            func(i);
+          }
+        };
+
   };  // Config struct
 
   /// @struct State State struct for fulfilling interface
-  struct State {};
+  struct State {
+    // Number of independent z-slices in the last event
+    size_t nZSlices = 1;
+  };
 
   /// @brief Constructor used if InputTrack_t type == BoundTrackParameters
   ///
@@ -220,6 +274,43 @@ class AdaptiveMultiVertexFinder {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
+  /// @brief Performs the adaptive multi-vertex finding on one set of
+  /// tracks, i.e. the whole event or a single z-slice
+  ///
+  /// @param allTracks Input track collection
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return Vector of all reconstructed vertices
+  Result<std::vector<Vertex<InputTrack_t>>> findInSlice(
+      const std::vector<const InputTrack_t*>& allTracks,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
+  /// @brief Refits the tracks of two compatible vertices of neighbouring
+  /// z-slices into a single vertex
+  ///
+  /// @param first The vertex of the lower z-slice
+  /// @param second The vertex of the upper z-slice
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return The merged vertex with the tracks of both input vertices
+  Result<Vertex<InputTrack_t>> refitMergedVertex(
+      const Vertex<InputTrack_t>& first, const Vertex<InputTrack_t>& second,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
+  /// @brief Partitions the tracks into slices separated by gaps of at
+  /// least zSliceGap in z, keeping the original order within each slice
+  ///
+  /// @note The boundaries do not depend on the seed finder, see the
+  /// documentation of Config::useZSlices
+  ///
+  /// @param allTracks Input track collection
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return The track slices ordered in z
+  std::vector<std::vector<const InputTrack_t*>> partitionTracksInZ(
+      const std::vector<const InputTrack_t*>& allTracks,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
   /// @brief Calls the seed finder and sets constraints on the found seed
   /// vertex if desired
   ///
@@ -258,83 +349,79 @@ class AdaptiveMultiVertexFinder {
 
   /// @brief Adds compatible track to vertex candidate
   ///
-  /// @param tracks The tracks
-  /// @param vtx The vertex candidate
+  /// @param tracks Indices of the tracks
+  /// @param vtx Index of the vertex candidate
   /// @param[out] fitterState The vertex fitter state
   /// @param vertexingOptions Vertexing options
   Result<void> addCompatibleTracksToVertex(
-      const std::vector<const InputTrack_t*>& tracks, Vertex<InputTrack_t>& vtx,
+      const std::vector<size_t>& tracks, size_t vtx,
       FitterState_t& fitterState,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Method that tries to recover from cases where no tracks
   /// were added to the vertex candidate after seeding
   ///
-  /// @param allTracks The tracks to be considered (either origTrack or
-  /// seedTracks)
-  /// @param seedTracks The seed tracks
-  /// @param[out] vtx The vertex candidate
+  /// @param allTracks Indices of the tracks to be considered (either
+  /// origTrack or seedTracks)
+  /// @param seedTracks Indices of the seed tracks
+  /// @param vtx Index of the vertex candidate
   /// @param currentConstraint Vertex constraint
   /// @param[out] fitterState The vertex fitter state
   /// @param vertexingOptions Vertexing options
   ///
   /// return True if recovery was successful, false otherwise
   Result<bool> canRecoverFromNoCompatibleTracks(
-      const std::vector<const InputTrack_t*>& allTracks,
-      const std::vector<const InputTrack_t*>& seedTracks,
-      Vertex<InputTrack_t>& vtx, const Vertex<InputTrack_t>& currentConstraint,
-      FitterState_t& fitterState,
+      const std::vector<size_t>& allTracks,
+      const std::vector<size_t>& seedTracks, size_t vtx,
+      const Vertex<InputTrack_t>& currentConstraint, FitterState_t& fitterState,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Method that tries to prepare the vertex for the fit
   ///
-  /// @param allTracks The tracks to be considered (either origTrack or
-  /// seedTracks)
-  /// @param seedTracks The seed tracks
-  /// @param[out] vtx The vertex candidate
+  /// @param allTracks Indices of the tracks to be considered (either
+  /// origTrack or seedTracks)
+  /// @param seedTracks Indices of the seed tracks
+  /// @param vtx Index of the vertex candidate
   /// @param currentConstraint Vertex constraint
   /// @param[out] fitterState The vertex fitter state
   /// @param vertexingOptions Vertexing options
   ///
   /// @return True if preparation was successful, false otherwise
   Result<bool> canPrepareVertexForFit(
-      const std::vector<const InputTrack_t*>& allTracks,
-      const std::vector<const InputTrack_t*>& seedTracks,
-      Vertex<InputTrack_t>& vtx, const Vertex<InputTrack_t>& currentConstraint,
-      FitterState_t& fitterState,
+      const std::vector<size_t>& allTracks,
+      const std::vector<size_t>& seedTracks, size_t vtx,
+      const Vertex<InputTrack_t>& currentConstraint, FitterState_t& fitterState,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Method that checks if vertex is a good vertex and if
   /// compatible tracks are available
   ///
-  /// @param vtx The vertex candidate
-  /// @param seedTracks The seed tracks
+  /// @param vtx Index of the vertex candidate
+  /// @param seedTracks Indices of the seed tracks
   /// @param fitterState The vertex fitter state
   ///
   /// @return pair(nCompatibleTracks, isGoodVertex)
   std::pair<int, bool> checkVertexAndCompatibleTracks(
-      Vertex<InputTrack_t>& vtx,
-      const std::vector<const InputTrack_t*>& seedTracks,
+      size_t vtx, const std::vector<size_t>& seedTracks,
       FitterState_t& fitterState) const;
 
   /// @brief Method that removes all tracks that are compatible with
   /// current vertex from seedTracks
   ///
-  /// @param vtx The vertex candidate
-  /// @param[out] seedTracks The seed tracks
+  /// @param vtx Index of the vertex candidate
+  /// @param[out] seedTracks Indices of the seed tracks
   /// @param fitterState The vertex fitter state
   /// @param[out] removedSeedTracks Collection of seed track that will be
   /// removed
   void removeCompatibleTracksFromSeedTracks(
-      Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
-      FitterState_t& fitterState,
+      size_t vtx, std::vector<size_t>& seedTracks, FitterState_t& fitterState,
       std::vector<const InputTrack_t*>& removedSeedTracks) const;
 
   /// @brief Method that tries to remove an incompatible track
   /// from seed tracks after removing a compatible track failed.
   ///
-  /// @param vtx The vertex candidate
-  /// @param[out] seedTracks The seed tracks
+  /// @param vtx Index of the vertex candidate
+  /// @param[out] seedTracks Indices of the seed tracks
   /// @param fitterState The vertex fitter state
   /// @param[out] removedSeedTracks Collection of seed track that will be
   /// removed
@@ -342,21 +429,19 @@ class AdaptiveMultiVertexFinder {
   ///
   /// @return Incompatible track was removed
   bool removeTrackIfIncompatible(
-      Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
-      FitterState_t& fitterState,
+      size_t vtx, std::vector<size_t>& seedTracks, FitterState_t& fitterState,
       std::vector<const InputTrack_t*>& removedSeedTracks,
       const GeometryContext& geoCtx) const;
 
   /// @brief Method that evaluates if the new vertex candidate should
   /// be kept, i.e. saved, or not
   ///
-  /// @param vtx The vertex candidate
-  /// @param allVertices All so far found vertices
+  /// @param vtx Index of the vertex candidate
+  /// @param allVertices Indices of all so far found vertices
   /// @param fitterState The vertex fitter state
   ///
   /// @return Keep new vertex
-  bool keepNewVertex(Vertex<InputTrack_t>& vtx,
-                     const std::vector<Vertex<InputTrack_t>*>& allVertices,
+  bool keepNewVertex(size_t vtx, const std::vector<size_t>& allVertices,
                      FitterState_t& fitterState) const;
 
   /// @brief Method that evaluates if the new vertex candidate is
@@ -373,26 +458,25 @@ class AdaptiveMultiVertexFinder {
   /// @brief Method that deletes last vertex from list of all vertices
   /// and refits all vertices afterwards
   ///
-  /// @param vtx The last added vertex which will be removed
+  /// @param vtx Index of the last added vertex which will be removed
   /// @param allVertices Vector containing the unique_ptr to vertices
-  /// @param allVerticesPtr Vector containing the actual addresses
+  /// @param allVertexIndices Vector containing the vertex indices
   /// @param fitterState The current vertex fitter state
   /// @param vertexingOptions Vertexing options
   Result<void> deleteLastVertex(
-      Vertex<InputTrack_t>& vtx,
+      size_t vtx,
       std::vector<std::unique_ptr<Vertex<InputTrack_t>>>& allVertices,
-      std::vector<Vertex<InputTrack_t>*>& allVerticesPtr,
-      FitterState_t& fitterState,
+      std::vector<size_t>& allVertexIndices, FitterState_t& fitterState,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Prepares the output vector of vertices
   ///
-  /// @param allVerticesPtr Vector of pointers to vertices
+  /// @param allVertexIndices Indices of the vertices
   /// @param fitterState The vertex fitter state
   ///
   /// @return The output vertex collection
   Result<std::vector<Vertex<InputTrack_t>>> getVertexOutputList(
-      const std::vector<Vertex<InputTrack_t>*>& allVerticesPtr,
+      const std::vector<size_t>& allVertexIndices,
       FitterState_t& fitterState) const;
 };
 
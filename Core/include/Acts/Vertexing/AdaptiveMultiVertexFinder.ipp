@@ -8,26 +8,181 @@
 
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <system_error>
+
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     const std::vector<const InputTrack_t*>& allTracks,
     const VertexingOptions<InputTrack_t>& vertexingOptions,
-    State& /*state*/) const -> Result<std::vector<Vertex<InputTrack_t>>> {
+    State& state) const -> Result<std::vector<Vertex<InputTrack_t>>> {
   if (allTracks.empty()) {
     return VertexingError::EmptyInput;
   }
-  // Original tracks
-  const std::vector<const InputTrack_t*>& origTracks = allTracks;
+  if (not m_cfg.useZSlices) {
+    state.nZSlices = 1;
+    return findInSlice(allTracks, vertexingOptions);
+  }
 
-  // Seed tracks
-  std::vector<const InputTrack_t*> seedTracks = allTracks;
+  const auto slices = partitionTracksInZ(allTracks, vertexingOptions);
+  state.nZSlices = slices.size();
+  ACTS_DEBUG("Finding vertices in " << slices.size() << " z-slices.");
+
+  // Every slice is processed with its own output
+  std::vector<std::vector<Vertex<InputTrack_t>>> sliceVertices(slices.size());
+  std::vector<std::error_code> sliceErrors(slices.size());
+  m_cfg.zSliceExecutor(slices.size(), [&](size_t iSlice) {
+    auto sliceResult = findInSlice(slices[iSlice], vertexingOptions);
+    if (sliceResult.ok()) {
+      sliceVertices[iSlice] = std::move(*sliceResult);
+    } else {
+      sliceErrors[iSlice] = sliceResult.error();
+    }
+  });
+
+  for (const auto& sliceError : sliceErrors) {
+    if (sliceError) {
+      return sliceError;
+    }
+  }
+
+  // Merge the vertices of neighbouring slices that are compatible with
+  // each other by refitting the tracks of both into a single vertex
+  std::vector<Vertex<InputTrack_t>> outputVertices;
+  size_t previousBegin = 0;
+  for (auto& vertices : sliceVertices) {
+    const size_t currentBegin = outputVertices.size();
+    for (auto& vtx : vertices) {
+      bool merged = false;
+      for (size_t iPrev = previousBegin; iPrev < currentBegin; ++iPrev) {
+        auto& previous = outputVertices[iPrev];
+        if (not isMergedVertex(vtx, {&previous})) {
+          continue;
+        }
+        ACTS_DEBUG("Merging vertices at z-slice boundary: "
+                   << previous.position()[eZ] << " and " << vtx.position()[eZ]);
+        auto mergeResult = refitMergedVertex(previous, vtx, vertexingOptions);
+        if (not mergeResult.ok()) {
+          return mergeResult.error();
+        }
+        previous = std::move(*mergeResult);
+        merged = true;
+        break;
+      }
+      if (not merged) {
+        outputVertices.push_back(std::move(vtx));
+      }
+    }
+    previousBegin = currentBegin;
+  }
+
+  return outputVertices;
+}
+
+template <typename vfitter_t, typename sfinder_t>
+auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::refitMergedVertex(
+    const Vertex<InputTrack_t>& first, const Vertex<InputTrack_t>& second,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> Result<Vertex<InputTrack_t>> {
+  FitterState_t fitterState(vertexingOptions.magFieldContext);
+
+  // Start from the track weighted mean of both vertex positions
+  const double nFirst = first.tracks().size();
+  const double nSecond = second.tracks().size();
+  Vertex<InputTrack_t> merged = (nFirst >= nSecond) ? first : second;
+  merged.setFullPosition((nFirst * first.fullPosition() +
+                          nSecond * second.fullPosition()) /
+                         (nFirst + nSecond));
+  Vertex<InputTrack_t> currentConstraint = vertexingOptions.vertexConstraint;
+  setConstraintAfterSeeding(currentConstraint, merged);
+  const size_t iMerged = fitterState.vtxInfoMap.add(
+      merged,
+      VertexInfo<InputTrack_t>(currentConstraint, merged.fullPosition()));
+
+  // The slices do not share any tracks, i.e. the track sets are disjoint
+  for (const auto* vtx : {&first, &second}) {
+    for (const auto& trkAtVtx : vtx->tracks()) {
+      const InputTrack_t* trk = trkAtVtx.originalParams;
+      const size_t iTrk = fitterState.addTrack(trk);
+      fitterState.tracksAtVerticesMap.emplace(
+          iTrk, iMerged,
+          TrackAtVertex<InputTrack_t>(m_extractParameters(*trk), trk));
+      fitterState.vtxInfoMap[iMerged].trackLinks.push_back(iTrk);
+    }
+  }
+  fitterState.attachVertexToTracks(iMerged);
+
+  auto fitResult = m_cfg.vertexFitter.addVtxToFit(
+      fitterState, iMerged, m_cfg.linearizer, vertexingOptions);
+  if (!fitResult.ok()) {
+    return fitResult.error();
+  }
+  auto outputResult = getVertexOutputList({iMerged}, fitterState);
+  if (!outputResult.ok()) {
+    return outputResult.error();
+  }
+  return std::move((*outputResult).front());
+}
+
+template <typename vfitter_t, typename sfinder_t>
+auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::partitionTracksInZ(
+    const std::vector<const InputTrack_t*>& allTracks,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> std::vector<std::vector<const InputTrack_t*>> {
+  std::vector<double> zPositions;
+  zPositions.reserve(allTracks.size());
+  for (const auto& trk : allTracks) {
+    zPositions.push_back(
+        m_extractParameters(*trk).position(vertexingOptions.geoContext)[eZ]);
+  }
+
+  std::vector<size_t> order(allTracks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return zPositions[a] < zPositions[b];
+  });
+
+  // Assign a slice to every track in order of increasing z
+  std::vector<size_t> sliceIndex(allTracks.size(), 0);
+  size_t nSlices = allTracks.empty() ? 0 : 1;
+  for (size_t i = 1; i < order.size(); ++i) {
+    if (zPositions[order[i]] - zPositions[order[i - 1]] > m_cfg.zSliceGap) {
+      ++nSlices;
+    }
+    sliceIndex[order[i]] = nSlices - 1;
+  }
+
+  // Fill the slices in the original track order
+  std::vector<std::vector<const InputTrack_t*>> slices(nSlices);
+  for (size_t i = 0; i < allTracks.size(); ++i) {
+    slices[sliceIndex[i]].push_back(allTracks[i]);
+  }
+  return slices;
+}
 
+template <typename vfitter_t, typename sfinder_t>
+auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::findInSlice(
+    const std::vector<const InputTrack_t*>& allTracks,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> Result<std::vector<Vertex<InputTrack_t>>> {
   FitterState_t fitterState(vertexingOptions.magFieldContext);
   SeedFinderState_t seedFinderState;
 
+  // Original tracks, given by their index in the fitter state
+  std::vector<size_t> origTracks;
+  origTracks.reserve(allTracks.size());
+  for (const auto& trk : allTracks) {
+    origTracks.push_back(fitterState.addTrack(trk));
+  }
+
+  // Seed tracks
+  std::vector<size_t> seedTracks = origTracks;
+
   std::vector<std::unique_ptr<Vertex<InputTrack_t>>> allVertices;
 
-  std::vector<Vertex<InputTrack_t>*> allVerticesPtr;
+  // Indices of all vertices in the fitter state
+  std::vector<size_t> allVertexIndices;
 
   int iteration = 0;
   std::vector<const InputTrack_t*> removedSeedTracks;
@@ -36,7 +191,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
          iteration < m_cfg.maxIterations) {
     // Tracks that are used for searching compatible tracks
     // near a vertex candidate
-    std::vector<const InputTrack_t*> searchTracks;
+    std::vector<size_t> searchTracks;
     if (m_cfg.doRealMultiVertex) {
       searchTracks = origTracks;
     } else {
@@ -44,15 +199,23 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     }
     Vertex<InputTrack_t> currentConstraint = vertexingOptions.vertexConstraint;
     // Retrieve seed vertex from all remaining seedTracks
-    auto seedResult = doSeeding(seedTracks, currentConstraint, vertexingOptions,
-                                seedFinderState, removedSeedTracks);
+    std::vector<const InputTrack_t*> seedTrackPtrs;
+    seedTrackPtrs.reserve(seedTracks.size());
+    for (auto trk : seedTracks) {
+      seedTrackPtrs.push_back(fitterState.tracks[trk]);
+    }
+    auto seedResult = doSeeding(seedTrackPtrs, currentConstraint,
+                                vertexingOptions, seedFinderState,
+                                removedSeedTracks);
     if (!seedResult.ok()) {
       return seedResult.error();
     }
     allVertices.push_back(std::make_unique<Vertex<InputTrack_t>>(*seedResult));
 
     Vertex<InputTrack_t>& vtxCandidate = *allVertices.back();
-    allVerticesPtr.push_back(&vtxCandidate);
+    // The candidate is identified by its index in the fitter state
+    const size_t iCandidate = fitterState.vtxInfoMap.add(vtxCandidate);
+    allVertexIndices.push_back(iCandidate);
 
     ACTS_DEBUG("Position of current vertex candidate after seeding: "
                << vtxCandidate.fullPosition());
@@ -61,7 +224,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
       ACTS_DEBUG(
           "No seed found anymore. Break and stop primary vertex finding.");
       allVertices.pop_back();
-      allVerticesPtr.pop_back();
+      allVertexIndices.pop_back();
       break;
     }
 
@@ -70,7 +233,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     removedSeedTracks.clear();
 
     auto prepResult = canPrepareVertexForFit(searchTracks, seedTracks,
-                                             vtxCandidate, currentConstraint,
+                                             iCandidate, currentConstraint,
                                              fitterState, vertexingOptions);
 
     if (!prepResult.ok()) {
@@ -79,15 +242,15 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     if (!(*prepResult)) {
       ACTS_DEBUG("Could not prepare for fit anymore. Break.");
       allVertices.pop_back();
-      allVerticesPtr.pop_back();
+      allVertexIndices.pop_back();
       break;
     }
     // Update fitter state with all vertices
-    fitterState.addVertexToMultiMap(vtxCandidate);
+    fitterState.attachVertexToTracks(iCandidate);
 
     // Perform the fit
     auto fitResult = m_cfg.vertexFitter.addVtxToFit(
-        fitterState, vtxCandidate, m_cfg.linearizer, vertexingOptions);
+        fitterState, iCandidate, m_cfg.linearizer, vertexingOptions);
     if (!fitResult.ok()) {
       return fitResult.error();
     }
@@ -95,32 +258,32 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
                << vtxCandidate.fullPosition());
     // Check if vertex is good vertex
     auto [nCompatibleTracks, isGoodVertex] =
-        checkVertexAndCompatibleTracks(vtxCandidate, seedTracks, fitterState);
+        checkVertexAndCompatibleTracks(iCandidate, seedTracks, fitterState);
 
     ACTS_DEBUG("Vertex is good vertex: " << isGoodVertex);
     if (nCompatibleTracks > 0) {
-      removeCompatibleTracksFromSeedTracks(vtxCandidate, seedTracks,
-                                           fitterState, removedSeedTracks);
+      removeCompatibleTracksFromSeedTracks(iCandidate, seedTracks, fitterState,
+                                           removedSeedTracks);
     } else {
       bool removedIncompatibleTrack = removeTrackIfIncompatible(
-          vtxCandidate, seedTracks, fitterState, removedSeedTracks,
+          iCandidate, seedTracks, fitterState, removedSeedTracks,
           vertexingOptions.geoContext);
       if (!removedIncompatibleTrack) {
         ACTS_DEBUG(
             "Could not remove any further track from seed tracks. Break.");
         allVertices.pop_back();
-        allVerticesPtr.pop_back();
+        allVertexIndices.pop_back();
         break;
       }
     }
-    bool keepVertex = isGoodVertex &&
-                      keepNewVertex(vtxCandidate, allVerticesPtr, fitterState);
+    bool keepVertex =
+        isGoodVertex && keepNewVertex(iCandidate, allVertexIndices, fitterState);
     ACTS_DEBUG("New vertex will be saved: " << keepVertex);
 
     // Delete vertex from allVertices list again if it's not kept
     if (not keepVertex) {
       auto deleteVertexResult =
-          deleteLastVertex(vtxCandidate, allVertices, allVerticesPtr,
+          deleteLastVertex(iCandidate, allVertices, allVertexIndices,
                            fitterState, vertexingOptions);
       if (not deleteVertexResult.ok()) {
         return deleteVertexResult.error();
@@ -129,7 +292,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     iteration++;
   }  // end while loop
 
-  return getVertexOutputList(allVerticesPtr, fitterState);
+  return getVertexOutputList(allVertexIndices, fitterState);
 }
 
 template <typename vfitter_t, typename sfinder_t>
@@ -220,11 +383,13 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::getIPSignificance(
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     addCompatibleTracksToVertex(
-        const std::vector<const InputTrack_t*>& tracks,
-        Vertex<InputTrack_t>& vtx, FitterState_t& fitterState,
+        const std::vector<size_t>& tracks, size_t iVtx,
+        FitterState_t& fitterState,
         const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<void> {
-  for (const auto& trk : tracks) {
+  const Vertex<InputTrack_t>& vtx = fitterState.vtxInfoMap.vertex(iVtx);
+  for (const auto& iTrk : tracks) {
+    const InputTrack_t* trk = fitterState.tracks[iTrk];
     auto params = m_extractParameters(*trk);
     auto pos = params.position(vertexingOptions.geoContext);
     // If track is too far away from vertex, do not consider checking the IP
@@ -239,11 +404,11 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     double ipSig = *sigRes;
     if (ipSig < m_cfg.tracksMaxSignificance) {
       // Create TrackAtVertex objects, unique for each (track, vertex) pair
-      fitterState.tracksAtVerticesMap.emplace(std::make_pair(trk, &vtx),
+      fitterState.tracksAtVerticesMap.emplace(iTrk, iVtx,
                                               TrackAtVertex(params, trk));
 
       // Add the original track parameters to the list for vtx
-      fitterState.vtxInfoMap[&vtx].trackLinks.push_back(trk);
+      fitterState.vtxInfoMap[iVtx].trackLinks.push_back(iTrk);
     }
   }
   return {};
@@ -252,25 +417,25 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     canRecoverFromNoCompatibleTracks(
-        const std::vector<const InputTrack_t*>& allTracks,
-        const std::vector<const InputTrack_t*>& seedTracks,
-        Vertex<InputTrack_t>& vtx,
+        const std::vector<size_t>& allTracks,
+        const std::vector<size_t>& seedTracks, size_t iVtx,
         const Vertex<InputTrack_t>& currentConstraint,
         FitterState_t& fitterState,
         const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<bool> {
+  Vertex<InputTrack_t>& vtx = fitterState.vtxInfoMap.vertex(iVtx);
   // Recover from cases where no compatible tracks to vertex
   // candidate were found
   // TODO: This is for now how it's done in athena... this look a bit
   // nasty to me
-  if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+  if (fitterState.vtxInfoMap[iVtx].trackLinks.empty()) {
     // Find nearest track to vertex candidate
     double smallestDeltaZ = std::numeric_limits<double>::max();
     double newZ = 0;
     bool nearTrackFound = false;
     for (const auto& trk : seedTracks) {
-      auto pos =
-          m_extractParameters(*trk).position(vertexingOptions.geoContext);
+      auto pos = m_extractParameters(*fitterState.tracks[trk])
+                     .position(vertexingOptions.geoContext);
       auto zDistance = std::abs(pos[eZ] - vtx.position()[eZ]);
       if (zDistance < smallestDeltaZ) {
         smallestDeltaZ = zDistance;
@@ -282,17 +447,17 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
       vtx.setFullPosition(Vector4D(0., 0., newZ, 0.));
 
       // Update vertex info for current vertex
-      fitterState.vtxInfoMap[&vtx] =
+      fitterState.vtxInfoMap[iVtx] =
           VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
 
       // Try to add compatible track with adapted vertex position
-      auto res = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
+      auto res = addCompatibleTracksToVertex(allTracks, iVtx, fitterState,
                                              vertexingOptions);
       if (!res.ok()) {
         return Result<bool>::failure(res.error());
       }
 
-      if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+      if (fitterState.vtxInfoMap[iVtx].trackLinks.empty()) {
         ACTS_DEBUG(
             "No tracks near seed were found, while at least one was "
             "expected. Break.");
@@ -311,26 +476,25 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     canPrepareVertexForFit(
-        const std::vector<const InputTrack_t*>& allTracks,
-        const std::vector<const InputTrack_t*>& seedTracks,
-        Vertex<InputTrack_t>& vtx,
+        const std::vector<size_t>& allTracks,
+        const std::vector<size_t>& seedTracks, size_t iVtx,
         const Vertex<InputTrack_t>& currentConstraint,
         FitterState_t& fitterState,
         const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<bool> {
   // Add vertex info to fitter state
-  fitterState.vtxInfoMap[&vtx] =
-      VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
+  fitterState.vtxInfoMap[iVtx] = VertexInfo<InputTrack_t>(
+      currentConstraint, fitterState.vtxInfoMap.vertex(iVtx).fullPosition());
 
   // Add all compatible tracks to vertex
-  auto resComp = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
+  auto resComp = addCompatibleTracksToVertex(allTracks, iVtx, fitterState,
                                              vertexingOptions);
   if (!resComp.ok()) {
     return Result<bool>::failure(resComp.error());
   }
 
   // Try to recover from cases where adding compatible track was not possible
-  auto resRec = canRecoverFromNoCompatibleTracks(allTracks, seedTracks, vtx,
+  auto resRec = canRecoverFromNoCompatibleTracks(allTracks, seedTracks, iVtx,
                                                  currentConstraint, fitterState,
                                                  vertexingOptions);
   if (!resRec.ok()) {
@@ -343,14 +507,12 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     checkVertexAndCompatibleTracks(
-        Vertex<InputTrack_t>& vtx,
-        const std::vector<const InputTrack_t*>& seedTracks,
+        size_t iVtx, const std::vector<size_t>& seedTracks,
         FitterState_t& fitterState) const -> std::pair<int, bool> {
   bool isGoodVertex = false;
   int nCompatibleTracks = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trk : fitterState.vtxInfoMap[iVtx].trackLinks) {
+    const auto& trkAtVtx = fitterState.tracksAtVerticesMap.at(trk, iVtx);
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -383,12 +545,11 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     removeCompatibleTracksFromSeedTracks(
-        Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
+        size_t iVtx, std::vector<size_t>& seedTracks,
         FitterState_t& fitterState,
         std::vector<const InputTrack_t*>& removedSeedTracks) const -> void {
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trk : fitterState.vtxInfoMap[iVtx].trackLinks) {
+    const auto& trkAtVtx = fitterState.tracksAtVerticesMap.at(trk, iVtx);
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -400,7 +561,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
                        [&trk](auto seedTrk) { return trk == seedTrk; });
       if (foundSeedIter != seedTracks.end()) {
         seedTracks.erase(foundSeedIter);
-        removedSeedTracks.push_back(trk);
+        removedSeedTracks.push_back(fitterState.tracks[trk]);
       }
     }
   }
@@ -409,18 +570,18 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     removeTrackIfIncompatible(
-        Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
+        size_t iVtx, std::vector<size_t>& seedTracks,
         FitterState_t& fitterState,
         std::vector<const InputTrack_t*>& removedSeedTracks,
         const GeometryContext& geoCtx) const -> bool {
+  const Vertex<InputTrack_t>& vtx = fitterState.vtxInfoMap.vertex(iVtx);
   // Try to find the track with highest compatibility
   double maxCompatibility = 0;
 
   auto maxCompSeedIt = seedTracks.end();
   const InputTrack_t* removedTrack = nullptr;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trk : fitterState.vtxInfoMap[iVtx].trackLinks) {
+    const auto& trkAtVtx = fitterState.tracksAtVerticesMap.at(trk, iVtx);
     double compatibility = trkAtVtx.vertexCompatibility;
     if (compatibility > maxCompatibility) {
       // Try to find track in seed tracks
@@ -430,7 +591,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
       if (foundSeedIter != seedTracks.end()) {
         maxCompatibility = compatibility;
         maxCompSeedIt = foundSeedIter;
-        removedTrack = trk;
+        removedTrack = fitterState.tracks[trk];
       }
     }
   }
@@ -445,12 +606,13 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     double smallestDeltaZ = std::numeric_limits<double>::max();
     auto smallestDzSeedIter = seedTracks.end();
     for (unsigned int i = 0; i < seedTracks.size(); i++) {
-      auto pos = m_extractParameters(*seedTracks[i]).position(geoCtx);
+      auto pos = m_extractParameters(*fitterState.tracks[seedTracks[i]])
+                     .position(geoCtx);
       double zDistance = std::abs(pos[eZ] - vtx.position()[eZ]);
       if (zDistance < smallestDeltaZ) {
         smallestDeltaZ = zDistance;
         smallestDzSeedIter = seedTracks.begin() + i;
-        removedTrack = seedTracks[i];
+        removedTrack = fitterState.tracks[seedTracks[i]];
       }
     }
     if (smallestDzSeedIter != seedTracks.end()) {
@@ -466,15 +628,13 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::keepNewVertex(
-    Vertex<InputTrack_t>& vtx,
-    const std::vector<Vertex<InputTrack_t>*>& allVertices,
+    size_t iVtx, const std::vector<size_t>& allVertices,
     FitterState_t& fitterState) const -> bool {
   double contamination = 0.;
   double contaminationNum = 0;
   double contaminationDeNom = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trk : fitterState.vtxInfoMap[iVtx].trackLinks) {
+    const auto& trkAtVtx = fitterState.tracksAtVerticesMap.at(trk, iVtx);
     double trackWeight = trkAtVtx.trackWeight;
     contaminationNum += trackWeight * (1. - trackWeight);
     contaminationDeNom += trackWeight * trackWeight;
@@ -486,7 +646,12 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::keepNewVertex(
     return false;
   }
 
-  if (isMergedVertex(vtx, allVertices)) {
+  std::vector<Vertex<InputTrack_t>*> allVerticesPtr;
+  allVerticesPtr.reserve(allVertices.size());
+  for (auto other : allVertices) {
+    allVerticesPtr.push_back(&fitterState.vtxInfoMap.vertex(other));
+  }
+  if (isMergedVertex(fitterState.vtxInfoMap.vertex(iVtx), allVerticesPtr)) {
     return false;
   }
 
@@ -538,21 +703,20 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::isMergedVertex(
 
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::deleteLastVertex(
-    Vertex<InputTrack_t>& vtx,
+    size_t iVtx,
     std::vector<std::unique_ptr<Vertex<InputTrack_t>>>& allVertices,
-    std::vector<Vertex<InputTrack_t>*>& allVerticesPtr,
-    FitterState_t& fitterState,
+    std::vector<size_t>& allVertexIndices, FitterState_t& fitterState,
     const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<void> {
   allVertices.pop_back();
-  allVerticesPtr.pop_back();
+  allVertexIndices.pop_back();
 
   // Update fitter state with removed vertex candidate
-  fitterState.removeVertexFromMultiMap(vtx);
+  fitterState.detachVertexFromTracks(iVtx);
 
   // Do the fit with removed vertex
   auto fitResult = m_cfg.vertexFitter.addVtxToFit(
-      fitterState, vtx, m_cfg.linearizer, vertexingOptions);
+      fitterState, iVtx, m_cfg.linearizer, vertexingOptions);
   if (!fitResult.ok()) {
     return fitResult.error();
   }
@@ -562,16 +726,15 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::deleteLastVertex(
 
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::getVertexOutputList(
-    const std::vector<Vertex<InputTrack_t>*>& allVerticesPtr,
+    const std::vector<size_t>& allVertexIndices,
     FitterState_t& fitterState) const
     -> Acts::Result<std::vector<Vertex<InputTrack_t>>> {
   std::vector<Vertex<InputTrack_t>> outputVec;
-  for (auto vtx : allVerticesPtr) {
-    auto& outVtx = *vtx;
+  for (auto vtx : allVertexIndices) {
+    auto& outVtx = fitterState.vtxInfoMap.vertex(vtx);
     std::vector<TrackAtVertex<InputTrack_t>> tracksAtVtx;
     for (const auto& trk : fitterState.vtxInfoMap[vtx].trackLinks) {
-      tracksAtVtx.push_back(
-          fitterState.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
+      tracksAtVtx.push_back(fitterState.tracksAtVerticesMap.at(trk, vtx));
     }
     outVtx.setTracksAtVertex(tracksAtVtx);
     outputVec.push_back(outVtx);
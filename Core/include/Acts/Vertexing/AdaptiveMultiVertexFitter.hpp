@@ -20,7 +20,9 @@
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 namespace Acts {
 
@@ -53,8 +55,8 @@ class AdaptiveMultiVertexFitter {
   struct State {
     State(const Acts::MagneticFieldContext& mctx)
         : ipState(mctx), linearizerState(mctx) {}
-    // Vertex collection to be fitted
-    std::vector<Vertex<InputTrack_t>*> vertexCollection;
+    // Vertex collection to be fitted, given by the vertex indices
+    std::vector<size_t> vertexCollection;
 
     // Annealing state
     AnnealingUtility::State annealingState;
@@ -65,35 +67,43 @@ class AdaptiveMultiVertexFitter {
     // Linearizer state
     typename Linearizer_t::State linearizerState;
 
-    // Map to store vertices information
-    std::map<Vertex<InputTrack_t>*, VertexInfo<InputTrack_t>> vtxInfoMap;
+    // The tracks, indexed by the track index
+    std::vector<const InputTrack_t*> tracks;
 
-    std::multimap<const InputTrack_t*, Vertex<InputTrack_t>*>
-        trackToVerticesMultiMap;
+    // Flat store of the vertices information, indexed by the vertex index
+    VertexInfoStore<InputTrack_t> vtxInfoMap;
 
-    std::map<std::pair<const InputTrack_t*, Vertex<InputTrack_t>*>,
-             TrackAtVertex<InputTrack_t>>
-        tracksAtVerticesMap;
+    // Indices of the vertices each track is attached to, indexed by the
+    // track index
+    std::vector<std::vector<size_t>> trackToVertices;
+
+    // Flat store of the TrackAtVertex objects, indexed by the track and
+    // the vertex index
+    TrackAtVertexStore<InputTrack_t> tracksAtVerticesMap;
 
     /// @brief Default State constructor
     State() = default;
 
-    // Adds a vertex to trackToVerticesMultiMap
-    void addVertexToMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto trk : vtxInfoMap[&vtx].trackLinks) {
-        trackToVerticesMultiMap.emplace(trk, &vtx);
+    // Adds a track and returns its index
+    size_t addTrack(const InputTrack_t* trk) {
+      tracks.push_back(trk);
+      trackToVertices.emplace_back();
+      return tracks.size() - 1;
+    }
+
+    // Attaches a vertex to all its tracks in trackToVertices
+    void attachVertexToTracks(size_t iVtx) {
+      for (auto iTrk : vtxInfoMap[iVtx].trackLinks) {
+        trackToVertices[iTrk].push_back(iVtx);
       }
     }
 
-    // Removes a vertex from trackToVerticesMultiMap
-    void removeVertexFromMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto iter = trackToVerticesMultiMap.begin();
-           iter != trackToVerticesMultiMap.end();) {
-        if (iter->second == &vtx) {
-          iter = trackToVerticesMultiMap.erase(iter);
-        } else {
-          ++iter;
-        }
+    // Detaches a vertex from all its tracks in trackToVertices
+    void detachVertexFromTracks(size_t iVtx) {
+      for (auto iTrk : vtxInfoMap[iVtx].trackLinks) {
+        auto& vertices = trackToVertices[iTrk];
+        vertices.erase(std::remove(vertices.begin(), vertices.end(), iVtx),
+                       vertices.end());
       }
     }
   };
@@ -169,13 +179,13 @@ class AdaptiveMultiVertexFitter {
   /// fit of all vertices in `verticesToFit` by invoking `fitImpl`
   ///
   /// @param state The state object
-  /// @param verticesToFit Vector containing all vertices to be fitted
+  /// @param verticesToFit Indices of all vertices to be fitted
   /// @param linearizer The track linearizer
   /// @param vertexingOptions Vertexing options
   ///
   /// @return Result<void> object
   Result<void> fit(
-      State& state, const std::vector<Vertex<InputTrack_t>*>& verticesToFit,
+      State& state, const std::vector<size_t>& verticesToFit,
       const Linearizer_t& linearizer,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
@@ -197,14 +207,13 @@ class AdaptiveMultiVertexFitter {
   /// constraint vertex, list of MAV)
   ///
   /// @param state The state object
-  /// @param newVertex New vertex to be added to fit
+  /// @param newVertex Index of the new vertex to be added to fit
   /// @param linearizer The track linearizer
   /// @param vertexingOptions Vertexing options
   ///
   /// @return Result<void> object
   Result<void> addVtxToFit(
-      State& state, Vertex<InputTrack_t>& newVertex,
-      const Linearizer_t& linearizer,
+      State& state, size_t newVertex, const Linearizer_t& linearizer,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
  private:
@@ -238,13 +247,12 @@ class AdaptiveMultiVertexFitter {
 
   /// @brief Tests if vertex is already in list of vertices or not
   ///
-  /// @param vtx Vertex to test
-  /// @param verticesVec Vector of vertices to search
+  /// @param vtx Index of the vertex to test
+  /// @param verticesVec Indices of the vertices to search
   ///
   /// @return True if vtx is already in verticesVec
-  bool isAlreadyInList(
-      Vertex<InputTrack_t>* vtx,
-      const std::vector<Vertex<InputTrack_t>*>& verticesVec) const;
+  bool isAlreadyInList(size_t vtx,
+                       const std::vector<size_t>& verticesVec) const;
 
   /// @brief Prepares vertex object for the actual fit, i.e.
   /// all TrackAtVertex objects at current vertex will obtain
@@ -252,20 +260,21 @@ class AdaptiveMultiVertexFitter {
   /// in order to later faster estimate compatibilities of track
   /// with different vertices
   ///
-  /// @param vtx The vertex object
+  /// @param state The state object
+  /// @param vtx Index of the vertex
   /// @param vertexingOptions Vertexing options
   Result<void> prepareVertexForFit(
-      State& state, Vertex<InputTrack_t>* vtx,
+      State& state, size_t vtx,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Sets vertexCompatibility for all TrackAtVertex objects
   /// at current vertex
   ///
   /// @param state The state object
-  /// @param currentVtx Current vertex
+  /// @param currentVtx Index of the current vertex
   /// @param vertexingOptions Vertexing options
   Result<void> setAllVertexCompatibilities(
-      State& state, Vertex<InputTrack_t>* currentVtx,
+      State& state, size_t currentVtx,
       const VertexingOptions<input_track_t>& vertexingOptions) const;
 
   /// @brief Sets weights to the track according to Eq.(5.46) in Ref.(1)
@@ -283,11 +292,11 @@ class AdaptiveMultiVertexFitter {
   /// these values in a vector
   ///
   /// @param state The state object
-  /// @param trk The track
+  /// @param trk Index of the track
   ///
   /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
-      State& state, const InputTrack_t* trk) const;
+  std::vector<double> collectTrackToVertexCompatibilities(State& state,
+                                                          size_t trk) const;
 
   /// @brief Determines if vertex position has shifted more than
   /// m_cfg.maxRelativeShift in last iteration
@@ -13,7 +13,7 @@
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fit(
-    State& state, const std::vector<Vertex<input_track_t>*>& verticesToFit,
+    State& state, const std::vector<size_t>& verticesToFit,
     const linearizer_t& linearizer,
     const VertexingOptions<input_track_t>& vertexingOptions) const {
   // Set all vertices to fit in the current state
@@ -53,8 +53,9 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
          (!state.annealingState.equilibriumReached || !isSmallShift)) {
     // Initial loop over all vertices in state.vertexCollection
 
-    for (auto currentVtx : state.vertexCollection) {
-      VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[currentVtx];
+    for (auto iVtx : state.vertexCollection) {
+      auto* currentVtx = &state.vtxInfoMap.vertex(iVtx);
+      VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[iVtx];
       currentVtxInfo.relinearize = false;
       // Store old position of vertex, i.e. seed position
       // in case of first iteration or position determined
@@ -68,17 +69,16 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
         // Relinearization needed, distance too big
         currentVtxInfo.relinearize = true;
         // Prepare for fit with new vertex position
-        prepareVertexForFit(state, currentVtx, vertexingOptions);
+        prepareVertexForFit(state, iVtx, vertexingOptions);
       }
       // Determine if constraint vertex exist
-      if (state.vtxInfoMap[currentVtx].constraintVertex.fullCovariance() !=
+      if (currentVtxInfo.constraintVertex.fullCovariance() !=
           SymMatrix4D::Zero()) {
         currentVtx->setFullPosition(
-            state.vtxInfoMap[currentVtx].constraintVertex.fullPosition());
-        currentVtx->setFitQuality(
-            state.vtxInfoMap[currentVtx].constraintVertex.fitQuality());
+            currentVtxInfo.constraintVertex.fullPosition());
+        currentVtx->setFitQuality(currentVtxInfo.constraintVertex.fitQuality());
         currentVtx->setFullCovariance(
-            state.vtxInfoMap[currentVtx].constraintVertex.fullCovariance());
+            currentVtxInfo.constraintVertex.fullCovariance());
       }
 
       else if (currentVtx->fullCovariance() == SymMatrix4D::Zero()) {
@@ -91,7 +91,7 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
 
       // Set vertexCompatibility for all TrackAtVertex objects
       // at current vertex
-      setAllVertexCompatibilities(state, currentVtx, vertexingOptions);
+      setAllVertexCompatibilities(state, iVtx, vertexingOptions);
     }  // End loop over vertex collection
 
     // Now after having estimated all compatibilities of all tracks at
@@ -118,42 +118,37 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
-    State& state, Vertex<input_track_t>& newVertex,
-    const linearizer_t& linearizer,
+    State& state, size_t newVertex, const linearizer_t& linearizer,
     const VertexingOptions<input_track_t>& vertexingOptions) const {
-  if (state.vtxInfoMap[&newVertex].trackLinks.empty()) {
+  if (state.vtxInfoMap[newVertex].trackLinks.empty()) {
     return VertexingError::EmptyInput;
   }
 
-  std::vector<Vertex<input_track_t>*> verticesToFit;
+  std::vector<size_t> verticesToFit;
 
   // Prepares vtx and tracks for fast estimation method of their
   // compatibility with vertex
-  auto res = prepareVertexForFit(state, &newVertex, vertexingOptions);
+  auto res = prepareVertexForFit(state, newVertex, vertexingOptions);
   if (!res.ok()) {
     return res.error();
   }
   // List of vertices added in last iteration
-  std::vector<Vertex<input_track_t>*> lastIterAddedVertices = {&newVertex};
+  std::vector<size_t> lastIterAddedVertices = {newVertex};
   // List of vertices added in current iteration
-  std::vector<Vertex<input_track_t>*> currentIterAddedVertices;
+  std::vector<size_t> currentIterAddedVertices;
 
   // Loop as long as new vertices are found that share tracks with
   // previously added vertices
   while (!lastIterAddedVertices.empty()) {
     for (auto& lastVtxIter : lastIterAddedVertices) {
       // Loop over all track at current lastVtxIter
-      const std::vector<const input_track_t*>& trks =
+      const std::vector<size_t>& trks =
           state.vtxInfoMap[lastVtxIter].trackLinks;
       for (const auto& trk : trks) {
-        // Retrieve list of links to all vertices that currently use the current
-        // track
-        auto range = state.trackToVerticesMultiMap.equal_range(trk);
-
-        // Loop over all attached vertices and add those to vertex fit
-        // which are not already in `verticesToFit`
-        for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-          auto newVtxIter = vtxIter->second;
+        // Loop over all vertices that currently use the current track
+        // and add those to vertex fit which are not already in
+        // `verticesToFit`
+        for (auto newVtxIter : state.trackToVertices[trk]) {
           if (!isAlreadyInList(newVtxIter, verticesToFit)) {
             // Add newVtxIter to verticesToFit
             verticesToFit.push_back(newVtxIter);
@@ -186,8 +181,7 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
 template <typename input_track_t, typename linearizer_t>
 bool Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     isAlreadyInList(
-        Vertex<input_track_t>* vtx,
-        const std::vector<Vertex<input_track_t>*>& verticesVec) const {
+        size_t vtx, const std::vector<size_t>& verticesVec) const {
   return std::find(verticesVec.begin(), verticesVec.end(), vtx) !=
          verticesVec.end();
 }
@@ -195,7 +189,7 @@ bool Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::prepareVertexForFit(
-        State& state, Vertex<input_track_t>* vtx,
+        State& state, size_t vtx,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   // The current vertex info object
   auto& currentVtxInfo = state.vtxInfoMap[vtx];
@@ -204,9 +198,15 @@ Acts::Result<void> Acts::
 
   // Loop over all tracks at current vertex
   for (const auto& trk : currentVtxInfo.trackLinks) {
+    // The seed position does not change during the fit, an existing
+    // estimate would not be replaced anyway
+    if (currentVtxInfo.ip3dParams.find(trk) !=
+        currentVtxInfo.ip3dParams.end()) {
+      continue;
+    }
     auto res = m_cfg.ipEst.estimate3DImpactParameters(
         vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_extractParameters(*trk), seedPos, state.ipState);
+        m_extractParameters(*state.tracks[trk]), seedPos, state.ipState);
     if (!res.ok()) {
       return res.error();
     }
@@ -220,22 +220,21 @@ template <typename input_track_t, typename linearizer_t>
 Acts::Result<void>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     setAllVertexCompatibilities(
-        State& state, Vertex<input_track_t>* currentVtx,
+        State& state, size_t currentVtx,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[currentVtx];
 
   // Loop over tracks at current vertex and
   // estimate compatibility with vertex
   for (const auto& trk : currentVtxInfo.trackLinks) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, currentVtx));
+    auto& trkAtVtx = state.tracksAtVerticesMap.at(trk, currentVtx);
     // Recover from cases where linearization point != 0 but
     // more tracks were added later on
     if (currentVtxInfo.ip3dParams.find(trk) ==
         currentVtxInfo.ip3dParams.end()) {
       auto res = m_cfg.ipEst.estimate3DImpactParameters(
           vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-          m_extractParameters(*trk),
+          m_extractParameters(*state.tracks[trk]),
           VectorHelpers::position(currentVtxInfo.linPoint), state.ipState);
       if (!res.ok()) {
         return res.error();
@@ -260,11 +259,12 @@ Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::setWeightsAndUpdate(
         State& state, const linearizer_t& linearizer,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
-  for (auto vtx : state.vertexCollection) {
-    VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[vtx];
+  for (auto iVtx : state.vertexCollection) {
+    auto* vtx = &state.vtxInfoMap.vertex(iVtx);
+    VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[iVtx];
 
     for (const auto& trk : currentVtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+      auto& trkAtVtx = state.tracksAtVerticesMap.at(trk, iVtx);
 
       // Set trackWeight for current track
       double currentTrkWeight = m_cfg.annealingTool.getWeight(
@@ -276,16 +276,17 @@ Acts::Result<void> Acts::
         // Check if linearization state exists or need to be relinearized
         if (trkAtVtx.linearizedState.covarianceAtPCA ==
                 BoundSymMatrix::Zero() ||
-            state.vtxInfoMap[vtx].relinearize) {
+            currentVtxInfo.relinearize) {
           auto result = linearizer.linearizeTrack(
-              m_extractParameters(*trk), state.vtxInfoMap[vtx].oldPosition,
+              m_extractParameters(*state.tracks[trk]),
+              currentVtxInfo.oldPosition,
               vertexingOptions.geoContext, vertexingOptions.magFieldContext,
               state.linearizerState);
           if (!result.ok()) {
             return result.error();
           }
           trkAtVtx.linearizedState = *result;
-          state.vtxInfoMap[vtx].linPoint = state.vtxInfoMap[vtx].oldPosition;
+          currentVtxInfo.linPoint = currentVtxInfo.oldPosition;
         }
         // Update the vertex with the new track
         KalmanVertexUpdater::updateVertexWithTrack<input_track_t>(*vtx,
@@ -304,16 +305,13 @@ Acts::Result<void> Acts::
 template <typename input_track_t, typename linearizer_t>
 std::vector<double>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
-    collectTrackToVertexCompatibilities(State& state,
-                                        const input_track_t* trk) const {
+    collectTrackToVertexCompatibilities(State& state, size_t trk) const {
   std::vector<double> trkToVtxCompatibilities;
-  trkToVtxCompatibilities.reserve(state.vertexCollection.size());
-  auto range = state.trackToVerticesMultiMap.equal_range(trk);
+  trkToVtxCompatibilities.reserve(state.trackToVertices[trk].size());
 
-  for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
+  for (auto vtx : state.trackToVertices[trk]) {
     trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtxIter->second))
-            .vertexCompatibility);
+        state.tracksAtVerticesMap.at(trk, vtx).vertexCompatibility);
   }
 
   return trkToVtxCompatibilities;
@@ -322,8 +320,9 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
 template <typename input_track_t, typename linearizer_t>
 bool Acts::AdaptiveMultiVertexFitter<
     input_track_t, linearizer_t>::checkSmallShift(State& state) const {
-  for (auto vtx : state.vertexCollection) {
-    Vector3D diff = state.vtxInfoMap[vtx].oldPosition.template head<3>() -
+  for (auto iVtx : state.vertexCollection) {
+    const auto* vtx = &state.vtxInfoMap.vertex(iVtx);
+    Vector3D diff = state.vtxInfoMap[iVtx].oldPosition.template head<3>() -
                     vtx->fullPosition().template head<3>();
     ActsSymMatrixD<3> vtxWgt =
         (vtx->fullCovariance().template block<3, 3>(0, 0)).inverse();
@@ -341,7 +340,7 @@ void Acts::AdaptiveMultiVertexFitter<
   for (const auto vtx : state.vertexCollection) {
     for (const auto trk : state.vtxInfoMap[vtx].trackLinks) {
       KalmanVertexTrackUpdater::update<input_track_t>(
-          state.tracksAtVerticesMap.at(std::make_pair(trk, vtx)), *vtx);
+          state.tracksAtVerticesMap.at(trk, vtx), state.vtxInfoMap.vertex(vtx));
     }
   }
 }
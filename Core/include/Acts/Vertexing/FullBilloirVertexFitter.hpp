@@ -12,9 +12,13 @@
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
 #include "Acts/Vertexing/LinearizerConcept.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <vector>
+
 namespace Acts {
 
 /// @class FullBilloirVertexFitter
@@ -28,6 +32,11 @@ namespace Acts {
 /// In: Nucl. Instrum. Methods Phys. Res., A 311 (1992) 139-150
 /// DOI 10.1016/0168-9002(92)90859-3
 ///
+/// The per-track momentum weights and the vertex weight are inverted with a
+/// Cholesky decomposition. A fit fails with VertexingError::NumericFailure
+/// if one of them is not positive definite, e.g. for tracks with a
+/// covariance that is not positive definite.
+///
 /// @tparam input_track_t Track object type
 /// @tparam linearizer_t Track linearizer type
 template <typename input_track_t, typename linearizer_t>
@@ -41,6 +50,29 @@ class FullBilloirVertexFitter {
   using BField_t = typename linearizer_t::BField_t;
   using Linearizer_t = linearizer_t;
 
+  /// @struct BilloirTrack
+  ///
+  /// @brief Fixed-size block of track-specific matrix operations
+  struct BilloirTrack {
+    const input_track_t* originalTrack = nullptr;
+    LinearizedTrack linTrack;
+    double chi2 = 0.;
+    ActsMatrix<BoundScalar, eBoundSize, 4> DiMat;  // position jacobian
+    ActsMatrixD<eBoundSize, 3> EiMat;              // momentum jacobian
+    ActsSymMatrixD<3> CiMat;   //  = EtWmat * Emat (see below)
+    ActsMatrixD<4, 3> BiMat;   //  = DiMat^T * Wi * EiMat
+    ActsSymMatrixD<3> CiInv;   //  = (EiMat^T * Wi * EiMat)^-1
+    Vector3D UiVec;            //  = EiMat^T * Wi * dqi
+    ActsMatrixD<4, 3> BCiMat;  //  = BiMat * Ci^-1
+    BoundVector deltaQ;
+    // Current estimate of (phi, theta, q/p) at the vertex
+    Vector3D momentum;
+    // Refitted momentum, covariance and chi2 of the best iteration
+    Vector3D fittedMomentum;
+    BoundSymMatrix fittedCovariance;
+    double fittedChi2 = 0.;
+  };
+
   struct State {
     /// @brief The state constructor
     ///
@@ -48,6 +80,8 @@ class FullBilloirVertexFitter {
     State(const Acts::MagneticFieldContext& mctx) : linearizerState(mctx) {}
     /// The linearizer state
     typename Linearizer_t::State linearizerState;
+    /// Per-track blocks, reused across iterations and fits
+    std::vector<BilloirTrack> billoirTracks;
   };
 
   struct Config {
@@ -82,7 +116,8 @@ class FullBilloirVertexFitter {
   /// @param vertexingOptions Vertexing options
   /// @param state The state object
   ///
-  /// @return Fitted vertex
+  /// @return Fitted vertex, or VertexingError::NumericFailure if the
+  /// weight matrices are not positive definite
   Result<Vertex<input_track_t>> fit(
       const std::vector<const input_track_t*>& paramVector,
       const linearizer_t& linearizer,
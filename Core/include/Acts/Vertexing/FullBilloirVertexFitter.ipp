@@ -14,31 +14,6 @@
 
 namespace {
 
-/// @struct BilloirTrack
-///
-/// @brief Struct to cache track-specific matrix operations in Billoir fitter
-template <typename input_track_t>
-struct BilloirTrack {
-  using Jacobian = Acts::ActsMatrix<Acts::BoundScalar, Acts::eBoundSize, 4>;
-
-  BilloirTrack(const input_track_t* params, Acts::LinearizedTrack lTrack)
-      : originalTrack(params), linTrack(std::move(lTrack)) {}
-
-  BilloirTrack(const BilloirTrack& arg) = default;
-
-  const input_track_t* originalTrack;
-  Acts::LinearizedTrack linTrack;
-  double chi2;
-  Jacobian DiMat;                                // position jacobian
-  Acts::ActsMatrixD<Acts::eBoundSize, 3> EiMat;  // momentum jacobian
-  Acts::ActsSymMatrixD<3> CiMat;                 //  = EtWmat * Emat (see below)
-  Acts::ActsMatrixD<4, 3> BiMat;                 //  = DiMat^T * Wi * EiMat
-  Acts::ActsSymMatrixD<3> CiInv;                 //  = (EiMat^T * Wi * EiMat)^-1
-  Acts::Vector3D UiVec;                          //  = EiMat^T * Wi * dqi
-  Acts::ActsMatrixD<4, 3> BCiMat;                //  = BiMat * Ci^-1
-  Acts::BoundVector deltaQ;
-};
-
 /// @struct BilloirVertex
 ///
 /// @brief Struct to cache vertex-specific matrix operations in Billoir fitter
@@ -80,107 +55,95 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
   // Determine if we do contraint fit or not by checking if an
   // invertible non-zero constraint vertex covariance is given
   bool isConstraintFit = false;
+  SymMatrix4D constraintWeight = SymMatrix4D::Zero();
   if (vertexingOptions.vertexConstraint.covariance().determinant() != 0) {
     isConstraintFit = true;
     ndf += 3;
+    constraintWeight =
+        vertexingOptions.vertexConstraint.fullCovariance().inverse();
   }
 
-  std::vector<BilloirTrack<input_track_t>> billoirTracks;
-
-  std::vector<Vector3D> trackMomenta;
+  // The per-track blocks only reallocate if the state has never seen
+  // this many tracks before
+  auto& billoirTracks = state.billoirTracks;
+  billoirTracks.resize(nTracks);
+  for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack) {
+    auto& bTrack = billoirTracks[iTrack];
+    bTrack.originalTrack = paramVector[iTrack];
+    const auto& params = extractParameters(*paramVector[iTrack]).parameters();
+    bTrack.momentum << params[eBoundPhi], params[eBoundTheta],
+        params[eBoundQOverP];
+  }
 
   Vector4D linPoint(vertexingOptions.vertexConstraint.fullPosition());
 
   Vertex<input_track_t> fittedVertex;
+  // The fitted track blocks are only valid once an iteration was accepted
+  bool hasFittedTracks = false;
 
   for (int nIter = 0; nIter < m_cfg.maxIterations; ++nIter) {
-    billoirTracks.clear();
-
     newChi2 = 0;
 
     BilloirVertex billoirVertex;
-    int iTrack = 0;
     // iterate over all tracks
-    for (const input_track_t* trackContainer : paramVector) {
-      const auto& trackParams = extractParameters(*trackContainer);
-      if (nIter == 0) {
-        double phi = trackParams.parameters()[BoundIndices::eBoundPhi];
-        double theta = trackParams.parameters()[BoundIndices::eBoundTheta];
-        double qop = trackParams.parameters()[BoundIndices::eBoundQOverP];
-        trackMomenta.push_back(Vector3D(phi, theta, qop));
-      }
-
+    for (auto& bTrack : billoirTracks) {
       auto result = linearizer.linearizeTrack(
-          trackParams, linPoint, vertexingOptions.geoContext,
-          vertexingOptions.magFieldContext, state.linearizerState);
-      if (result.ok()) {
-        const auto& linTrack = *result;
-        const auto& parametersAtPCA = linTrack.parametersAtPCA;
-        double d0 = parametersAtPCA[BoundIndices::eBoundLoc0];
-        double z0 = parametersAtPCA[BoundIndices::eBoundLoc1];
-        double phi = parametersAtPCA[BoundIndices::eBoundPhi];
-        double theta = parametersAtPCA[BoundIndices::eBoundTheta];
-        double qOverP = parametersAtPCA[BoundIndices::eBoundQOverP];
-
-        // calculate f(V_0,p_0)  f_d0 = f_z0 = 0
-        double fPhi = trackMomenta[iTrack][0];
-        double fTheta = trackMomenta[iTrack][1];
-        double fQOvP = trackMomenta[iTrack][2];
-        BilloirTrack<input_track_t> currentBilloirTrack(trackContainer,
-                                                        linTrack);
-
-        currentBilloirTrack.deltaQ << d0, z0, phi - fPhi, theta - fTheta,
-            qOverP - fQOvP, 0;
-
-        // position jacobian (D matrix)
-        ActsMatrix<BoundScalar, eBoundSize, 4> Dmat;
-        Dmat = linTrack.positionJacobian;
-
-        // momentum jacobian (E matrix)
-        ActsMatrixD<eBoundSize, 3> Emat;
-        Emat = linTrack.momentumJacobian;
-        // cache some matrix multiplications
-        ActsMatrixD<4, eBoundSize> DtWmat;
-        ActsMatrixD<3, eBoundSize> EtWmat;
-        BoundSymMatrix Wi = linTrack.weightAtPCA;
-
-        DtWmat = Dmat.transpose() * Wi;
-        EtWmat = Emat.transpose() * Wi;
-
-        // compute billoir tracks
-        currentBilloirTrack.DiMat = Dmat;
-        currentBilloirTrack.EiMat = Emat;
-        currentBilloirTrack.CiMat = EtWmat * Emat;
-        currentBilloirTrack.BiMat = DtWmat * Emat;  // DiMat^T * Wi * EiMat
-        currentBilloirTrack.UiVec =
-            EtWmat * currentBilloirTrack.deltaQ;  // EiMat^T * Wi * dqi
-        currentBilloirTrack.CiInv =
-            (EtWmat * Emat).inverse();  // (EiMat^T * Wi * EiMat)^-1
-
-        // sum up over all tracks
-        billoirVertex.Tvec +=
-            DtWmat * currentBilloirTrack.deltaQ;  // sum{DiMat^T * Wi * dqi}
-        billoirVertex.Amat += DtWmat * Dmat;      // sum{DiMat^T * Wi * DiMat}
-
-        // remember those results for all tracks
-        currentBilloirTrack.BCiMat =
-            currentBilloirTrack.BiMat *
-            currentBilloirTrack.CiInv;  // BCi = BiMat * Ci^-1
-
-        // and some summed results
-        billoirVertex.BCUvec +=
-            currentBilloirTrack.BCiMat *
-            currentBilloirTrack.UiVec;  // sum{BiMat * Ci^-1 * UiVec}
-        billoirVertex.BCBmat +=
-            currentBilloirTrack.BCiMat *
-            currentBilloirTrack.BiMat
-                .transpose();  // sum{BiMat * Ci^-1 * BiMat^T}
-
-        billoirTracks.push_back(currentBilloirTrack);
-        ++iTrack;
-      } else {
+          extractParameters(*bTrack.originalTrack), linPoint,
+          vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+          state.linearizerState);
+      if (!result.ok()) {
         return result.error();
       }
+      bTrack.linTrack = *result;
+      const auto& linTrack = bTrack.linTrack;
+      const auto& parametersAtPCA = linTrack.parametersAtPCA;
+      double d0 = parametersAtPCA[BoundIndices::eBoundLoc0];
+      double z0 = parametersAtPCA[BoundIndices::eBoundLoc1];
+      double phi = parametersAtPCA[BoundIndices::eBoundPhi];
+      double theta = parametersAtPCA[BoundIndices::eBoundTheta];
+      double qOverP = parametersAtPCA[BoundIndices::eBoundQOverP];
+
+      // calculate f(V_0,p_0)  f_d0 = f_z0 = 0
+      double fPhi = bTrack.momentum[0];
+      double fTheta = bTrack.momentum[1];
+      double fQOvP = bTrack.momentum[2];
+
+      bTrack.deltaQ << d0, z0, phi - fPhi, theta - fTheta, qOverP - fQOvP, 0;
+
+      // position jacobian (D matrix) and momentum jacobian (E matrix)
+      bTrack.DiMat = linTrack.positionJacobian;
+      bTrack.EiMat = linTrack.momentumJacobian;
+
+      // cache some matrix multiplications
+      const BoundSymMatrix& Wi = linTrack.weightAtPCA;
+      ActsMatrixD<4, eBoundSize> DtWmat = bTrack.DiMat.transpose() * Wi;
+      ActsMatrixD<3, eBoundSize> EtWmat = bTrack.EiMat.transpose() * Wi;
+
+      // compute billoir tracks
+      bTrack.CiMat = EtWmat * bTrack.EiMat;
+      bTrack.BiMat = DtWmat * bTrack.EiMat;  // DiMat^T * Wi * EiMat
+      bTrack.UiVec = EtWmat * bTrack.deltaQ;  // EiMat^T * Wi * dqi
+
+      // (EiMat^T * Wi * EiMat)^-1 of the positive definite Ci
+      Eigen::LLT<ActsSymMatrixD<3>> CiLLT(bTrack.CiMat);
+      if (CiLLT.info() != Eigen::Success) {
+        return VertexingError::NumericFailure;
+      }
+      bTrack.CiInv = CiLLT.solve(ActsSymMatrixD<3>::Identity());
+
+      // sum up over all tracks
+      billoirVertex.Tvec += DtWmat * bTrack.deltaQ;  // sum{DiMat^T*Wi*dqi}
+      billoirVertex.Amat += DtWmat * bTrack.DiMat;   // sum{DiMat^T*Wi*DiMat}
+
+      // remember those results for all tracks
+      bTrack.BCiMat = bTrack.BiMat * bTrack.CiInv;  // BCi = BiMat * Ci^-1
+
+      // and some summed results
+      billoirVertex.BCUvec +=
+          bTrack.BCiMat * bTrack.UiVec;  // sum{BiMat * Ci^-1 * UiVec}
+      billoirVertex.BCBmat +=
+          bTrack.BCiMat *
+          bTrack.BiMat.transpose();  // sum{BiMat * Ci^-1 * BiMat^T}
     }  // end loop tracks
 
     // calculate delta (billoirFrameOrigin-position), might be changed by the
@@ -195,82 +158,40 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
       Vector4D posInBilloirFrame =
           vertexingOptions.vertexConstraint.fullPosition() - linPoint;
 
-      Vdel += vertexingOptions.vertexConstraint.fullCovariance().inverse() *
-              posInBilloirFrame;
-      VwgtMat += vertexingOptions.vertexConstraint.fullCovariance().inverse();
+      Vdel += constraintWeight * posInBilloirFrame;
+      VwgtMat += constraintWeight;
     }
 
-    // cov(deltaV) = VwgtMat^-1
-    SymMatrix4D covDeltaVmat = VwgtMat.inverse();
+    // cov(deltaV) = VwgtMat^-1 of the positive definite weight matrix
+    Eigen::LLT<SymMatrix4D> VwgtLLT(VwgtMat);
+    if (VwgtLLT.info() != Eigen::Success) {
+      return VertexingError::NumericFailure;
+    }
+    SymMatrix4D covDeltaVmat = VwgtLLT.solve(SymMatrix4D::Identity());
     // deltaV = cov_(deltaV) * Vdel;
     Vector4D deltaV = covDeltaVmat * Vdel;
     //--------------------------------------------------------------------------------------
     // start momentum related calculations
 
-    std::vector<std::optional<BoundSymMatrix>> covDeltaPmat(nTracks);
-
-    iTrack = 0;
     for (auto& bTrack : billoirTracks) {
       Vector3D deltaP =
           (bTrack.CiInv) * (bTrack.UiVec - bTrack.BiMat.transpose() * deltaV);
 
       // update track momenta
-      trackMomenta[iTrack] += deltaP;
+      bTrack.momentum += deltaP;
 
       // correct for 2PI / PI periodicity
-      auto correctedPhiTheta = detail::ensureThetaBounds(
-          trackMomenta[iTrack][0], trackMomenta[iTrack][1]);
-
-      trackMomenta[iTrack][0] = correctedPhiTheta.first;
-      trackMomenta[iTrack][1] = correctedPhiTheta.second;
-
-      // calculate 5x5 covdelta_P matrix
-      // d(d0,z0,phi,theta,qOverP, t)/d(x,y,z,phi,theta,qOverP,
-      // t)-transformation matrix
-      ActsMatrixD<eBoundSize, 7> transMat;
-      transMat.setZero();
-      transMat(0, 0) = bTrack.DiMat(0, 0);
-      transMat(0, 1) = bTrack.DiMat(0, 1);
-      transMat(1, 0) = bTrack.DiMat(1, 0);
-      transMat(1, 1) = bTrack.DiMat(1, 1);
-      transMat(1, 2) = 1.;
-      transMat(2, 3) = 1.;
-      transMat(3, 4) = 1.;
-      transMat(4, 5) = 1.;
-      transMat(5, 6) = 1.;
-
-      // some intermediate calculations to get 5x5 matrix
-      // cov(V,V), 4x4 matrix
-      SymMatrix4D VVmat = covDeltaVmat;
-
-      // cov(V,P)
-      ActsMatrixD<4, 3> VPmat = bTrack.BiMat;
-
-      // cov(P,P), 3x3 matrix
-      ActsSymMatrixD<3> PPmat;
-      PPmat = bTrack.CiInv +
-              bTrack.BCiMat.transpose() * covDeltaVmat * bTrack.BCiMat;
-
-      ActsSymMatrixD<7> covMat;
-      covMat.setZero();
-      covMat.block<4, 4>(0, 0) = VVmat;
-      covMat.block<4, 3>(0, 4) = VPmat;
-      covMat.block<3, 4>(4, 0) = VPmat.transpose();
-
-      covMat.block<3, 3>(4, 4) = PPmat;
-
-      // covdelta_P calculation
-      covDeltaPmat[iTrack] = transMat * covMat * transMat.transpose();
+      auto correctedPhiTheta =
+          detail::ensureThetaBounds(bTrack.momentum[0], bTrack.momentum[1]);
+
+      bTrack.momentum[0] = correctedPhiTheta.first;
+      bTrack.momentum[1] = correctedPhiTheta.second;
+
       // Calculate chi2 per track.
-      bTrack.chi2 =
-          ((bTrack.deltaQ - bTrack.DiMat * deltaV - bTrack.EiMat * deltaP)
-               .transpose())
-              .dot(bTrack.linTrack.weightAtPCA *
-                   (bTrack.deltaQ - bTrack.DiMat * deltaV -
-                    bTrack.EiMat * deltaP));
+      BoundVector residual =
+          bTrack.deltaQ - bTrack.DiMat * deltaV - bTrack.EiMat * deltaP;
+      bTrack.chi2 = residual.dot(bTrack.linTrack.weightAtPCA * residual);
       newChi2 += bTrack.chi2;
-
-      ++iTrack;
     }
 
     if (isConstraintFit) {
@@ -282,11 +203,7 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
           deltaV -
           (vertexingOptions.vertexConstraint.fullPosition() - linPoint);
 
-      newChi2 +=
-          (deltaTrk.transpose())
-              .dot(
-                  vertexingOptions.vertexConstraint.fullCovariance().inverse() *
-                  deltaTrk);
+      newChi2 += deltaTrk.dot(constraintWeight * deltaTrk);
     }
 
     if (!std::isnormal(newChi2)) {
@@ -298,34 +215,77 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
     if (newChi2 < chi2) {
       chi2 = newChi2;
 
-      Vector4D vertexPos(linPoint);
-
-      fittedVertex.setFullPosition(vertexPos);
+      fittedVertex.setFullPosition(linPoint);
       fittedVertex.setFullCovariance(covDeltaVmat);
       fittedVertex.setFitQuality(chi2, ndf);
+      hasFittedTracks = true;
 
-      std::vector<TrackAtVertex<input_track_t>> tracksAtVertex;
-
-      std::shared_ptr<PerigeeSurface> perigee =
-          Surface::makeShared<PerigeeSurface>(
-              VectorHelpers::position(vertexPos));
-
-      iTrack = 0;
       for (auto& bTrack : billoirTracks) {
-        // new refitted trackparameters
-        BoundVector paramVec = BoundVector::Zero();
-        paramVec[eBoundPhi] = trackMomenta[iTrack](0);
-        paramVec[eBoundTheta] = trackMomenta[iTrack](1);
-        paramVec[eBoundQOverP] = trackMomenta[iTrack](2);
-        BoundTrackParameters refittedParams(perigee, paramVec,
-                                            covDeltaPmat[iTrack]);
-        TrackAtVertex<input_track_t> trackVx(bTrack.chi2, refittedParams,
-                                             bTrack.originalTrack);
-        tracksAtVertex.push_back(std::move(trackVx));
-        ++iTrack;
+        // calculate 5x5 covdelta_P matrix
+        // d(d0,z0,phi,theta,qOverP, t)/d(x,y,z,phi,theta,qOverP,
+        // t)-transformation matrix
+        ActsMatrixD<eBoundSize, 7> transMat;
+        transMat.setZero();
+        transMat(0, 0) = bTrack.DiMat(0, 0);
+        transMat(0, 1) = bTrack.DiMat(0, 1);
+        transMat(1, 0) = bTrack.DiMat(1, 0);
+        transMat(1, 1) = bTrack.DiMat(1, 1);
+        transMat(1, 2) = 1.;
+        transMat(2, 3) = 1.;
+        transMat(3, 4) = 1.;
+        transMat(4, 5) = 1.;
+        transMat(5, 6) = 1.;
+
+        // some intermediate calculations to get 5x5 matrix
+        // cov(V,V), 4x4 matrix
+        const SymMatrix4D& VVmat = covDeltaVmat;
+
+        // cov(V,P)
+        const ActsMatrixD<4, 3>& VPmat = bTrack.BiMat;
+
+        // cov(P,P), 3x3 matrix
+        ActsSymMatrixD<3> PPmat =
+            bTrack.CiInv +
+            bTrack.BCiMat.transpose() * covDeltaVmat * bTrack.BCiMat;
+
+        ActsSymMatrixD<7> covMat;
+        covMat.setZero();
+        covMat.block<4, 4>(0, 0) = VVmat;
+        covMat.block<4, 3>(0, 4) = VPmat;
+        covMat.block<3, 4>(4, 0) = VPmat.transpose();
+
+        covMat.block<3, 3>(4, 4) = PPmat;
+
+        // covdelta_P calculation
+        bTrack.fittedCovariance = transMat * covMat * transMat.transpose();
+        bTrack.fittedMomentum = bTrack.momentum;
+        bTrack.fittedChi2 = bTrack.chi2;
       }
-      fittedVertex.setTracksAtVertex(tracksAtVertex);
     }
   }  // end loop iterations
+
+  if (not hasFittedTracks) {
+    return fittedVertex;
+  }
+
+  // Refitted track parameters of the best iteration
+  std::vector<TrackAtVertex<input_track_t>> tracksAtVertex;
+  tracksAtVertex.reserve(nTracks);
+
+  std::shared_ptr<PerigeeSurface> perigee =
+      Surface::makeShared<PerigeeSurface>(fittedVertex.position());
+
+  for (const auto& bTrack : billoirTracks) {
+    BoundVector paramVec = BoundVector::Zero();
+    paramVec[eBoundPhi] = bTrack.fittedMomentum(0);
+    paramVec[eBoundTheta] = bTrack.fittedMomentum(1);
+    paramVec[eBoundQOverP] = bTrack.fittedMomentum(2);
+    BoundTrackParameters refittedParams(perigee, paramVec,
+                                        bTrack.fittedCovariance);
+    tracksAtVertex.emplace_back(bTrack.fittedChi2, refittedParams,
+                                bTrack.originalTrack);
+  }
+  fittedVertex.setTracksAtVertex(std::move(tracksAtVertex));
+
   return fittedVertex;
 }
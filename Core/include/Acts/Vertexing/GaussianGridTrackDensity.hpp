@@ -11,6 +11,8 @@
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
+
 namespace Acts {
 /// @class GaussianGridTrackDensity
 /// @brief Implements a 1-dim density grid to be filled with
@@ -21,6 +23,10 @@ namespace Acts {
 /// The position of the highest track density (of either a single
 /// bin or the sum of a certain region) can be determined.
 /// Single tracks can be cached and removed from the overall density.
+/// The maximum density can optionally be tracked incrementally in blocks
+/// of the main grid, see BlockMaxima, such that adding or removing a
+/// track does not require a rescan of the full grid. This allows large
+/// grids, e.g. 0.1 mm bins over +-300 mm, to be used.
 ///
 /// @tparam mainGridSize The size of the z-axis 1-dim main density grid
 /// @tparam trkGridSize The 2(!)-dim grid size of a single track, i.e.
@@ -63,6 +69,46 @@ class GaussianGridTrackDensity {
     float maxRelativeDensityDev = 0.01;
   };
 
+  /// Number of main grid bins summarised by one block maximum
+  static constexpr int s_blockSize = 64;
+  /// Number of blocks covering the main grid
+  static constexpr int s_nBlocks =
+      (mainGridSize + s_blockSize - 1) / s_blockSize;
+
+  /// @struct BlockMaxima
+  /// @brief The maximum density and its bin for every block of
+  /// s_blockSize bins of the main grid.
+  ///
+  /// Adding or removing a track only changes the blocks covered by its
+  /// track grid, which are rescanned. The global maximum is then found
+  /// from the block maxima alone. The first bin is taken in case of
+  /// equal densities, as for a full scan of the main grid.
+  struct BlockMaxima {
+    /// Constructor for an empty main grid
+    BlockMaxima() {
+      values.fill(0.f);
+      for (int b = 0; b < s_nBlocks; b++) {
+        bins[b] = b * s_blockSize;
+      }
+    }
+
+    /// The highest density of every block
+    std::array<float, s_nBlocks> values;
+    /// The main grid bin of the highest density of every block
+    std::array<int, s_nBlocks> bins;
+
+    /// The block containing the highest density
+    int maxBlock() const {
+      int block = 0;
+      for (int b = 1; b < s_nBlocks; b++) {
+        if (values[b] > values[block]) {
+          block = b;
+        }
+      }
+      return block;
+    }
+  };
+
   GaussianGridTrackDensity(const Config& cfg) : m_cfg(cfg) {}
 
   /// @brief Returns the z position of maximum track density
@@ -81,6 +127,29 @@ class GaussianGridTrackDensity {
   Result<std::pair<float, float>> getMaxZPositionAndWidth(
       ActsVectorF<mainGridSize>& mainGrid) const;
 
+  /// @brief Returns the z position of maximum track density, using the
+  /// incrementally updated block maxima instead of a full grid scan
+  ///
+  /// @note The full grid is scanned if useHighestSumZPosition is set.
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxima The block maxima of the main grid
+  ///
+  /// @return The z position of maximum track density, or an error if
+  /// there is no positive density
+  Result<float> getMaxZPosition(ActsVectorF<mainGridSize>& mainGrid,
+                                const BlockMaxima& maxima) const;
+
+  /// @brief Returns the z position of maximum track density and
+  /// the estimated width, using the incrementally updated block maxima
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxima The block maxima of the main grid
+  ///
+  /// @return The z position of maximum track density and width
+  Result<std::pair<float, float>> getMaxZPositionAndWidth(
+      ActsVectorF<mainGridSize>& mainGrid, const BlockMaxima& maxima) const;
+
   /// @brief Adds a single track to the overall grid density
   ///
   /// @param trk The track to be added
@@ -103,6 +172,31 @@ class GaussianGridTrackDensity {
                                    const ActsVectorF<trkGridSize>& trkGrid,
                                    ActsVectorF<mainGridSize>& mainGrid) const;
 
+  /// @brief Adds a single track to the overall grid density and updates
+  /// the block maxima
+  ///
+  /// @param trk The track to be added
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxima The block maxima of the main grid
+  ///
+  /// @return See addTrack without block maxima
+  std::pair<int, ActsVectorF<trkGridSize>> addTrack(
+      const BoundTrackParameters& trk, ActsVectorF<mainGridSize>& mainGrid,
+      BlockMaxima& maxima) const;
+
+  /// @brief Removes a track from the overall grid density and updates
+  /// the block maxima
+  ///
+  /// @param zBin The center z-bin position the track needs to be
+  /// removed from
+  /// @param trkGrid The 1-dim density contribution of the track
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxima The block maxima of the main grid
+  void removeTrackGridFromMainGrid(int zBin,
+                                   const ActsVectorF<trkGridSize>& trkGrid,
+                                   ActsVectorF<mainGridSize>& mainGrid,
+                                   BlockMaxima& maxima) const;
+
  private:
   /// @brief Helper function that acutally adds the track to the
   /// main density grid
@@ -126,6 +220,14 @@ class GaussianGridTrackDensity {
                                    ActsVectorF<mainGridSize>& mainGrid,
                                    int modifyModeSign) const;
 
+  /// @brief Rescans the blocks covered by a track grid
+  ///
+  /// @param zBin The center z-bin position of the track
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxima The block maxima to be updated
+  void updateBlockMaxima(int zBin, const ActsVectorF<mainGridSize>& mainGrid,
+                         BlockMaxima& maxima) const;
+
   /// @brief Function that creates a 1-dim track grid (i.e. a vector)
   /// with the correct density contribution of a track along the z-axis
   ///
@@ -150,9 +252,6 @@ class GaussianGridTrackDensity {
   Result<float> estimateSeedWidth(ActsVectorF<mainGridSize>& mainGrid,
                                   float maxZ) const;
 
-  /// @brief Helper to retrieve values according to a 2-dim normal distribution
-  float normal2D(float d, float z, const SymMatrix2D& cov) const;
-
   /// @brief Checks the (up to) first three density maxima (only those that have
   /// a maximum relative deviation of 'relativeDensityDev' from the main
   /// maximum) and take the z-bin of the maximum with the highest surrounding
@@ -52,6 +52,84 @@ Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::
   return returnPair;
 }
 
+template <int mainGridSize, int trkGridSize>
+Acts::Result<float>
+Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::getMaxZPosition(
+    Acts::ActsVectorF<mainGridSize>& mainGrid,
+    const BlockMaxima& maxima) const {
+  int block = maxima.maxBlock();
+  if (not(maxima.values[block] > 0)) {
+    return VertexingError::EmptyInput;
+  }
+  if (m_cfg.useHighestSumZPosition) {
+    return getMaxZPosition(mainGrid);
+  }
+  int zbin = maxima.bins[block];
+
+  // Derive corresponding z value
+  return (zbin - mainGridSize / 2 + 0.5f) * m_cfg.binSize;
+}
+
+template <int mainGridSize, int trkGridSize>
+Acts::Result<std::pair<float, float>>
+Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::
+    getMaxZPositionAndWidth(Acts::ActsVectorF<mainGridSize>& mainGrid,
+                            const BlockMaxima& maxima) const {
+  // Get z maximum value
+  auto maxZRes = getMaxZPosition(mainGrid, maxima);
+  if (not maxZRes.ok()) {
+    return maxZRes.error();
+  }
+  float maxZ = *maxZRes;
+
+  // Get seed width estimate
+  auto widthRes = estimateSeedWidth(mainGrid, maxZ);
+  if (not widthRes.ok()) {
+    return widthRes.error();
+  }
+  float width = *widthRes;
+  std::pair<float, float> returnPair{maxZ, width};
+  return returnPair;
+}
+
+template <int mainGridSize, int trkGridSize>
+std::pair<int, Acts::ActsVectorF<trkGridSize>>
+Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::addTrack(
+    const Acts::BoundTrackParameters& trk,
+    Acts::ActsVectorF<mainGridSize>& mainGrid, BlockMaxima& maxima) const {
+  auto binAndTrackGrid = addTrack(trk, mainGrid);
+  if (binAndTrackGrid.first >= 0) {
+    updateBlockMaxima(binAndTrackGrid.first, mainGrid, maxima);
+  }
+  return binAndTrackGrid;
+}
+
+template <int mainGridSize, int trkGridSize>
+void Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::
+    removeTrackGridFromMainGrid(int zBin,
+                                const Acts::ActsVectorF<trkGridSize>& trkGrid,
+                                Acts::ActsVectorF<mainGridSize>& mainGrid,
+                                BlockMaxima& maxima) const {
+  removeTrackGridFromMainGrid(zBin, trkGrid, mainGrid);
+  updateBlockMaxima(zBin, mainGrid, maxima);
+}
+
+template <int mainGridSize, int trkGridSize>
+void Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::
+    updateBlockMaxima(int zBin, const Acts::ActsVectorF<mainGridSize>& mainGrid,
+                      BlockMaxima& maxima) const {
+  int width = (trkGridSize - 1) / 2;
+  int firstBlock = std::max(zBin - width, 0) / s_blockSize;
+  int lastBlock = std::min(zBin + width, mainGridSize - 1) / s_blockSize;
+  for (int b = firstBlock; b <= lastBlock; b++) {
+    int start = b * s_blockSize;
+    int size = std::min(s_blockSize, mainGridSize - start);
+    int bin = 0;
+    maxima.values[b] = mainGrid.segment(start, size).maxCoeff(&bin);
+    maxima.bins[b] = start + bin;
+  }
+}
+
 template <int mainGridSize, int trkGridSize>
 std::pair<int, Acts::ActsVectorF<trkGridSize>>
 Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::addTrack(
@@ -143,17 +221,28 @@ Acts::ActsVectorF<trkGridSize>
 Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::createTrackGrid(
     int offset, const Acts::SymMatrix2D& cov, float distCtrD,
     float distCtrZ) const {
-  ActsVectorF<trkGridSize> trackGrid(ActsVectorF<trkGridSize>::Zero());
+  using ArrayF = Eigen::Array<float, trkGridSize, 1>;
 
   int i = (trkGridSize - 1) / 2 + offset;
-  float d = (i - static_cast<float>(trkGridSize) / 2 + 0.5f) * m_cfg.binSize;
+  float d = (i - static_cast<float>(trkGridSize) / 2 + 0.5f) * m_cfg.binSize +
+            distCtrD;
 
-  // Loop over columns
-  for (int j = 0; j < trkGridSize; j++) {
-    float z = (j - static_cast<float>(trkGridSize) / 2 + 0.5f) * m_cfg.binSize;
-    trackGrid(j) = normal2D(d + distCtrD, z + distCtrZ, cov);
-  }
-  return trackGrid;
+  // The z distances of all columns to the track, evaluated at once such
+  // that the exponential is computed on full SIMD registers
+  ArrayF z = (ArrayF::LinSpaced(trkGridSize, 0, trkGridSize - 1) -
+              static_cast<float>(trkGridSize) / 2 + 0.5f) *
+                 m_cfg.binSize +
+             distCtrZ;
+
+  // 2-dim normal distribution, with the d-dependent terms hoisted
+  float det = cov.determinant();
+  float coef = 1 / (2 * M_PI * std::sqrt(det));
+  float cDD = cov(1, 1) * d * d;
+  float cDZ = d * (cov(0, 1) + cov(1, 0));
+  float cZZ = cov(0, 0);
+  ArrayF expo = (-1 / (2 * det)) * (cDD - cDZ * z + cZZ * z.square());
+
+  return (coef * expo.exp()).matrix();
 }
 
 template <int mainGridSize, int trkGridSize>
@@ -164,14 +253,15 @@ Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::estimateSeedWidth(
     return VertexingError::EmptyInput;
   }
   // Get z bin of max density z value
-  int zBin = int(maxZ / m_cfg.binSize + mainGridSize / 2.);
+  int zBin = std::clamp(int(maxZ / m_cfg.binSize + mainGridSize / 2.), 0,
+                        mainGridSize - 1);
 
   const float maxValue = mainGrid(zBin);
   float gridValue = mainGrid(zBin);
 
   // Find right half-maximum bin
   int rhmBin = zBin;
-  while (gridValue > maxValue / 2) {
+  while (gridValue > maxValue / 2 && rhmBin < mainGridSize - 2) {
     rhmBin += 1;
     gridValue = mainGrid(rhmBin);
   }
@@ -183,14 +273,18 @@ Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::estimateSeedWidth(
   // Find left half-maximum bin
   int lhmBin = zBin;
   gridValue = mainGrid(zBin);
-  while (gridValue > maxValue / 2) {
+  while (gridValue > maxValue / 2 && lhmBin > 0) {
     lhmBin -= 1;
     gridValue = mainGrid(lhmBin);
   }
 
-  // Use linear approximation to find better z value for FWHM between bins
-  float deltaZ2 = (maxValue / 2 - mainGrid(lhmBin + 1)) *
-                  (m_cfg.binSize / (mainGrid(rhmBin + 1) - mainGrid(rhmBin)));
+  // Use linear approximation to find better z value for FWHM between bins.
+  // For a maximum in the last bin, the slope is taken from the last two bins
+  // instead of reading past the end of the grid.
+  int slopeBin = std::min(rhmBin, mainGridSize - 2);
+  float deltaZ2 =
+      (maxValue / 2 - mainGrid(lhmBin + 1)) *
+      (m_cfg.binSize / (mainGrid(slopeBin + 1) - mainGrid(slopeBin)));
 
   // Approximate FWHM
   float fwhm =
@@ -202,17 +296,6 @@ Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::estimateSeedWidth(
   return std::isnormal(width) ? width : 0.0f;
 }
 
-template <int mainGridSize, int trkGridSize>
-float Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::normal2D(
-    float d, float z, const Acts::SymMatrix2D& cov) const {
-  float det = cov.determinant();
-  float coef = 1 / (2 * M_PI * std::sqrt(det));
-  float expo =
-      -1 / (2 * det) *
-      (cov(1, 1) * d * d - d * z * (cov(0, 1) + cov(1, 0)) + cov(0, 0) * z * z);
-  return coef * std::exp(expo);
-}
-
 template <int mainGridSize, int trkGridSize>
 int Acts::GaussianGridTrackDensity<mainGridSize, trkGridSize>::
     getHighestSumZPosition(Acts::ActsVectorF<mainGridSize>& mainGrid) const {
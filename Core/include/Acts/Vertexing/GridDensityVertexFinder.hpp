@@ -77,6 +77,8 @@ class GridDensityVertexFinder {
   struct State {
     // The main density grid
     ActsVectorF<mainGridSize> mainGrid = ActsVectorF<mainGridSize>::Zero();
+    // The maxima of the main density grid blocks, updated incrementally
+    typename GridDensity::BlockMaxima blockMaxima;
     // Map to store z-bin and track grid (i.e. the density contribution of
     // a single track to the main grid) for every single track
     std::map<const InputTrack_t*, std::pair<int, ActsVectorF<trkGridSize>>>
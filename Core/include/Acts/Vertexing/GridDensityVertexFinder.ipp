@@ -24,7 +24,8 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
       couldRemoveTracks = true;
       auto binAndTrackGrid = state.binAndTrackGridMap.at(trk);
       m_cfg.gridDensity.removeTrackGridFromMainGrid(
-          binAndTrackGrid.first, binAndTrackGrid.second, state.mainGrid);
+          binAndTrackGrid.first, binAndTrackGrid.second, state.mainGrid,
+          state.blockMaxima);
     }
     if (not couldRemoveTracks) {
       // No tracks were removed anymore
@@ -36,6 +37,7 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
     }
   } else {
     state.mainGrid = ActsVectorF<mainGridSize>::Zero();
+    state.blockMaxima = typename GridDensity::BlockMaxima();
     // Fill with track densities
     for (auto trk : trackVector) {
       const BoundTrackParameters& trkParams = m_extractParameters(*trk);
@@ -46,8 +48,8 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
         }
         continue;
       }
-      auto binAndTrackGrid =
-          m_cfg.gridDensity.addTrack(trkParams, state.mainGrid);
+      auto binAndTrackGrid = m_cfg.gridDensity.addTrack(
+          trkParams, state.mainGrid, state.blockMaxima);
       // Cache track density contribution to main grid if enabled
       if (m_cfg.cacheGridStateForTrackRemoval) {
         state.binAndTrackGridMap[trk] = binAndTrackGrid;
@@ -59,10 +61,12 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
 
   double z = 0;
   double width = 0;
-  if (state.mainGrid != ActsVectorF<mainGridSize>::Zero()) {
+  const auto& maxima = state.blockMaxima;
+  if (maxima.values[maxima.maxBlock()] > 0) {
     if (not m_cfg.estimateSeedWidth) {
       // Get z value of highest density bin
-      auto maxZres = m_cfg.gridDensity.getMaxZPosition(state.mainGrid);
+      auto maxZres =
+          m_cfg.gridDensity.getMaxZPosition(state.mainGrid, maxima);
 
       if (!maxZres.ok()) {
         return maxZres.error();
@@ -70,7 +74,8 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
       z = *maxZres;
     } else {
       // Get z value of highest density bin and width
-      auto maxZres = m_cfg.gridDensity.getMaxZPositionAndWidth(state.mainGrid);
+      auto maxZres =
+          m_cfg.gridDensity.getMaxZPositionAndWidth(state.mainGrid, maxima);
 
       if (!maxZres.ok()) {
         return maxZres.error();
@@ -14,10 +14,14 @@
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
+#include <optional>
+
 namespace Acts {
 
 /// @class HelicalTrackLinearizer
@@ -37,6 +41,12 @@ namespace Acts {
 ///
 /// Ref.(1) - CERN-THESIS-2010-027, Giacinto Piacquadio (Freiburg U.)
 ///
+/// The parameters at the perigee of the linearization point are obtained
+/// by propagation. Optionally, they can be computed analytically from the
+/// helix in the z component of the magnetic field at the track position,
+/// which avoids setting up the propagation for tracks close to the
+/// linearization point in a homogeneous (solenoid core) field.
+///
 /// @tparam propagator_t Propagator type
 /// @tparam propagator_options_t Propagator options type
 template <typename propagator_t,
@@ -82,6 +92,13 @@ class HelicalTrackLinearizer {
     double minQoP = 1e-15;
     // Maximum curvature value
     double maxRho = 1e+15;
+
+    // Transport the track parameters analytically along the helix to the
+    // perigee of the linearization point instead of propagating them
+    bool analyticalPerigee = false;
+    // Maximum distance between the track position and the linearization
+    // point for the analytical transport, the propagator is used beyond
+    double maxAnalyticalDistance = 1 * UnitConstants::m;
   };
 
   /// @brief Constructor
@@ -106,6 +123,41 @@ class HelicalTrackLinearizer {
                                          State& state) const;
 
  private:
+  /// @brief Perigee parameters of a helix w.r.t. a reference point and
+  /// their derivatives w.r.t. a point on the helix and its momentum
+  struct HelixPerigee {
+    /// The perigee parameters, Eq. 5.33 in Ref(1)
+    BoundVector parameters;
+    /// Derivatives w.r.t. the helix point, Eq. 5.36 in Ref(1)
+    ActsMatrix<BoundScalar, eBoundSize, 4> positionJacobian;
+    /// Derivatives w.r.t. (phi, theta, q/p), Eq. 5.37 in Ref(1)
+    ActsMatrixD<eBoundSize, 3> momentumJacobian;
+  };
+
+  /// @brief Evaluate the helix perigee parameters and their derivatives
+  ///
+  /// @param position The four-position of a point on the helix
+  /// @param momentum The (phi, theta, q/p) at that point
+  /// @param Bz The z component of the magnetic field
+  /// @param refPoint The reference point of the perigee
+  HelixPerigee helixPerigee(const Vector4D& position, const Vector3D& momentum,
+                            double Bz, const Vector3D& refPoint) const;
+
+  /// @brief Transport parameters analytically to the perigee surface
+  ///
+  /// @param params Parameters to transport
+  /// @param perigeeSurface The perigee surface at the linearization point
+  /// @param gctx The geometry context
+  /// @param mass The mass hypothesis of the propagator options
+  /// @param state The state object
+  ///
+  /// @return The parameters at the perigee surface, or no value if the
+  /// analytical transport is not applicable
+  std::optional<BoundTrackParameters> analyticalPerigeeParameters(
+      const BoundTrackParameters& params,
+      const std::shared_ptr<PerigeeSurface>& perigeeSurface,
+      const Acts::GeometryContext& gctx, double mass, State& state) const;
+
   /// Configuration object
   const Config m_cfg;
 };
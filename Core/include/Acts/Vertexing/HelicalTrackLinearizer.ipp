@@ -7,6 +7,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
 
 template <typename propagator_t, typename propagator_options_t>
 Acts::Result<Acts::LinearizedTrack> Acts::
@@ -24,14 +25,27 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   propagator_options_t pOptions(gctx, mctx, LoggerWrapper{*logger});
   pOptions.direction = backward;
 
-  const BoundTrackParameters* endParams = nullptr;
-  // Do the propagation to linPointPos
-  auto result = m_cfg.propagator->propagate(params, *perigeeSurface, pOptions);
-  if (result.ok()) {
-    endParams = (*result).endParameters.get();
+  // Try the analytical transport along the helix first, if configured
+  std::optional<BoundTrackParameters> analyticalParams = std::nullopt;
+  if (m_cfg.analyticalPerigee) {
+    analyticalParams = analyticalPerigeeParameters(
+        params, perigeeSurface, gctx, pOptions.mass, state);
+  }
 
+  const BoundTrackParameters* endParams = nullptr;
+  std::unique_ptr<const BoundTrackParameters> propagatedParams = nullptr;
+  if (analyticalParams) {
+    endParams = &(*analyticalParams);
   } else {
-    return result.error();
+    // Do the propagation to linPointPos
+    auto result =
+        m_cfg.propagator->propagate(params, *perigeeSurface, pOptions);
+    if (result.ok()) {
+      propagatedParams = std::move((*result).endParameters);
+      endParams = propagatedParams.get();
+    } else {
+      return result.error();
+    }
   }
 
   BoundVector paramsAtPCA = endParams->parameters();
@@ -55,25 +69,53 @@ Acts::Result<Acts::LinearizedTrack> Acts::
     parCovarianceAtPCA = *(params.covariance());
   }
 
+  Vector3D momentumAtPCA(paramsAtPCA(BoundIndices::eBoundPhi),
+                         paramsAtPCA(BoundIndices::eBoundTheta),
+                         paramsAtPCA(BoundIndices::eBoundQOverP));
+
+  // get B-field z-component at current position
+  double Bz = m_cfg.bField.getField(VectorHelpers::position(positionAtPCA),
+                                    state.fieldCache)[eZ];
+
+  HelixPerigee perigee =
+      helixPerigee(positionAtPCA, momentumAtPCA, Bz, linPointPos);
+
+  // const term F(V_0, p_0) in Talyor expansion
+  BoundVector constTerm = perigee.parameters -
+                          perigee.positionJacobian * positionAtPCA -
+                          perigee.momentumJacobian * momentumAtPCA;
+
+  // The parameter weight
+  ActsSymMatrixD<5> parWeight =
+      (parCovarianceAtPCA.block<5, 5>(0, 0)).inverse();
+
+  BoundSymMatrix weightAtPCA{BoundSymMatrix::Identity()};
+  weightAtPCA.block<5, 5>(0, 0) = parWeight;
+
+  return LinearizedTrack(paramsAtPCA, parCovarianceAtPCA, weightAtPCA, linPoint,
+                         perigee.positionJacobian, perigee.momentumJacobian,
+                         positionAtPCA, momentumAtPCA, constTerm);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+typename Acts::HelicalTrackLinearizer<propagator_t,
+                                      propagator_options_t>::HelixPerigee
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::helixPerigee(
+    const Vector4D& position, const Vector3D& momentum, double Bz,
+    const Vector3D& refPoint) const {
   // phiV and functions
-  double phiV = paramsAtPCA(BoundIndices::eBoundPhi);
+  double phiV = momentum[0];
   double sinPhiV = std::sin(phiV);
   double cosPhiV = std::cos(phiV);
 
   // theta and functions
-  double th = paramsAtPCA(BoundIndices::eBoundTheta);
+  double th = momentum[1];
   const double sinTh = std::sin(th);
   const double tanTh = std::tan(th);
 
   // q over p
-  double qOvP = paramsAtPCA(BoundIndices::eBoundQOverP);
-  double sgnH = (qOvP < 0.) ? -1 : 1;
+  double qOvP = momentum[2];
 
-  Vector3D momentumAtPCA(phiV, th, qOvP);
-
-  // get B-field z-component at current position
-  double Bz = m_cfg.bField.getField(VectorHelpers::position(positionAtPCA),
-                                    state.fieldCache)[eZ];
   double rho;
   // Curvature is infinite w/o b field
   if (Bz == 0. || std::abs(qOvP) < m_cfg.minQoP) {
@@ -81,17 +123,21 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   } else {
     rho = sinTh * (1. / qOvP) / Bz;
   }
+  // The sense of rotation of the helix
+  double sgnH = (rho < 0.) ? -1 : 1;
 
   // Eq. 5.34 in Ref(1) (see .hpp)
-  double X = positionAtPCA(0) - linPointPos.x() + rho * sinPhiV;
-  double Y = positionAtPCA(1) - linPointPos.y() - rho * cosPhiV;
+  double X = position(0) - refPoint.x() + rho * sinPhiV;
+  double Y = position(1) - refPoint.y() - rho * cosPhiV;
   const double S2 = (X * X + Y * Y);
   const double S = std::sqrt(S2);
 
+  HelixPerigee perigee;
+
   /// F(V, p_i) at PCA in Billoir paper
   /// (see FullBilloirVertexFitter.hpp for paper reference,
   /// Page 140, Eq. (2) )
-  BoundVector predParamsAtPCA;
+  BoundVector& predParamsAtPCA = perigee.parameters;
 
   int sgnX = (X < 0.) ? -1 : 1;
   int sgnY = (Y < 0.) ? -1 : 1;
@@ -105,18 +151,19 @@ Acts::Result<Acts::LinearizedTrack> Acts::
       phiAtPCA = sgnH * sgnX * M_PI - phiAtPCA;
     }
   }
+  // The turning angle between the helix point and the PCA
+  double dPhi = detail::radian_sym(phiAtPCA - phiV);
 
   // Eq. 5.33 in Ref(1) (see .hpp)
   predParamsAtPCA[0] = rho - sgnH * S;
-  predParamsAtPCA[1] =
-      positionAtPCA[eZ] - linPointPos.z() + rho * (phiV - phiAtPCA) / tanTh;
+  predParamsAtPCA[1] = position[eZ] - refPoint.z() - rho * dPhi / tanTh;
   predParamsAtPCA[2] = phiAtPCA;
   predParamsAtPCA[3] = th;
   predParamsAtPCA[4] = qOvP;
   predParamsAtPCA[5] = 0.;
 
   // Fill position jacobian (D_k matrix), Eq. 5.36 in Ref(1)
-  ActsMatrix<BoundScalar, eBoundSize, 4> positionJacobian;
+  auto& positionJacobian = perigee.positionJacobian;
   positionJacobian.setZero();
   // First row
   positionJacobian(0, 0) = -sgnH * X / S;
@@ -138,12 +185,11 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   positionJacobian(5, 3) = 1;
 
   // Fill momentum jacobian (E_k matrix), Eq. 5.37 in Ref(1)
-  ActsMatrixD<eBoundSize, 3> momentumJacobian;
+  auto& momentumJacobian = perigee.momentumJacobian;
   momentumJacobian.setZero();
 
   double R = X * cosPhiV + Y * sinPhiV;
   double Q = X * sinPhiV - Y * cosPhiV;
-  double dPhi = phiAtPCA - phiV;
 
   // First row
   momentumJacobian(0, 0) = -sgnH * rho * R / S;
@@ -169,18 +215,67 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   momentumJacobian(3, 1) = 1.;
   momentumJacobian(4, 2) = 1.;
 
-  // const term F(V_0, p_0) in Talyor expansion
-  BoundVector constTerm = predParamsAtPCA - positionJacobian * positionAtPCA -
-                          momentumJacobian * momentumAtPCA;
+  return perigee;
+}
 
-  // The parameter weight
-  ActsSymMatrixD<5> parWeight =
-      (parCovarianceAtPCA.block<5, 5>(0, 0)).inverse();
+template <typename propagator_t, typename propagator_options_t>
+std::optional<Acts::BoundTrackParameters>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    analyticalPerigeeParameters(
+        const BoundTrackParameters& params,
+        const std::shared_ptr<PerigeeSurface>& perigeeSurface,
+        const Acts::GeometryContext& gctx, double mass, State& state) const {
+  if (not params.covariance().has_value()) {
+    return std::nullopt;
+  }
+  const Vector3D refPoint = perigeeSurface->center(gctx);
+  const Vector4D position4 = params.fourPosition(gctx);
+  const Vector3D position = VectorHelpers::position(position4);
+  // Far away from the linearization point the field may not be homogeneous
+  if ((position - refPoint).norm() > m_cfg.maxAnalyticalDistance) {
+    return std::nullopt;
+  }
 
-  BoundSymMatrix weightAtPCA{BoundSymMatrix::Identity()};
-  weightAtPCA.block<5, 5>(0, 0) = parWeight;
+  const BoundVector pars = params.parameters();
+  const Vector3D momentum(pars[eBoundPhi], pars[eBoundTheta],
+                          pars[eBoundQOverP]);
+  // A straight line is left to the propagator
+  const double Bz = m_cfg.bField.getField(position, state.fieldCache)[eZ];
+  if (Bz == 0. or std::abs(momentum[2]) < m_cfg.minQoP) {
+    return std::nullopt;
+  }
 
-  return LinearizedTrack(paramsAtPCA, parCovarianceAtPCA, weightAtPCA, linPoint,
-                         positionJacobian, momentumJacobian, positionAtPCA,
-                         momentumAtPCA, constTerm);
+  HelixPerigee perigee = helixPerigee(position4, momentum, Bz, refPoint);
+
+  // The path length from the track position to the PCA, which changes the
+  // time with the mass hypothesis of the propagation
+  const double rho = std::sin(momentum[1]) / (momentum[2] * Bz);
+  const double dPhi = detail::radian_sym(perigee.parameters[eBoundPhi] -
+                                         momentum[0]);
+  const double pathLength = -rho * dPhi / std::sin(momentum[1]);
+  const double mOverP =
+      mass * momentum[2] / (params.charge() != 0. ? params.charge() : 1.);
+  BoundVector pcaParams = perigee.parameters;
+  pcaParams[eBoundTime] =
+      pars[eBoundTime] + pathLength * std::hypot(1., mOverP);
+
+  // Jacobian of the track position w.r.t. the bound parameters
+  BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+  params.referenceSurface().initJacobianToGlobal(
+      gctx, jacToGlobal, position, params.unitDirection(), pars);
+  // Jacobian of (phi, theta, q/p) w.r.t. the bound parameters
+  ActsMatrixD<3, eBoundSize> jacToMomentum =
+      ActsMatrixD<3, eBoundSize>::Zero();
+  jacToMomentum(0, eBoundPhi) = 1.;
+  jacToMomentum(1, eBoundTheta) = 1.;
+  jacToMomentum(2, eBoundQOverP) = 1.;
+  // Chain them with the helix derivatives
+  BoundMatrix jacobian =
+      perigee.positionJacobian * jacToGlobal.template topRows<4>() +
+      perigee.momentumJacobian * jacToMomentum;
+  BoundSymMatrix pcaCovariance =
+      jacobian * (*params.covariance()) * jacobian.transpose();
+
+  return BoundTrackParameters(perigeeSurface, pcaParams,
+                              std::move(pcaCovariance));
 }
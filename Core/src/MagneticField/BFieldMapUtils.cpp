@@ -97,33 +97,9 @@ Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
   }
   grid.setExteriorBins(Acts::Vector2D::Zero());
 
-  // [3] Create the transformation for the position
-  // map (x,y,z) -> (r,z)
-  auto transformPos = [](const Acts::Vector3D& pos) {
-    return Acts::Vector2D(perp(pos), pos.z());
-  };
-
-  // [4] Create the transformation for the bfield
-  // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2D& field,
-                            const Acts::Vector3D& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi, sin_phi;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3D(field.x() * cos_phi, field.x() * sin_phi, field.y());
-  };
-
-  // [5] Create the mapper & BField Service
+  // [3] Create the mapper & BField Service
   // create field mapping
-  return Acts::InterpolatedBFieldMapper<Grid_t>(transformPos, transformBField,
-                                                std::move(grid));
+  return fieldMapperRZ(std::move(grid));
 }
 
 Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
@@ -231,17 +207,71 @@ Acts::fieldMapperXYZ(
   }
   grid.setExteriorBins(Acts::Vector3D::Zero());
 
-  // [3] Create the transformation for the position
+  // [3] Create the mapper & BField Service
+  // create field mapping
+  return fieldMapperXYZ(std::move(grid));
+}
+
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+Acts::fieldMapperRZ(
+    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>
+        grid) {
+  using Grid_t =
+      Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                         Acts::detail::EquidistantAxis>;
+
+  // Create the transformation for the position
   // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Acts::Vector3D& pos) {
+    return Acts::Vector2D(perp(pos), pos.z());
+  };
+
+  // Create the transformation for the bfield
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Acts::Vector2D& field,
+                            const Acts::Vector3D& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi, sin_phi;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    } else {
+      cos_phi = 1.;
+      sin_phi = 0.;
+    }
+    return Acts::Vector3D(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+
+  return Acts::InterpolatedBFieldMapper<Grid_t>(transformPos, transformBField,
+                                                std::move(grid));
+}
+
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+Acts::fieldMapperXYZ(
+    Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>
+        grid) {
+  using Grid_t =
+      Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                         Acts::detail::EquidistantAxis,
+                         Acts::detail::EquidistantAxis>;
+
+  // Create the transformation for the position
+  // map (x,y,z) -> (x,y,z)
   auto transformPos = [](const Acts::Vector3D& pos) { return pos; };
 
-  // [4] Create the transformation for the bfield
+  // Create the transformation for the bfield
   // map (Bx,By,Bz) -> (Bx,By,Bz)
   auto transformBField = [](const Acts::Vector3D& field,
                             const Acts::Vector3D& /*pos*/) { return field; };
 
-  // [5] Create the mapper & BField Service
-  // create field mapping
   return Acts::InterpolatedBFieldMapper<Grid_t>(transformPos, transformBField,
                                                 std::move(grid));
 }
@@ -276,30 +306,6 @@ Acts::solenoidFieldMapper(std::pair<double, double> rlim,
                          Acts::detail::EquidistantAxis>;
   Grid_t grid(std::make_tuple(std::move(rAxis), std::move(zAxis)));
 
-  // Create the transformation for the position
-  // map (x,y,z) -> (r,z)
-  auto transformPos = [](const Acts::Vector3D& pos) {
-    return Acts::Vector2D(perp(pos), pos.z());
-  };
-
-  // Create the transformation for the bfield
-  // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2D& bfield,
-                            const Acts::Vector3D& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi, sin_phi;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3D(bfield.x() * cos_phi, bfield.x() * sin_phi,
-                          bfield.y());
-  };
-
   // iterate over all bins, set their value to the solenoid value
   // at their lower left position
   for (size_t i = 0; i <= nBinsR + 1; i++) {
@@ -320,7 +326,5 @@ Acts::solenoidFieldMapper(std::pair<double, double> rlim,
 
   // Create the mapper & BField Service
   // create field mapping
-  Acts::InterpolatedBFieldMapper<Grid_t> mapper(transformPos, transformBField,
-                                                std::move(grid));
-  return mapper;
+  return fieldMapperRZ(std::move(grid));
 }
@@ -35,6 +35,18 @@ Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::operator*=(
   return (*this);
 }
 
+void Acts::BinnedSurfaceMaterial::tabulateInteractionConstants() {
+  m_interactionConstants.clear();
+  m_interactionConstants.reserve(m_fullMaterial.size());
+  for (const auto& materialVector : m_fullMaterial) {
+    auto& constantsVector = m_interactionConstants.emplace_back();
+    constantsVector.reserve(materialVector.size());
+    for (const auto& materialBin : materialVector) {
+      constantsVector.emplace_back(materialBin.material());
+    }
+  }
+}
+
 const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
     const Vector2D& lp) const {
   // the first bin
@@ -51,6 +63,18 @@ const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
   return m_fullMaterial[ibin1][ibin0];
 }
 
+const Acts::MaterialInteractionConstants*
+Acts::BinnedSurfaceMaterial::interactionConstants(
+    const Acts::Vector3D& gp) const {
+  if (m_interactionConstants.empty()) {
+    return nullptr;
+  }
+  // the same bin as for the material slab
+  size_t ibin0 = m_binUtility.bin(gp, 0);
+  size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
+  return &m_interactionConstants[ibin1][ibin0];
+}
+
 std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
   sl << "Acts::BinnedSurfaceMaterial : " << std::endl;
   sl << "   - Number of Material bins [0,1] : " << m_binUtility.max(0) + 1
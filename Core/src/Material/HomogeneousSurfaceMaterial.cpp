@@ -20,6 +20,10 @@ Acts::HomogeneousSurfaceMaterial& Acts::HomogeneousSurfaceMaterial::operator*=(
   return (*this);
 }
 
+void Acts::HomogeneousSurfaceMaterial::tabulateInteractionConstants() {
+  m_interactionConstants.emplace(m_fullMaterial.material());
+}
+
 std::ostream& Acts::HomogeneousSurfaceMaterial::toStream(
     std::ostream& sl) const {
   sl << "Acts::HomogeneousSurfaceMaterial : " << std::endl;
@@ -132,8 +132,57 @@ inline float deriveDeltaHalf(float qOverP, const RelativisticQuantities& rq) {
   return (rq.betaGamma < 10.0f) ? 0.0f : (-1.0f / qOverP);
 }
 
+/// Compute the Bethe mean energy loss from precomputed material constants.
+///
+/// The two logarithms of the running term are combined into one. Above the
+/// density correction threshold, log(beta*gamma) cancels against the
+/// (beta*gamma)² in the mass term u = 2 * me * (beta*gamma)².
+inline float computeEnergyLossBetheTabulated(
+    const Acts::MaterialInteractionConstants& constants, float thickness,
+    float mass, const RelativisticQuantities& rq) {
+  const auto eps = constants.epsilonPerThickness * thickness * rq.q2OverBeta2;
+  const auto wmax = computeWMax(mass, rq);
+  const auto invI2 = constants.invMeanExcitationEnergy2;
+  if (rq.betaGamma < 10.0f) {
+    const auto u = computeMassTerm(Me, rq);
+    return eps * (0.5f * std::log(u * wmax * invI2) - rq.beta2);
+  }
+  return eps * (0.5f * std::log(2 * Me * wmax * invI2) - rq.beta2 -
+                constants.deltaHalfOffset);
+}
+
+/// Compute the most probable energy loss from precomputed material constants.
+///
+/// Same simplifications as for the Bethe mean energy loss with the mass term
+/// t = 2 * m * (beta*gamma)².
+inline float computeEnergyLossLandauTabulated(
+    const Acts::MaterialInteractionConstants& constants, float thickness,
+    float mass, const RelativisticQuantities& rq) {
+  const auto eps = constants.epsilonPerThickness * thickness * rq.q2OverBeta2;
+  const auto invI2 = constants.invMeanExcitationEnergy2;
+  if (rq.betaGamma < 10.0f) {
+    const auto t = computeMassTerm(mass, rq);
+    return eps * (std::log(t * eps * invI2) + 0.2f - rq.beta2);
+  }
+  return eps * (std::log(2 * mass * eps * invI2) + 0.2f - rq.beta2 -
+                2 * constants.deltaHalfOffset);
+}
+
 }  // namespace
 
+Acts::MaterialInteractionConstants::MaterialInteractionConstants(
+    const Material& material) {
+  if (not material) {
+    return;
+  }
+  const auto I = material.meanExcitationEnergy();
+  const auto Ne = material.molarElectronDensity();
+  const auto plasmaEnergy = PlasmaEnergyScale * std::sqrt(Ne);
+  epsilonPerThickness = 0.5f * K * Ne;
+  invMeanExcitationEnergy2 = 1.0f / (I * I);
+  deltaHalfOffset = std::log(plasmaEnergy / I) - 0.5f;
+}
+
 #define ASSERT_INPUTS(mass, qOverP, q)              \
   assert((0 < mass) and "Mass must be positive");   \
   assert((qOverP != 0) and "q/p must be non-zero"); \
@@ -166,6 +215,20 @@ float Acts::computeEnergyLossBethe(const MaterialSlab& slab, int /* unused */,
   return eps * running;
 }
 
+float Acts::computeEnergyLossBethe(
+    const MaterialSlab& slab, const MaterialInteractionConstants& constants,
+    int /* unused */, float m, float qOverP, float q) {
+  ASSERT_INPUTS(m, qOverP, q)
+
+  // return early in case of vacuum or zero thickness
+  if (not slab) {
+    return 0.0f;
+  }
+
+  const auto rq = RelativisticQuantities(m, qOverP, q);
+  return computeEnergyLossBetheTabulated(constants, slab.thickness(), m, rq);
+}
+
 float Acts::deriveEnergyLossBetheQOverP(const MaterialSlab& slab,
                                         int /* unused */, float m, float qOverP,
                                         float q) {
@@ -228,6 +291,20 @@ float Acts::computeEnergyLossLandau(const MaterialSlab& slab, int /* unused */,
   return eps * running;
 }
 
+float Acts::computeEnergyLossLandau(
+    const MaterialSlab& slab, const MaterialInteractionConstants& constants,
+    int /* unused */, float m, float qOverP, float q) {
+  ASSERT_INPUTS(m, qOverP, q)
+
+  // return early in case of vacuum or zero thickness
+  if (not slab) {
+    return 0.0f;
+  }
+
+  const auto rq = RelativisticQuantities(m, qOverP, q);
+  return computeEnergyLossLandauTabulated(constants, slab.thickness(), m, rq);
+}
+
 float Acts::deriveEnergyLossLandauQOverP(const MaterialSlab& slab,
                                          int /* unused */, float m,
                                          float qOverP, float q) {
@@ -100,6 +100,7 @@ void Acts::SurfaceMaterialMapper::checkAndInsert(State& mState,
   auto surfaceMaterial = surface.surfaceMaterial();
   // Check if the surface has a proxy
   if (surfaceMaterial != nullptr) {
+    surfaceMaterial = &surfaceMaterial->concreteMaterial();
     auto geoID = surface.geometryId();
     size_t volumeID = geoID.volume();
     ACTS_DEBUG("Material surface found with volumeID " << volumeID);
@@ -15,11 +15,15 @@
 namespace Acts {
 namespace {
 /// Some type defs
-using Jacobian = BoundMatrix;
-using Covariance = BoundSymMatrix;
-using BoundState = std::tuple<BoundTrackParameters, Jacobian, double>;
+using BoundState = std::tuple<BoundTrackParameters, BoundMatrix, double>;
 using CurvilinearState =
-    std::tuple<CurvilinearTrackParameters, Jacobian, double>;
+    std::tuple<CurvilinearTrackParameters, BoundMatrix, double>;
+
+using detail::TransportBoundMatrix;
+using detail::TransportBoundSymMatrix;
+using detail::TransportBoundToFreeMatrix;
+using detail::TransportFreeMatrix;
+using detail::TransportFreeVector;
 
 /// @brief Evaluate the projection Jacobian from free to curvilinear parameters
 ///
@@ -87,10 +91,12 @@ FreeToBoundMatrix freeToCurvilinearJacobian(const Vector3D& direction) {
 ///
 /// @return The projection jacobian from global end parameters to its local
 /// equivalentconst
+template <typename scalar_t>
 FreeToBoundMatrix surfaceDerivative(
     std::reference_wrapper<const GeometryContext> geoContext,
-    const FreeVector& parameters, BoundToFreeMatrix& jacobianLocalToGlobal,
-    const FreeVector& derivatives, const Surface& surface) {
+    const FreeVector& parameters,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const TransportFreeVector<scalar_t>& derivatives, const Surface& surface) {
   // Initialize the transport final frame jacobian
   FreeToBoundMatrix jacToLocal = FreeToBoundMatrix::Zero();
   // Initalize the jacobian to local, returns the transposed ref frame
@@ -100,8 +106,9 @@ FreeToBoundMatrix surfaceDerivative(
   // Calculate the form factors for the derivatives
   const BoundRowVector sVec = surface.derivativeFactors(
       geoContext, parameters.segment<3>(eFreePos0),
-      parameters.segment<3>(eFreeDir0), rframeT, jacobianLocalToGlobal);
-  jacobianLocalToGlobal -= derivatives * sVec;
+      parameters.segment<3>(eFreeDir0), rframeT,
+      jacobianLocalToGlobal.template cast<FreeScalar>());
+  jacobianLocalToGlobal -= derivatives * sVec.template cast<scalar_t>();
   // Return the jacobian to local
   return jacToLocal;
 }
@@ -123,12 +130,14 @@ FreeToBoundMatrix surfaceDerivative(
 ///
 /// @return The projection jacobian from global end parameters to its local
 /// equivalent
+template <typename scalar_t>
 const FreeToBoundMatrix surfaceDerivative(
-    const Vector3D& direction, BoundToFreeMatrix& jacobianLocalToGlobal,
-    const FreeVector& derivatives) {
+    const Vector3D& direction,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const TransportFreeVector<scalar_t>& derivatives) {
   // Transport the covariance
-  const ActsRowVectorD<3> normVec(direction);
-  const BoundRowVector sfactors =
+  const ActsRowVector<scalar_t, 3> normVec(direction.cast<scalar_t>());
+  const ActsRowVector<scalar_t, eBoundSize> sfactors =
       normVec * jacobianLocalToGlobal.template topLeftCorner<3, eBoundSize>();
   jacobianLocalToGlobal -= derivatives * sfactors;
   // Since the jacobian to local needs to calculated for the bound parameters
@@ -147,18 +156,19 @@ const FreeToBoundMatrix surfaceDerivative(
 /// parametrisation to free parameters
 /// @param [in] parameters Free, nominal parametrisation
 /// @param [in] surface The surface the represents the local parametrisation
+template <typename scalar_t>
 void reinitializeJacobians(
     std::reference_wrapper<const GeometryContext> geoContext,
-    FreeMatrix& transportJacobian, FreeVector& derivatives,
-    BoundToFreeMatrix& jacobianLocalToGlobal, const FreeVector& parameters,
-    const Surface& surface) {
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, const Surface& surface) {
   using VectorHelpers::phi;
   using VectorHelpers::theta;
 
   // Reset the jacobians
-  transportJacobian = FreeMatrix::Identity();
-  derivatives = FreeVector::Zero();
-  jacobianLocalToGlobal = BoundToFreeMatrix::Zero();
+  transportJacobian = TransportFreeMatrix<scalar_t>::Identity();
+  derivatives = TransportFreeVector<scalar_t>::Zero();
 
   // Reset the jacobian from local to global
   const Vector3D position = parameters.segment<3>(eFreePos0);
@@ -174,8 +184,11 @@ void reinitializeJacobians(
   BoundVector pars;
   pars << loc[eBoundLoc0], loc[eBoundLoc1], phi(direction), theta(direction),
       parameters[eFreeQOverP], parameters[eFreeTime];
-  surface.initJacobianToGlobal(geoContext, jacobianLocalToGlobal, position,
-                               direction, pars);
+  // The surface always initializes in the default precision
+  BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+  surface.initJacobianToGlobal(geoContext, jacToGlobal, position, direction,
+                               pars);
+  jacobianLocalToGlobal = jacToGlobal.template cast<scalar_t>();
 }
 
 /// @brief This function reinitialises the state members required for the
@@ -187,14 +200,16 @@ void reinitializeJacobians(
 /// @param [in, out] jacobianLocalToGlobal Projection jacobian of the last bound
 /// parametrisation to free parameters
 /// @param [in] direction Normalised direction vector
-void reinitializeJacobians(FreeMatrix& transportJacobian,
-                           FreeVector& derivatives,
-                           BoundToFreeMatrix& jacobianLocalToGlobal,
-                           const Vector3D& direction) {
+template <typename scalar_t>
+void reinitializeJacobians(
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const Vector3D& direction) {
   // Reset the jacobians
-  transportJacobian = FreeMatrix::Identity();
-  derivatives = FreeVector::Zero();
-  jacobianLocalToGlobal = BoundToFreeMatrix::Zero();
+  transportJacobian = TransportFreeMatrix<scalar_t>::Identity();
+  derivatives = TransportFreeVector<scalar_t>::Zero();
+  jacobianLocalToGlobal = TransportBoundToFreeMatrix<scalar_t>::Zero();
 
   // Optimized trigonometry on the propagation direction
   const double x = direction(0);  // == cos(phi) * sin(theta)
@@ -224,19 +239,23 @@ void reinitializeJacobians(FreeMatrix& transportJacobian,
 
 namespace detail {
 
-BoundState boundState(std::reference_wrapper<const GeometryContext> geoContext,
-                      Covariance& covarianceMatrix, Jacobian& jacobian,
-                      FreeMatrix& transportJacobian, FreeVector& derivatives,
-                      BoundToFreeMatrix& jacobianLocalToGlobal,
-                      const FreeVector& parameters, bool covTransport,
-                      double accumulatedPath, const Surface& surface) {
+template <typename scalar_t>
+BoundState boundState(
+    std::reference_wrapper<const GeometryContext> geoContext,
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, bool covTransport, double accumulatedPath,
+    const Surface& surface) {
   // Covariance transport
   std::optional<BoundSymMatrix> cov = std::nullopt;
   if (covTransport) {
     covarianceTransport(geoContext, covarianceMatrix, jacobian,
                         transportJacobian, derivatives, jacobianLocalToGlobal,
                         parameters, surface);
-    cov = covarianceMatrix;
+    cov = covarianceMatrix.template cast<BoundScalar>();
   }
   // Create the bound parameters
   BoundVector bv =
@@ -244,16 +263,17 @@ BoundState boundState(std::reference_wrapper<const GeometryContext> geoContext,
   // Create the bound state
   return std::make_tuple(
       BoundTrackParameters(surface.getSharedPtr(), bv, std::move(cov)),
-      jacobian, accumulatedPath);
+      BoundMatrix(jacobian.template cast<BoundScalar>()), accumulatedPath);
 }
 
-CurvilinearState curvilinearState(Covariance& covarianceMatrix,
-                                  Jacobian& jacobian,
-                                  FreeMatrix& transportJacobian,
-                                  FreeVector& derivatives,
-                                  BoundToFreeMatrix& jacobianLocalToGlobal,
-                                  const FreeVector& parameters,
-                                  bool covTransport, double accumulatedPath) {
+template <typename scalar_t>
+CurvilinearState curvilinearState(
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, bool covTransport, double accumulatedPath) {
   const Vector3D& direction = parameters.segment<3>(eFreeDir0);
 
   // Covariance transport
@@ -261,7 +281,7 @@ CurvilinearState curvilinearState(Covariance& covarianceMatrix,
   if (covTransport) {
     covarianceTransport(covarianceMatrix, jacobian, transportJacobian,
                         derivatives, jacobianLocalToGlobal, direction);
-    cov = covarianceMatrix;
+    cov = covarianceMatrix.template cast<BoundScalar>();
   }
   // Create the curvilinear parameters
   Vector4D pos4 = Vector4D::Zero();
@@ -272,19 +292,25 @@ CurvilinearState curvilinearState(Covariance& covarianceMatrix,
   CurvilinearTrackParameters curvilinearParams(
       pos4, direction, parameters[eFreeQOverP], std::move(cov));
   // Create the curvilinear state
-  return std::make_tuple(std::move(curvilinearParams), jacobian,
+  return std::make_tuple(std::move(curvilinearParams),
+                         BoundMatrix(jacobian.template cast<BoundScalar>()),
                          accumulatedPath);
 }
 
-void covarianceTransport(Covariance& covarianceMatrix, Jacobian& jacobian,
-                         FreeMatrix& transportJacobian, FreeVector& derivatives,
-                         BoundToFreeMatrix& jacobianLocalToGlobal,
-                         const Vector3D& direction) {
+template <typename scalar_t>
+void covarianceTransport(
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const Vector3D& direction) {
   // Build the full jacobian
   jacobianLocalToGlobal = transportJacobian * jacobianLocalToGlobal;
   const FreeToBoundMatrix jacToLocal =
       surfaceDerivative(direction, jacobianLocalToGlobal, derivatives);
-  const Jacobian jacFull = jacToLocal * jacobianLocalToGlobal;
+  const TransportBoundMatrix<scalar_t> jacFull =
+      jacToLocal.template cast<scalar_t>() * jacobianLocalToGlobal;
 
   // Apply the actual covariance transport
   covarianceMatrix = jacFull * covarianceMatrix * jacFull.transpose();
@@ -297,17 +323,21 @@ void covarianceTransport(Covariance& covarianceMatrix, Jacobian& jacobian,
   jacobian = jacFull;
 }
 
+template <typename scalar_t>
 void covarianceTransport(
     std::reference_wrapper<const GeometryContext> geoContext,
-    Covariance& covarianceMatrix, Jacobian& jacobian,
-    FreeMatrix& transportJacobian, FreeVector& derivatives,
-    BoundToFreeMatrix& jacobianLocalToGlobal, const FreeVector& parameters,
-    const Surface& surface) {
+    TransportBoundSymMatrix<scalar_t>& covarianceMatrix,
+    TransportBoundMatrix<scalar_t>& jacobian,
+    TransportFreeMatrix<scalar_t>& transportJacobian,
+    TransportFreeVector<scalar_t>& derivatives,
+    TransportBoundToFreeMatrix<scalar_t>& jacobianLocalToGlobal,
+    const FreeVector& parameters, const Surface& surface) {
   // Build the full jacobian
   jacobianLocalToGlobal = transportJacobian * jacobianLocalToGlobal;
   const FreeToBoundMatrix jacToLocal = surfaceDerivative(
       geoContext, parameters, jacobianLocalToGlobal, derivatives, surface);
-  const Jacobian jacFull = jacToLocal * jacobianLocalToGlobal;
+  const TransportBoundMatrix<scalar_t> jacFull =
+      jacToLocal.template cast<scalar_t>() * jacobianLocalToGlobal;
 
   // Apply the actual covariance transport
   covarianceMatrix = jacFull * covarianceMatrix * jacFull.transpose();
@@ -320,5 +350,34 @@ void covarianceTransport(
   jacobian = jacFull;
 }
 
+// Explicit instantiations for the supported transport precisions
+#define ACTS_COVARIANCE_ENGINE_INSTANTIATE(scalar_t)                         \
+  template BoundState boundState<scalar_t>(                                  \
+      std::reference_wrapper<const GeometryContext>,                         \
+      TransportBoundSymMatrix<scalar_t>&, TransportBoundMatrix<scalar_t>&,   \
+      TransportFreeMatrix<scalar_t>&, TransportFreeVector<scalar_t>&,        \
+      TransportBoundToFreeMatrix<scalar_t>&, const FreeVector&, bool, double, \
+      const Surface&);                                                       \
+  template CurvilinearState curvilinearState<scalar_t>(                      \
+      TransportBoundSymMatrix<scalar_t>&, TransportBoundMatrix<scalar_t>&,   \
+      TransportFreeMatrix<scalar_t>&, TransportFreeVector<scalar_t>&,        \
+      TransportBoundToFreeMatrix<scalar_t>&, const FreeVector&, bool,        \
+      double);                                                               \
+  template void covarianceTransport<scalar_t>(                               \
+      std::reference_wrapper<const GeometryContext>,                         \
+      TransportBoundSymMatrix<scalar_t>&, TransportBoundMatrix<scalar_t>&,   \
+      TransportFreeMatrix<scalar_t>&, TransportFreeVector<scalar_t>&,        \
+      TransportBoundToFreeMatrix<scalar_t>&, const FreeVector&,              \
+      const Surface&);                                                       \
+  template void covarianceTransport<scalar_t>(                               \
+      TransportBoundSymMatrix<scalar_t>&, TransportBoundMatrix<scalar_t>&,   \
+      TransportFreeMatrix<scalar_t>&, TransportFreeVector<scalar_t>&,        \
+      TransportBoundToFreeMatrix<scalar_t>&, const Vector3D&);
+
+ACTS_COVARIANCE_ENGINE_INSTANTIATE(double)
+ACTS_COVARIANCE_ENGINE_INSTANTIATE(float)
+
+#undef ACTS_COVARIANCE_ENGINE_INSTANTIATE
+
 }  // namespace detail
 }  // namespace Acts
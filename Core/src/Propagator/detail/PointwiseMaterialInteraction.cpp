@@ -16,7 +16,10 @@ namespace detail {
 void PointwiseMaterialInteraction::evaluatePointwiseMaterialInteraction(
     bool multipleScattering, bool energyLoss) {
   if (energyLoss) {
-    Eloss = computeEnergyLossBethe(slab, pdg, mass, qOverP, q);
+    Eloss = (interactionConstants != nullptr)
+                ? computeEnergyLossBethe(slab, *interactionConstants, pdg,
+                                         mass, qOverP, q)
+                : computeEnergyLossBethe(slab, pdg, mass, qOverP, q);
   }
   // Compute contributions from interactions
   if (performCovarianceTransport) {
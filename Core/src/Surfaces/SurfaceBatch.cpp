@@ -0,0 +1,326 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/SurfaceBatch.hpp"
+
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+#include "Acts/Utilities/detail/RealQuadraticEquation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// The kernels work on chunks of this size, such that the arithmetic
+/// pass runs over contiguous data without touching the output
+constexpr size_t s_chunkSize = 16;
+
+/// Status of a solution along the line
+inline Acts::Intersection3D::Status solutionStatus(double path) {
+  return (path * path < Acts::s_onSurfaceTolerance * Acts::s_onSurfaceTolerance)
+             ? Acts::Intersection3D::Status::onSurface
+             : Acts::Intersection3D::Status::reachable;
+}
+
+}  // namespace
+
+void Acts::SurfaceBatch::PlacementBlock::push_back(
+    size_t idx, const Transform3D& transform) {
+  // fast access via the matrix (and not the rotation())
+  const auto& tMatrix = transform.matrix();
+  index.push_back(idx);
+  cx.push_back(tMatrix(0, 3));
+  cy.push_back(tMatrix(1, 3));
+  cz.push_back(tMatrix(2, 3));
+  ux.push_back(tMatrix(0, 0));
+  uy.push_back(tMatrix(1, 0));
+  uz.push_back(tMatrix(2, 0));
+  vx.push_back(tMatrix(0, 1));
+  vy.push_back(tMatrix(1, 1));
+  vz.push_back(tMatrix(2, 1));
+  nx.push_back(tMatrix(0, 2));
+  ny.push_back(tMatrix(1, 2));
+  nz.push_back(tMatrix(2, 2));
+}
+
+Acts::SurfaceBatch::SurfaceBatch(const GeometryContext& gctx,
+                                 const std::vector<const Surface*>& surfaces)
+    : m_gctx(gctx), m_surfaces(surfaces) {
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  for (size_t is = 0; is < m_surfaces.size(); ++is) {
+    const Surface& surface = *m_surfaces[is];
+    const SurfaceBounds& sBounds = surface.bounds();
+    switch (surface.type()) {
+      case Surface::Plane: {
+        if (sBounds.type() == SurfaceBounds::eRectangle) {
+          const auto& rBounds = static_cast<const RectangleBounds&>(sBounds);
+          m_planes.push_back(is, surface.transform(gctx));
+          m_planes.min.push_back(rBounds.min());
+          m_planes.max.push_back(rBounds.max());
+          continue;
+        } else if (sBounds.type() == SurfaceBounds::eBoundless) {
+          m_planes.push_back(is, surface.transform(gctx));
+          m_planes.min.push_back(Vector2D(-inf, -inf));
+          m_planes.max.push_back(Vector2D(inf, inf));
+          continue;
+        }
+        break;
+      }
+      case Surface::Disc: {
+        if (sBounds.type() == SurfaceBounds::eDisc) {
+          const auto& rBounds = static_cast<const RadialBounds&>(sBounds);
+          if (rBounds.coversFullAzimuth()) {
+            m_discs.push_back(is, surface.transform(gctx));
+            m_discs.rMin.push_back(rBounds.rMin());
+            m_discs.rMax.push_back(rBounds.rMax());
+            continue;
+          }
+        } else if (sBounds.type() == SurfaceBounds::eBoundless) {
+          m_discs.push_back(is, surface.transform(gctx));
+          m_discs.rMin.push_back(-inf);
+          m_discs.rMax.push_back(inf);
+          continue;
+        }
+        break;
+      }
+      case Surface::Cylinder: {
+        const auto& cBounds = static_cast<const CylinderBounds&>(sBounds);
+        if (cBounds.coversFullAzimuth()) {
+          m_cylinders.push_back(is, surface.transform(gctx));
+          m_cylinders.r.push_back(cBounds.get(CylinderBounds::eR));
+          m_cylinders.halfZ.push_back(
+              cBounds.get(CylinderBounds::eHalfLengthZ));
+          continue;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    m_others.push_back(is);
+  }
+}
+
+void Acts::SurfaceBatch::intersect(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  intersections.resize(m_surfaces.size());
+  intersectPlanes(position, direction, bcheck, intersections);
+  intersectDiscs(position, direction, bcheck, intersections);
+  intersectCylinders(position, direction, bcheck, intersections);
+  for (auto idx : m_others) {
+    intersections[idx] =
+        m_surfaces[idx]->intersect(m_gctx, position, direction, bcheck);
+  }
+}
+
+std::vector<Acts::SurfaceIntersection> Acts::SurfaceBatch::intersect(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck) const {
+  std::vector<SurfaceIntersection> intersections;
+  intersect(position, direction, bcheck, intersections);
+  return intersections;
+}
+
+void Acts::SurfaceBatch::intersectPlanes(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  const PlaneBlock& b = m_planes;
+  const double px = position.x(), py = position.y(), pz = position.z();
+  const double dx = direction.x(), dy = direction.y(), dz = direction.z();
+  std::array<double, s_chunkSize> denom{};
+  std::array<double, s_chunkSize> path{};
+  for (size_t start = 0; start < b.size(); start += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, b.size() - start);
+    // (1) the arithmetic pass: path length to the plane
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const double d = dx * b.nx[j] + dy * b.ny[j] + dz * b.nz[j];
+      const double num = b.nx[j] * (b.cx[j] - px) +
+                         b.ny[j] * (b.cy[j] - py) + b.nz[j] * (b.cz[j] - pz);
+      denom[i] = d;
+      path[i] = num / (d != 0. ? d : 1.);
+    }
+    // (2) status and boundary check
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const Surface* surface = m_surfaces[b.index[j]];
+      if (denom[i] == 0.) {
+        intersections[b.index[j]] =
+            SurfaceIntersection(Intersection3D(), surface);
+        continue;
+      }
+      Intersection3D intersection(position + path[i] * direction, path[i],
+                                  solutionStatus(path[i]));
+      if (bcheck) {
+        const double lx = intersection.position.x() - b.cx[j];
+        const double ly = intersection.position.y() - b.cy[j];
+        const double lz = intersection.position.z() - b.cz[j];
+        const Vector2D lposition(lx * b.ux[j] + ly * b.uy[j] + lz * b.uz[j],
+                                 lx * b.vx[j] + ly * b.vy[j] + lz * b.vz[j]);
+        if (not bcheck.isInside(lposition, b.min[j], b.max[j])) {
+          intersection.status = Intersection3D::Status::missed;
+        }
+      }
+      intersections[b.index[j]] = SurfaceIntersection(intersection, surface);
+    }
+  }
+}
+
+void Acts::SurfaceBatch::intersectDiscs(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  const DiscBlock& b = m_discs;
+  // Only the absolute radial check is done in the kernel
+  if (bcheck and bcheck.type() != BoundaryCheck::Type::eAbsolute) {
+    for (auto idx : b.index) {
+      intersections[idx] =
+          m_surfaces[idx]->intersect(m_gctx, position, direction, bcheck);
+    }
+    return;
+  }
+  const double tolerance =
+      bcheck ? s_onSurfaceTolerance + bcheck.tolerance()[eBoundLoc0] : 0.;
+  const double px = position.x(), py = position.y(), pz = position.z();
+  const double dx = direction.x(), dy = direction.y(), dz = direction.z();
+  std::array<double, s_chunkSize> denom{};
+  std::array<double, s_chunkSize> path{};
+  for (size_t start = 0; start < b.size(); start += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, b.size() - start);
+    // (1) the arithmetic pass: path length to the disc plane
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const double d = dx * b.nx[j] + dy * b.ny[j] + dz * b.nz[j];
+      const double num = b.nx[j] * (b.cx[j] - px) +
+                         b.ny[j] * (b.cy[j] - py) + b.nz[j] * (b.cz[j] - pz);
+      denom[i] = d;
+      path[i] = num / (d != 0. ? d : 1.);
+    }
+    // (2) status and radial boundary check
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const Surface* surface = m_surfaces[b.index[j]];
+      if (denom[i] == 0.) {
+        intersections[b.index[j]] =
+            SurfaceIntersection(Intersection3D(), surface);
+        continue;
+      }
+      Intersection3D intersection(position + path[i] * direction, path[i],
+                                  solutionStatus(path[i]));
+      if (bcheck) {
+        const double lx = intersection.position.x() - b.cx[j];
+        const double ly = intersection.position.y() - b.cy[j];
+        const double lz = intersection.position.z() - b.cz[j];
+        const double l0 = lx * b.ux[j] + ly * b.uy[j] + lz * b.uz[j];
+        const double l1 = lx * b.vx[j] + ly * b.vy[j] + lz * b.vz[j];
+        const double r = std::sqrt(l0 * l0 + l1 * l1);
+        if (not(r + tolerance > b.rMin[j] and r - tolerance < b.rMax[j])) {
+          intersection.status = Intersection3D::Status::missed;
+        }
+      }
+      intersections[b.index[j]] = SurfaceIntersection(intersection, surface);
+    }
+  }
+}
+
+void Acts::SurfaceBatch::intersectCylinders(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  const CylinderBlock& b = m_cylinders;
+  // Only the absolute check along z is done in the kernel
+  if (bcheck and bcheck.type() != BoundaryCheck::Type::eAbsolute) {
+    for (auto idx : b.index) {
+      intersections[idx] =
+          m_surfaces[idx]->intersect(m_gctx, position, direction, bcheck);
+    }
+    return;
+  }
+  const double tolerance =
+      bcheck ? s_onSurfaceTolerance + bcheck.tolerance()[eBoundLoc1] : 0.;
+  const double px = position.x(), py = position.y(), pz = position.z();
+  const double dx = direction.x(), dy = direction.y(), dz = direction.z();
+  std::array<double, s_chunkSize> qa{};
+  std::array<double, s_chunkSize> qb{};
+  std::array<double, s_chunkSize> qc{};
+  for (size_t start = 0; start < b.size(); start += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, b.size() - start);
+    // (1) the arithmetic pass: coefficients of the quadratic equation,
+    // see CylinderSurface::intersectionSolver for the explanation
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const double pcx = px - b.cx[j], pcy = py - b.cy[j], pcz = pz - b.cz[j];
+      // pc x axis
+      const double ax = pcy * b.nz[j] - pcz * b.ny[j];
+      const double ay = pcz * b.nx[j] - pcx * b.nz[j];
+      const double az = pcx * b.ny[j] - pcy * b.nx[j];
+      // direction x axis
+      const double lx = dy * b.nz[j] - dz * b.ny[j];
+      const double ly = dz * b.nx[j] - dx * b.nz[j];
+      const double lz = dx * b.ny[j] - dy * b.nx[j];
+      qa[i] = lx * lx + ly * ly + lz * lz;
+      qb[i] = 2. * (lx * ax + ly * ay + lz * az);
+      qc[i] = ax * ax + ay * ay + az * az - b.r[j] * b.r[j];
+    }
+    // (2) solutions, status and boundary check
+    for (size_t i = 0; i < n; ++i) {
+      const size_t j = start + i;
+      const Surface* surface = m_surfaces[b.index[j]];
+      detail::RealQuadraticEquation qe(qa[i], qb[i], qc[i]);
+      if (qe.solutions == 0) {
+        intersections[b.index[j]] = SurfaceIntersection();
+        continue;
+      }
+      auto boundaryCheck =
+          [&](const Vector3D& solution,
+              Intersection3D::Status status) -> Intersection3D::Status {
+        if (!bcheck) {
+          return status;
+        }
+        const double cZ = (solution.x() - b.cx[j]) * b.nx[j] +
+                          (solution.y() - b.cy[j]) * b.ny[j] +
+                          (solution.z() - b.cz[j]) * b.nz[j];
+        const double hZ = b.halfZ[j] + tolerance;
+        return (cZ * cZ < hZ * hZ) ? status : Intersection3D::Status::missed;
+      };
+      Vector3D solution1 = position + qe.first * direction;
+      Intersection3D::Status status1 =
+          boundaryCheck(solution1, solutionStatus(qe.first));
+      Intersection3D first(solution1, qe.first, status1);
+      SurfaceIntersection cIntersection(first, surface);
+      if (qe.solutions == 1) {
+        intersections[b.index[j]] = cIntersection;
+        continue;
+      }
+      Vector3D solution2 = position + qe.second * direction;
+      Intersection3D::Status status2 =
+          boundaryCheck(solution2, solutionStatus(qe.second));
+      Intersection3D second(solution2, qe.second, status2);
+      // Same solution ordering as CylinderSurface::intersect
+      bool check1 = status1 != Intersection3D::Status::missed or
+                    (status1 == Intersection3D::Status::missed and
+                     status2 == Intersection3D::Status::missed);
+      if ((check1 and qe.first * qe.first < qe.second * qe.second) or
+          status2 == Intersection3D::Status::missed) {
+        cIntersection.alternative = second;
+      } else {
+        cIntersection.alternative = first;
+        cIntersection.intersection = second;
+      }
+      intersections[b.index[j]] = cIntersection;
+    }
+  }
+}
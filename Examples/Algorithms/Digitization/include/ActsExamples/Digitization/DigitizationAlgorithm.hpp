@@ -8,16 +8,22 @@
 
 #pragma once
 
+#include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Plugins/Digitization/DigitizationCell.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
 
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Acts {
 class DigitizationModule;
+class PlanarModuleCluster;
 class IdentifiedDetectorElement;
 class PlanarModuleStepper;
 class Surface;
@@ -40,6 +46,11 @@ class DigitizationAlgorithm final : public BareAlgorithm {
     std::shared_ptr<const Acts::PlanarModuleStepper> planarModuleStepper;
     /// Random numbers tool.
     std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Digitize the modules of an event in parallel.
+    ///
+    /// The clusters are merged in module order afterwards, i.e. the output is
+    /// identical to the serial digitization.
+    bool parallelDigitization = false;
   };
 
   /// Construct the digitization algorithm.
@@ -54,6 +65,9 @@ class DigitizationAlgorithm final : public BareAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final override;
 
+  /// The output container is reused between events.
+  std::vector<std::string> reusableOutputs() const final override;
+
  private:
   struct Digitizable {
     const Acts::Surface* surface = nullptr;
@@ -61,6 +75,21 @@ class DigitizationAlgorithm final : public BareAlgorithm {
     const Acts::DigitizationModule* digitizer = nullptr;
   };
 
+  /// Digitize the hits of a single module.
+  ///
+  /// @param gctx is the geometry context
+  /// @param hits is the full hit container to compute the hit indices
+  /// @param moduleHits are the hits of the module
+  /// @param dg is the digitizable module
+  /// @param steps is a reusable buffer for the digitization steps
+  /// @param clusters is the output container, one cluster per valid hit
+  void digitizeModule(const Acts::GeometryContext& gctx,
+                      const SimHitContainer& hits,
+                      const Range<SimHitContainer::const_iterator>& moduleHits,
+                      const Digitizable& dg,
+                      std::vector<Acts::DigitizationStep>& steps,
+                      std::vector<Acts::PlanarModuleCluster>& clusters) const;
+
   Config m_cfg;
   /// Lookup container for all digitizable surfaces
   std::unordered_map<Acts::GeometryID, Digitizable> m_digitizables;
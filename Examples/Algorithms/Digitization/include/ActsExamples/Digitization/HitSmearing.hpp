@@ -14,6 +14,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Acts {
 class Surface;
@@ -46,6 +47,9 @@ class HitSmearing final : public BareAlgorithm {
 
   ProcessCode execute(const AlgorithmContext& ctx) const final override;
 
+  /// The output container is reused between events.
+  std::vector<std::string> reusableOutputs() const final override;
+
  private:
   Config m_cfg;
   /// Lookup container for hit surfaces that generate smeared hits
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2017 CERN for the benefit of the Acts project
+// Copyright (C) 2017-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,9 +26,12 @@
 #include "ActsExamples/EventData/SimVertex.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 
+#include <tbb/tbb.h>
+
 ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
     ActsExamples::DigitizationAlgorithm::Config cfg, Acts::Logging::Level lvl)
     : ActsExamples::BareAlgorithm("DigitizationAlgorithm", lvl),
@@ -72,93 +75,131 @@ ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
   });
 }
 
+std::vector<std::string>
+ActsExamples::DigitizationAlgorithm::reusableOutputs() const {
+  return {m_cfg.outputClusters};
+}
+
+void ActsExamples::DigitizationAlgorithm::digitizeModule(
+    const Acts::GeometryContext& gctx, const SimHitContainer& hits,
+    const Range<SimHitContainer::const_iterator>& moduleHits,
+    const Digitizable& dg, std::vector<Acts::DigitizationStep>& steps,
+    std::vector<Acts::PlanarModuleCluster>& clusters) const {
+  // local intersection / direction
+  const auto invTransfrom = dg.surface->transform(gctx).inverse();
+  // the lorentz shift is identical for all hits on the module
+  const auto thickness = dg.detectorElement->thickness();
+  const auto lorentzAngle = dg.digitizer->lorentzAngle();
+  auto lorentzShift = thickness * std::tan(lorentzAngle);
+  lorentzShift *= -(dg.digitizer->readoutDirection());
+
+  // use iterators manually so we can retrieve the hit index in the container
+  for (auto ih = moduleHits.begin(); ih != moduleHits.end(); ++ih) {
+    const auto& hit = *ih;
+    const auto idx = hits.index_of(ih);
+
+    Acts::Vector2D localIntersect = (invTransfrom * hit.position()).head<2>();
+    Acts::Vector3D localDirection = invTransfrom.linear() * hit.unitDirection();
+
+    // now calculate the steps through the silicon
+    m_cfg.planarModuleStepper->cellSteps(gctx, *dg.digitizer, localIntersect,
+                                         localDirection, steps);
+    // everything under threshold or edge effects
+    if (steps.empty()) {
+      ACTS_VERBOSE("No steps returned from stepper.");
+      continue;
+    }
+
+    // lets create a cluster - centroid method
+    double localX = 0.;
+    double localY = 0.;
+    double totalPath = 0.;
+    // the cells to be used
+    std::vector<Acts::DigitizationCell> usedCells;
+    usedCells.reserve(steps.size());
+    // loop over the steps
+    for (const auto& dStep : steps) {
+      // @todo implement smearing
+      localX += dStep.stepLength * dStep.stepCellCenter.x();
+      localY += dStep.stepLength * dStep.stepCellCenter.y();
+      totalPath += dStep.stepLength;
+      usedCells.emplace_back(dStep.stepCell.channel0, dStep.stepCell.channel1,
+                             dStep.stepLength);
+    }
+    // divide by the total path
+    localX /= totalPath;
+    localX += lorentzShift;
+    localY /= totalPath;
+
+    // the covariance is currently set to 0.
+    Acts::ActsSymMatrixD<3> cov;
+    cov << 0.05, 0., 0., 0., 0.05, 0., 0., 0.,
+        900. * Acts::UnitConstants::ps * Acts::UnitConstants::ps;
+
+    // create the planar cluster
+    clusters.emplace_back(
+        dg.surface->getSharedPtr(), Identifier(identifier_type(idx), {idx}),
+        std::move(cov), localX, localY, hit.time(), std::move(usedCells));
+  }
+}
+
 ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   // Prepare the input and output collections
   const auto& hits =
       ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
-  ActsExamples::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters;
-
+  auto clusters = ctx.eventStore.recycled<
+      ActsExamples::GeometryIdMultimap<Acts::PlanarModuleCluster>>(
+      m_cfg.outputClusters);
+
+  // collect the modules first such that they can be processed independently
+  struct Module {
+    Acts::GeometryID geoId;
+    Range<SimHitContainer::const_iterator> hits;
+    const Digitizable* digitizable;
+  };
+  std::vector<Module> modules;
   for (auto&& [moduleGeoId, moduleHits] : groupByModule(hits)) {
     // can only digitize hits on digitizable surfaces
     const auto it = m_digitizables.find(moduleGeoId);
     if (it == m_digitizables.end()) {
       continue;
     }
+    modules.push_back({moduleGeoId, moduleHits, &it->second});
+  }
+
+  // one cluster container per module, merged in module order afterwards
+  std::vector<std::vector<Acts::PlanarModuleCluster>> moduleClusters(
+      modules.size());
+  auto digitizeModules = [&](size_t begin, size_t end) {
+    // the step buffer is reused for all hits in the range
+    std::vector<Acts::DigitizationStep> steps;
+    for (size_t i = begin; i < end; ++i) {
+      moduleClusters[i].reserve(modules[i].hits.size());
+      digitizeModule(ctx.geoContext, hits, modules[i].hits,
+                     *modules[i].digitizable, steps, moduleClusters[i]);
+    }
+  };
+  if (m_cfg.parallelDigitization) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, modules.size()),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        digitizeModules(range.begin(), range.end());
+                      });
+  } else {
+    digitizeModules(0, modules.size());
+  }
 
-    const auto& dg = it->second;
-    // local intersection / direction
-    const auto invTransfrom = dg.surface->transform(ctx.geoContext).inverse();
-
-    // use iterators manually so we can retrieve the hit index in the container
-    for (auto ih = moduleHits.begin(); ih != moduleHits.end(); ++ih) {
-      const auto& hit = *ih;
-      const auto idx = hits.index_of(ih);
-
-      Acts::Vector2D localIntersect = (invTransfrom * hit.position()).head<2>();
-      Acts::Vector3D localDirection =
-          invTransfrom.linear() * hit.unitDirection();
-
-      // compute digitization steps
-      const auto thickness = dg.detectorElement->thickness();
-      const auto lorentzAngle = dg.digitizer->lorentzAngle();
-      auto lorentzShift = thickness * std::tan(lorentzAngle);
-      lorentzShift *= -(dg.digitizer->readoutDirection());
-      // now calculate the steps through the silicon
-      std::vector<Acts::DigitizationStep> dSteps =
-          m_cfg.planarModuleStepper->cellSteps(ctx.geoContext, *dg.digitizer,
-                                               localIntersect, localDirection);
-      // everything under threshold or edge effects
-      if (!dSteps.size()) {
-        ACTS_VERBOSE("No steps returned from stepper.");
-        continue;
-      }
-
-      // lets create a cluster - centroid method
-      double localX = 0.;
-      double localY = 0.;
-      double totalPath = 0.;
-      // the cells to be used
-      std::vector<Acts::DigitizationCell> usedCells;
-      usedCells.reserve(dSteps.size());
-      // loop over the steps
-      for (auto dStep : dSteps) {
-        // @todo implement smearing
-        localX += dStep.stepLength * dStep.stepCellCenter.x();
-        localY += dStep.stepLength * dStep.stepCellCenter.y();
-        totalPath += dStep.stepLength;
-        usedCells.push_back(Acts::DigitizationCell(dStep.stepCell.channel0,
-                                                   dStep.stepCell.channel1,
-                                                   dStep.stepLength));
-      }
-      // divide by the total path
-      localX /= totalPath;
-      localX += lorentzShift;
-      localY /= totalPath;
-
-      // get the segmentation & find the corresponding cell id
-      const Acts::Segmentation& segmentation = dg.digitizer->segmentation();
-      auto binUtility = segmentation.binUtility();
-      Acts::Vector2D localPosition(localX, localY);
-      // @todo remove unneccesary conversion
-      // size_t bin0 = binUtility.bin(localPosition, 0);
-      // size_t bin1 = binUtility.bin(localPosition, 1);
-      // size_t binSerialized = binUtility.serialize({{bin0, bin1, 0}});
-
-      // the covariance is currently set to 0.
-      Acts::ActsSymMatrixD<3> cov;
-      cov << 0.05, 0., 0., 0., 0.05, 0., 0., 0.,
-          900. * Acts::UnitConstants::ps * Acts::UnitConstants::ps;
-
-      // create the planar cluster
-      Acts::PlanarModuleCluster pCluster(
-          dg.surface->getSharedPtr(), Identifier(identifier_type(idx), {idx}),
-          std::move(cov), localX, localY, hit.time(), std::move(usedCells));
-
-      // insert into the cluster container. since the input data is already
-      // sorted by geoId, we should always be able to add at the end.
-      clusters.emplace_hint(clusters.end(), hit.geometryId(),
-                            std::move(pCluster));
+  size_t nClusters = 0;
+  for (const auto& group : moduleClusters) {
+    nClusters += group.size();
+  }
+  clusters.reserve(nClusters);
+  for (size_t i = 0; i < modules.size(); ++i) {
+    for (auto& cluster : moduleClusters[i]) {
+      // insert into the cluster container. since the modules are sorted by
+      // geoId, we should always be able to add at the end.
+      clusters.emplace_hint(clusters.end(), modules[i].geoId,
+                            std::move(cluster));
     }
   }
 
@@ -43,12 +43,17 @@ ActsExamples::HitSmearing::HitSmearing(const Config& cfg,
   });
 }
 
+std::vector<std::string> ActsExamples::HitSmearing::reusableOutputs() const {
+  return {m_cfg.outputSourceLinks};
+}
+
 ActsExamples::ProcessCode ActsExamples::HitSmearing::execute(
     const AlgorithmContext& ctx) const {
   // setup input and output containers
   const auto& hits =
       ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
-  SimSourceLinkContainer sourceLinks;
+  auto sourceLinks =
+      ctx.eventStore.recycled<SimSourceLinkContainer>(m_cfg.outputSourceLinks);
   sourceLinks.reserve(hits.size());
 
   // setup random number generator
@@ -10,10 +10,13 @@
 
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Fatras/detail/ParallelFor.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -38,6 +41,12 @@ class FatrasAlgorithm final : public BareAlgorithm {
     simulator_t simulator;
     /// Random number service.
     std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Simulate the primaries of an event in parallel.
+    ///
+    /// Every primary and its secondaries then use an independent random
+    /// stream derived from its particle id, such that the output does not
+    /// depend on the number of threads.
+    bool parallelSimulation = false;
 
     /// Construct the algorithm config with the simulator kernel.
     Config(simulator_t&& simulator_) : simulator(std::move(simulator_)) {}
@@ -70,17 +79,16 @@ class FatrasAlgorithm final : public BareAlgorithm {
     SimParticleContainer::sequence_type particlesInitialUnordered;
     SimParticleContainer::sequence_type particlesFinalUnordered;
     SimHitContainer::sequence_type hitsUnordered;
-    // reserve appropriate resources
-    constexpr auto meanHitsPerParticle = 16u;
+    // reserve appropriate resources. the hit buffer is sized from the hit
+    // multiplicity of the previous events with a small safety margin.
     particlesInitialUnordered.reserve(inputParticles.size());
     particlesFinalUnordered.reserve(inputParticles.size());
-    hitsUnordered.reserve(meanHitsPerParticle * inputParticles.size());
+    hitsUnordered.reserve(static_cast<size_t>(
+        1.1 * m_meanHitsPerParticle.load() * inputParticles.size()));
 
     // run the simulation w/ a local random generator
-    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-    auto ret = m_cfg.simulator.simulate(
-        ctx.geoContext, ctx.magFieldContext, rng, inputParticles,
-        particlesInitialUnordered, particlesFinalUnordered, hitsUnordered);
+    auto ret = simulate(ctx, inputParticles, particlesInitialUnordered,
+                        particlesFinalUnordered, hitsUnordered);
     // fatal error leads to panic
     if (not ret.ok()) {
       ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
@@ -105,6 +113,10 @@ class FatrasAlgorithm final : public BareAlgorithm {
     ACTS_DEBUG(particlesFinalUnordered.size()
                << " simulated particles (final state)");
     ACTS_DEBUG(hitsUnordered.size() << " hits");
+    if (not inputParticles.empty()) {
+      m_meanHitsPerParticle.store(static_cast<double>(hitsUnordered.size()) /
+                                  inputParticles.size());
+    }
 
     // restore ordering for output containers
     SimParticleContainer particlesInitial;
@@ -112,7 +124,10 @@ class FatrasAlgorithm final : public BareAlgorithm {
     SimHitContainer hits;
     particlesInitial.adopt_sequence(std::move(particlesInitialUnordered));
     particlesFinal.adopt_sequence(std::move(particlesFinalUnordered));
-    hits.adopt_sequence(std::move(hitsUnordered));
+    // hits keep their simulation order within each module
+    sortByGeometryId(hitsUnordered);
+    hits.adopt_sequence(boost::container::ordered_range,
+                        std::move(hitsUnordered));
 
     // store ordered output containers
     ctx.eventStore.add(m_cfg.outputParticlesInitial,
@@ -125,6 +140,29 @@ class FatrasAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  /// Mean number of hits per input particle in the last simulated event.
+  mutable std::atomic<double> m_meanHitsPerParticle{16.};
+
+  /// Run the simulator either serially or concurrently.
+  template <typename particles_t, typename hits_t>
+  auto simulate(const AlgorithmContext& ctx,
+                const SimParticleContainer& inputParticles,
+                particles_t& particlesInitial, particles_t& particlesFinal,
+                hits_t& hits) const {
+    if (not m_cfg.parallelSimulation) {
+      auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+      return m_cfg.simulator.simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                                      inputParticles, particlesInitial,
+                                      particlesFinal, hits);
+    }
+    auto makeGenerator = [&](const ActsFatras::Particle& particle) {
+      return m_cfg.randomNumbers->spawnGenerator(
+          ctx, particle.particleId().value());
+    };
+    return m_cfg.simulator.simulateConcurrently(
+        ctx.geoContext, ctx.magFieldContext, makeGenerator, detail::parallelFor,
+        inputParticles, particlesInitial, particlesFinal, hits);
+  }
 };
 
 }  // namespace ActsExamples
@@ -91,6 +91,8 @@ typename FatrasAlgorithm<simulator_t>::Config readFatrasConfig(
     cfg.simulator.charged.selectHitSurface.passive = false;
   }
 
+  cfg.parallelSimulation = variables["fatras-parallel"].as<bool>();
+
   return cfg;
 }
 
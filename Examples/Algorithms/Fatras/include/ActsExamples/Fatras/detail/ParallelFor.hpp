@@ -0,0 +1,26 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ActsExamples {
+namespace detail {
+
+/// Run the tasks with the given indices concurrently.
+///
+/// @param numTasks is the number of tasks
+/// @param task is called once for every index in [0, numTasks)
+///
+/// Keeps the threading library out of the templated algorithm header.
+void parallelFor(size_t numTasks, const std::function<void(size_t)>& task);
+
+}  // namespace detail
+}  // namespace ActsExamples
@@ -29,4 +29,9 @@ void ActsExamples::Options::addFatrasOptions(
           ->value_name("none|sensitive|material|all")
           ->default_value("sensitive"),
       "Which surfaces should record charged particle hits");
+  opt("fatras-parallel", bool_switch(),
+      "Simulate the primary particles of an event in parallel with "
+      "independent random streams");
+  opt("fatras-digi-parallel", bool_switch(),
+      "Digitize the modules of an event in parallel");
 }
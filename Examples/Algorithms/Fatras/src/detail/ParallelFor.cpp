@@ -0,0 +1,16 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Fatras/detail/ParallelFor.hpp"
+
+#include <tbb/tbb.h>
+
+void ActsExamples::detail::parallelFor(
+    size_t numTasks, const std::function<void(size_t)>& task) {
+  tbb::parallel_for(size_t(0), numTasks, task);
+}
@@ -28,12 +28,18 @@ ActsExamples::ParticleSmearing::ParticleSmearing(const Config& cfg,
   }
 }
 
+std::vector<std::string> ActsExamples::ParticleSmearing::reusableOutputs()
+    const {
+  return {m_cfg.outputTrackParameters};
+}
+
 ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
     const AlgorithmContext& ctx) const {
   // setup input and output containers
   const auto& particles =
       ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  TrackParametersContainer parameters;
+  auto parameters = ctx.eventStore.recycled<TrackParametersContainer>(
+      m_cfg.outputTrackParameters);
   parameters.reserve(particles.size());
 
   // setup random number generator and standard gaussian
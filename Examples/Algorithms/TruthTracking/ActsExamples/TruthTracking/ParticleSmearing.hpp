@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -55,6 +56,9 @@ class ParticleSmearing final : public BareAlgorithm {
 
   ProcessCode execute(const AlgorithmContext& ctx) const final override;
 
+  /// The output container is reused between events.
+  std::vector<std::string> reusableOutputs() const final override;
+
  private:
   Config m_cfg;
 };
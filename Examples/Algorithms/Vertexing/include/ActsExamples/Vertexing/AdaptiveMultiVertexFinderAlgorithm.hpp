@@ -27,6 +27,8 @@ class AdaptiveMultiVertexFinderAlgorithm : public ActsExamples::BareAlgorithm {
   struct Config {
     /// Input track collection
     std::string trackCollection;
+    /// Find the vertices in independent z-slices in parallel
+    bool useZSlices = false;
   };
 
   /// Constructor
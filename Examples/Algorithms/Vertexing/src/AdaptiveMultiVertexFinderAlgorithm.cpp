@@ -30,6 +30,8 @@
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/TruthTracking/VertexAndTracks.hpp"
 
+#include <tbb/tbb.h>
+
 ActsExamples::AdaptiveMultiVertexFinderAlgorithm::
     AdaptiveMultiVertexFinderAlgorithm(const Config& cfg,
                                        Acts::Logging::Level level)
@@ -97,6 +99,14 @@ ActsExamples::AdaptiveMultiVertexFinderAlgorithm::execute(
                               linearizer);
   // We do not want to use a beamspot constraint here
   finderConfig.useBeamSpotConstraint = false;
+  // Process independent z-slices of the beamline in parallel
+  if (m_cfg.useZSlices) {
+    finderConfig.useZSlices = true;
+    finderConfig.zSliceExecutor =
+        [](size_t nSlices, const std::function<void(size_t)>& func) {
+          tbb::parallel_for(size_t(0), nSlices, func);
+        };
+  }
 
   // Instantiate the finder
   Finder finder(finderConfig);
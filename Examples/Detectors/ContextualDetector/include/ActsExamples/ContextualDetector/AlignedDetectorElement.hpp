@@ -17,6 +17,7 @@
 #include "ActsExamples/GenericDetector/GenericDetectorElement.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -32,15 +33,21 @@ namespace Contextual {
 ///
 /// The nominal transform is only used to once create the alignment
 /// store and then in a contextual call the actual detector element
-/// position is taken internal multi component store - the latter
-/// has to be filled though from an external source
+/// position is taken from the alignment store carried by the context,
+/// at the alignment index of this element
 class AlignedDetectorElement : public Generic::GenericDetectorElement {
  public:
+  /// The alignment store: one transform per element, by alignment index
+  using AlignmentStore = std::vector<Acts::Transform3D>;
+
   /// @class ContextType
   /// convention: nested to the Detector element
   struct ContextType {
     /// The current intervall of validity
     unsigned int iov = 0;
+    /// The alignment store version of this intervall of validity, the
+    /// shared pointer pins it for the lifetime of the context
+    std::shared_ptr<const AlignmentStore> alignmentStore = nullptr;
   };
 
   /// Constructor for an alignable surface
@@ -64,28 +71,25 @@ class AlignedDetectorElement : public Generic::GenericDetectorElement {
   const Acts::Transform3D& nominalTransform(
       const Acts::GeometryContext& gctx) const;
 
-  /// Return local to global transform associated with this identifier
+  /// Set the index of this element in the alignment store
   ///
-  /// @param alignedTransform is a new transform
-  /// @oaram iov is the batch for which it is meant
-  void addAlignedTransform(std::unique_ptr<Acts::Transform3D> alignedTransform,
-                           unsigned int iov);
+  /// @param index is the position in the AlignmentStore
+  void setAlignmentIndex(size_t index);
 
-  /// Return the set of alignment transforms in flight
-  const std::vector<std::unique_ptr<Acts::Transform3D>>& alignedTransforms()
-      const;
+  /// Return the index of this element in the alignment store
+  size_t alignmentIndex() const;
 
  private:
-  std::vector<std::unique_ptr<Acts::Transform3D>> m_alignedTransforms;
+  size_t m_alignmentIndex = 0;
 };
 
 inline const Acts::Transform3D& AlignedDetectorElement::transform(
     const Acts::GeometryContext& gctx) const {
+  // cast into the right context object
+  const auto* alignContext = std::any_cast<ContextType>(&gctx);
   // Check if a different transform than the nominal exists
-  if (m_alignedTransforms.size()) {
-    // cast into the right context object
-    auto alignContext = std::any_cast<ContextType>(gctx);
-    return (*m_alignedTransforms[alignContext.iov].get());
+  if (alignContext != nullptr and alignContext->alignmentStore != nullptr) {
+    return (*alignContext->alignmentStore)[m_alignmentIndex];
   }
   // Return the standard transform if not found
   return nominalTransform(gctx);
@@ -96,19 +100,12 @@ inline const Acts::Transform3D& AlignedDetectorElement::nominalTransform(
   return GenericDetectorElement::transform(gctx);
 }
 
-inline void AlignedDetectorElement::addAlignedTransform(
-    std::unique_ptr<Acts::Transform3D> alignedTransform, unsigned int iov) {
-  // most standard case, it's just a new one:
-  auto cios = m_alignedTransforms.size();
-  for (unsigned int ic = cios; ic <= iov; ++ic) {
-    m_alignedTransforms.push_back(nullptr);
-  }
-  m_alignedTransforms[iov] = std::move(alignedTransform);
+inline void AlignedDetectorElement::setAlignmentIndex(size_t index) {
+  m_alignmentIndex = index;
 }
 
-inline const std::vector<std::unique_ptr<Acts::Transform3D>>&
-AlignedDetectorElement::alignedTransforms() const {
-  return m_alignedTransforms;
+inline size_t AlignedDetectorElement::alignmentIndex() const {
+  return m_alignmentIndex;
 }
 
 }  // end of namespace Contextual
@@ -15,7 +15,10 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace ActsExamples {
@@ -25,8 +28,17 @@ namespace Contextual {
 /// @brief A mockup service that rotates the modules in a
 /// simple tracking geometry
 ///
-/// It acts on the PayloadDetectorElement, i.e. the
-/// geometry context carries the full transform store (payload)
+/// It acts on the AlignedDetectorElement, i.e. the geometry context
+/// carries a shared, immutable alignment store per intervall of validity.
+///
+/// The stores are published into a ring of versions, each slot points to
+/// the version of the intervall of validity it holds through an atomic.
+/// Events that find their version copy it without taking any lock. The
+/// first event of a new intervall of validity publishes the version it
+/// created with a compare-and-swap; events that lose the race use the
+/// version they created themselves, which is identical. Events pin their
+/// store through the context. A replaced version is retired and deleted
+/// once no event reads its slot anymore, nobody waits for the readers.
 class AlignmentDecorator : public IContextDecorator {
  public:
   using LayerStore = std::vector<std::shared_ptr<AlignedDetectorElement>>;
@@ -40,7 +52,8 @@ class AlignmentDecorator : public IContextDecorator {
     /// Alignment frequency - every X events
     unsigned int iovSize = 100;
 
-    /// Flush store size - garbage collection
+    /// Number of alignment versions kept published, i.e. the size of
+    /// the version ring - older versions are garbage collected
     unsigned int flushSize = 200;
 
     std::shared_ptr<RandomNumbers> randomNumberSvc = nullptr;
@@ -85,10 +98,68 @@ class AlignmentDecorator : public IContextDecorator {
   std::unique_ptr<const Acts::Logger> m_logger;  ///!< the logging instance
   std::string m_name = "AlignmentDecorator";
 
-  ///< protect multiple alignments to be loaded at once
-  std::mutex m_alignmentMutex;
-  std::vector<bool> m_iovStatus;
-  std::vector<bool> m_flushStatus;
+  using AlignmentStore = AlignedDetectorElement::AlignmentStore;
+
+  /// A published alignment store and its intervall of validity
+  struct Version {
+    unsigned int iov = 0;
+    std::shared_ptr<const AlignmentStore> store = nullptr;
+  };
+
+  /// One slot of the version ring
+  ///
+  /// The version is null for an empty slot. Readers and writers announce
+  /// themselves in the reader count before they load the version, and a
+  /// replaced version is only deleted when the count of its slot has
+  /// dropped to zero afterwards.
+  struct VersionSlot {
+    std::atomic<const Version*> version{nullptr};
+    std::atomic<unsigned int> readers{0};
+
+    ~VersionSlot() { delete version.load(); }
+  };
+
+  /// The ring of published versions, indexed by iov modulo its size
+  std::vector<VersionSlot> m_versions;
+
+  /// Replaced versions that may still be read, with their slot
+  std::vector<std::pair<const VersionSlot*, std::unique_ptr<const Version>>>
+      m_retired;
+  /// Protects the retired versions, only taken when publishing
+  std::mutex m_retiredMutex;
+
+  /// Copy the published version of an intervall of validity, if any
+  ///
+  /// @param slot is the ring slot of the intervall of validity
+  /// @param iov is the intervall of validity
+  std::shared_ptr<const AlignmentStore> readVersion(VersionSlot& slot,
+                                                    unsigned int iov) const;
+
+  /// Publish a version unless the slot holds the same or a later one
+  ///
+  /// @param slot is the ring slot of the intervall of validity
+  /// @param iov is the intervall of validity
+  /// @param store is the created alignment store
+  ///
+  /// @return whether the version was published
+  bool publishVersion(VersionSlot& slot, unsigned int iov,
+                      std::shared_ptr<const AlignmentStore> store);
+
+  /// Retire a replaced version and delete the ones nobody reads anymore
+  ///
+  /// @param slot is the ring slot the version was replaced in
+  /// @param version is the replaced version
+  void retireVersion(const VersionSlot& slot, const Version* version);
+
+  /// The number of aligned detector elements
+  size_t m_nElements = 0;
+
+  /// Create the (mis-)aligned store for an intervall of validity
+  ///
+  /// @param context is the context of the first requesting event
+  /// @param iov is the intervall of validity
+  std::shared_ptr<const AlignmentStore> createAlignmentStore(
+      const AlgorithmContext& context, unsigned int iov) const;
 
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_logger; }
@@ -10,88 +10,159 @@
 
 #include <Acts/Geometry/TrackingGeometry.hpp>
 
+#include <algorithm>
 #include <random>
 
 ActsExamples::Contextual::AlignmentDecorator::AlignmentDecorator(
     const ActsExamples::Contextual::AlignmentDecorator::Config& cfg,
     std::unique_ptr<const Acts::Logger> logger)
-    : m_cfg(cfg), m_logger(std::move(logger)) {}
+    : m_cfg(cfg),
+      m_logger(std::move(logger)),
+      m_versions(std::max(m_cfg.flushSize, 1u)) {
+  // Assign the position of each element in the alignment store
+  for (auto& lstore : m_cfg.detectorStore) {
+    for (auto& ldet : lstore) {
+      ldet->setAlignmentIndex(m_nElements++);
+    }
+  }
+}
+
+std::shared_ptr<const ActsExamples::Contextual::AlignedDetectorElement::
+                    AlignmentStore>
+ActsExamples::Contextual::AlignmentDecorator::createAlignmentStore(
+    const AlgorithmContext& context, unsigned int iov) const {
+  auto store = std::make_shared<AlignmentStore>(m_nElements);
+
+  // Create a random number generator for this iov: seeded from the first
+  // event of the iov, such that whichever event creates it the result is
+  // the same
+  AlgorithmContext iovContext(context.algorithmNumber, iov * m_cfg.iovSize,
+                              context.eventStore);
+  RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(iovContext);
+  std::normal_distribution<double> gauss(0., 1.);
+
+  for (auto& lstore : m_cfg.detectorStore) {
+    for (auto& ldet : lstore) {
+      // get the nominal transform and create a new one from it
+      Acts::Transform3D& atForm = (*store)[ldet->alignmentIndex()];
+      atForm = ldet->nominalTransform(context.geoContext);
+      if (iov != 0 or not m_cfg.firstIovNominal) {
+        // the shifts in x, y, z
+        double tx = m_cfg.gSigmaX != 0 ? m_cfg.gSigmaX * gauss(rng) : 0.;
+        double ty = m_cfg.gSigmaY != 0 ? m_cfg.gSigmaY * gauss(rng) : 0.;
+        double tz = m_cfg.gSigmaZ != 0 ? m_cfg.gSigmaZ * gauss(rng) : 0.;
+        // Add a translation - if there is any
+        if (tx != 0. or ty != 0. or tz != 0.) {
+          const auto& tMatrix = atForm.matrix();
+          auto colX = tMatrix.block<3, 1>(0, 0).transpose();
+          auto colY = tMatrix.block<3, 1>(0, 1).transpose();
+          auto colZ = tMatrix.block<3, 1>(0, 2).transpose();
+          Acts::Vector3D newCenter = tMatrix.block<3, 1>(0, 3).transpose() +
+                                     tx * colX + ty * colY + tz * colZ;
+          atForm.translation() = newCenter;
+        }
+        // now modify it - rotation around local X
+        if (m_cfg.aSigmaX != 0.) {
+          atForm *= Acts::AngleAxis3D(m_cfg.aSigmaX * gauss(rng),
+                                      Acts::Vector3D::UnitX());
+        }
+        if (m_cfg.aSigmaY != 0.) {
+          atForm *= Acts::AngleAxis3D(m_cfg.aSigmaY * gauss(rng),
+                                      Acts::Vector3D::UnitY());
+        }
+        if (m_cfg.aSigmaZ != 0.) {
+          atForm *= Acts::AngleAxis3D(m_cfg.aSigmaZ * gauss(rng),
+                                      Acts::Vector3D::UnitZ());
+        }
+      }
+    }
+  }
+  return store;
+}
+
+std::shared_ptr<const ActsExamples::Contextual::AlignedDetectorElement::
+                    AlignmentStore>
+ActsExamples::Contextual::AlignmentDecorator::readVersion(
+    VersionSlot& slot, unsigned int iov) const {
+  std::shared_ptr<const AlignmentStore> store = nullptr;
+  // announce the reader before loading the version, such that a version
+  // replaced in the meantime is not deleted before the store is copied
+  slot.readers.fetch_add(1);
+  const Version* version = slot.version.load();
+  if (version != nullptr and version->iov == iov) {
+    store = version->store;
+  }
+  slot.readers.fetch_sub(1);
+  return store;
+}
+
+bool ActsExamples::Contextual::AlignmentDecorator::publishVersion(
+    VersionSlot& slot, unsigned int iov,
+    std::shared_ptr<const AlignmentStore> store) {
+  auto version =
+      std::make_unique<const Version>(Version{iov, std::move(store)});
+  // the current version is read as well when comparing the iov
+  slot.readers.fetch_add(1);
+  const Version* current = slot.version.load();
+  bool published = false;
+  do {
+    // the slot holds this or a later iov
+    if (current != nullptr and current->iov >= iov) {
+      break;
+    }
+    published = slot.version.compare_exchange_weak(current, version.get());
+  } while (not published);
+  slot.readers.fetch_sub(1);
+  if (published) {
+    version.release();
+    retireVersion(slot, current);
+  }
+  return published;
+}
+
+void ActsExamples::Contextual::AlignmentDecorator::retireVersion(
+    const VersionSlot& slot, const Version* version) {
+  std::lock_guard<std::mutex> lock(m_retiredMutex);
+  if (version != nullptr) {
+    m_retired.emplace_back(&slot, version);
+  }
+  // every event that loaded a retired version has announced itself before
+  // the version was replaced, it has left once the count is zero
+  m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                 [](const auto& retired) {
+                                   return retired.first->readers.load() == 0;
+                                 }),
+                  m_retired.end());
+}
 
 ActsExamples::ProcessCode
 ActsExamples::Contextual::AlignmentDecorator::decorate(
     AlgorithmContext& context) {
-  // We need to lock the Decorator
-  std::lock_guard<std::mutex> alignmentLock(m_alignmentMutex);
-
   // In which iov batch are we?
   unsigned int iov = context.eventNumber / m_cfg.iovSize;
 
+  std::shared_ptr<const AlignmentStore> store = nullptr;
   if (m_cfg.randomNumberSvc != nullptr) {
+    // The slot of this iov in the version ring
+    auto& slot = m_versions[iov % m_versions.size()];
+    store = readVersion(slot, iov);
     // Detect if we have a new alignment range
-    if (m_iovStatus.size() == 0 or m_iovStatus.size() < iov or
-        !m_iovStatus[iov]) {
-      auto cios = m_iovStatus.size();
+    if (store == nullptr) {
       ACTS_VERBOSE("New IOV detected at event " << context.eventNumber
                                                 << ", emulate new alignment.");
-      ACTS_VERBOSE("New IOV identifier set to "
-                   << iov << ", curently valid: " << cios);
-
-      for (unsigned int ic = cios; ic <= iov; ++ic) {
-        m_iovStatus.push_back(false);
-      }
-
-      // Create an algorithm local random number generator
-      RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
-      std::normal_distribution<double> gauss(0., 1.);
-
-      // Are we in a gargabe collection event?
-      for (auto& lstore : m_cfg.detectorStore) {
-        for (auto& ldet : lstore) {
-          // get the nominal transform
-          auto& tForm = ldet->nominalTransform(context.geoContext);
-          // create a new transform
-          auto atForm = std::make_unique<Acts::Transform3D>(tForm);
-          if (iov != 0 or not m_cfg.firstIovNominal) {
-            // the shifts in x, y, z
-            double tx = m_cfg.gSigmaX != 0 ? m_cfg.gSigmaX * gauss(rng) : 0.;
-            double ty = m_cfg.gSigmaY != 0 ? m_cfg.gSigmaY * gauss(rng) : 0.;
-            double tz = m_cfg.gSigmaZ != 0 ? m_cfg.gSigmaZ * gauss(rng) : 0.;
-            // Add a translation - if there is any
-            if (tx != 0. or ty != 0. or tz != 0.) {
-              const auto& tMatrix = atForm->matrix();
-              auto colX = tMatrix.block<3, 1>(0, 0).transpose();
-              auto colY = tMatrix.block<3, 1>(0, 1).transpose();
-              auto colZ = tMatrix.block<3, 1>(0, 2).transpose();
-              Acts::Vector3D newCenter = tMatrix.block<3, 1>(0, 3).transpose() +
-                                         tx * colX + ty * colY + tz * colZ;
-              atForm->translation() = newCenter;
-            }
-            // now modify it - rotation around local X
-            if (m_cfg.aSigmaX != 0.) {
-              (*atForm) *= Acts::AngleAxis3D(m_cfg.aSigmaX * gauss(rng),
-                                             Acts::Vector3D::UnitX());
-            }
-            if (m_cfg.aSigmaY != 0.) {
-              (*atForm) *= Acts::AngleAxis3D(m_cfg.aSigmaY * gauss(rng),
-                                             Acts::Vector3D::UnitY());
-            }
-            if (m_cfg.aSigmaZ != 0.) {
-              (*atForm) *= Acts::AngleAxis3D(m_cfg.aSigmaZ * gauss(rng),
-                                             Acts::Vector3D::UnitZ());
-            }
-          }
-          // put it back into the store
-          ldet->addAlignedTransform(std::move(atForm), iov);
-        }
-      }
+      store = createAlignmentStore(context, iov);
+      // Publish it, unless another event is faster or the slot has already
+      // moved on to a later iov - this event then keeps its own identical
+      // version
+      bool published = publishVersion(slot, iov, store);
+      ACTS_VERBOSE("IOV identifier " << iov << (published ? " " : " not ")
+                                     << "published by this event.");
     }
-    // book keeping
-    m_iovStatus[iov] = true;
   }
-  // Set the geometry context
-  AlignedDetectorElement::ContextType alignedContext{iov};
-  context.geoContext =
-      std::make_any<AlignedDetectorElement::ContextType>(alignedContext);
+  // Set the geometry context, pinning the store version for this event
+  AlignedDetectorElement::ContextType alignedContext{iov, std::move(store)};
+  context.geoContext = std::make_any<AlignedDetectorElement::ContextType>(
+      std::move(alignedContext));
 
   return ProcessCode::SUCCESS;
 }
@@ -14,6 +14,8 @@
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <string>
+
 namespace ActsExamples {
 
 namespace BField {
@@ -220,6 +222,72 @@ fieldMapperXYZ(std::function<size_t(std::array<size_t, 3> binsXYZ,
                bool firstOctant = false);
 }  // namespace root
 
+/// Binary field map format for memory mapped, zero-copy loading.
+///
+/// A field map file (version 1) consists of
+///
+/// - a fixed-size header with a magic string, the format version, a byte
+///   order mark, the number of grid dimensions, and for each axis the number
+///   of bins and the axis limits in native units,
+/// - the field values of all grid bins, including under-/overflow bins, in
+///   global bin order as native-unit doubles, starting at an offset that is
+///   aligned to 64 bytes.
+///
+/// The values are thus stored exactly as in the grid of the field mapper.
+/// Loading maps the file read-only and the grid views the values in place,
+/// i.e. all processes on a node share the page cache copy of the map.
+/// Files are only portable between machines with the same byte order.
+namespace binary {
+
+/// Write the grid of a (Br,Bz) field mapper into a binary field map file
+///
+/// @param[in] fieldMapFile Path of the output file
+/// @param[in] grid The grid of the field mapper
+void writeFieldMap(
+    const std::string& fieldMapFile,
+    const Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                             Acts::detail::EquidistantAxis>& grid);
+
+/// Write the grid of a (Bx,By,Bz) field mapper into a binary field map file
+///
+/// @param[in] fieldMapFile Path of the output file
+/// @param[in] grid The grid of the field mapper
+void writeFieldMap(
+    const std::string& fieldMapFile,
+    const Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                             Acts::detail::EquidistantAxis,
+                             Acts::detail::EquidistantAxis>& grid);
+
+/// Read the number of grid dimensions of a binary field map file
+///
+/// @param[in] fieldMapFile Path to file containing the binary field map
+/// @return 2 for a map in (r,z), 3 for a map in (x,y,z)
+size_t fieldMapDimension(const std::string& fieldMapFile);
+
+/// Method to setup the FieldMapper from a binary (r,z) field map file
+///
+/// @param[in] fieldMapFile Path to file containing the binary field map
+///
+/// The file is memory mapped and stays mapped as long as the returned mapper
+/// or any copy of it exists.
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+fieldMapperRZ(const std::string& fieldMapFile);
+
+/// Method to setup the FieldMapper from a binary (x,y,z) field map file
+///
+/// @param[in] fieldMapFile Path to file containing the binary field map
+///
+/// The file is memory mapped and stays mapped as long as the returned mapper
+/// or any copy of it exists.
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+fieldMapperXYZ(const std::string& fieldMapFile);
+
+}  // namespace binary
+
 }  // namespace BField
 
 }  // namespace ActsExamples
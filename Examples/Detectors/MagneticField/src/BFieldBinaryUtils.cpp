@@ -0,0 +1,204 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+#include "ActsExamples/Plugins/BField/BFieldUtils.hpp"
+#include "ActsExamples/Utilities/MappedFile.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using Grid2D = Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                                  Acts::detail::EquidistantAxis>;
+using Grid3D = Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                                  Acts::detail::EquidistantAxis,
+                                  Acts::detail::EquidistantAxis>;
+
+constexpr char s_magic[8] = {'A', 'C', 'T', 'S', 'B', 'F', 'M', '\0'};
+constexpr uint32_t s_version = 1u;
+constexpr uint32_t s_byteOrderMark = 0x01020304u;
+constexpr uint64_t s_dataAlignment = 64u;
+
+/// Fixed-size file header, written and read as raw bytes.
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t nDims;
+  uint32_t nComponents;
+  uint64_t nBins[3];
+  double min[3];
+  double max[3];
+  uint64_t nValues;
+  uint64_t dataOffset;
+};
+static_assert(std::is_trivially_copyable_v<Header>,
+              "Header must be trivially copyable");
+static_assert(sizeof(Header) == 112u, "Header must not contain padding");
+static_assert(sizeof(Acts::Vector2D) == 2 * sizeof(double) and
+                  sizeof(Acts::Vector3D) == 3 * sizeof(double),
+              "Field values must be stored as packed doubles");
+
+template <typename grid_t>
+void writeGrid(const std::string& path, const grid_t& grid) {
+  using value_t = typename grid_t::value_type;
+
+  Header header{};
+  std::memcpy(header.magic, s_magic, sizeof(s_magic));
+  header.version = s_version;
+  header.byteOrderMark = s_byteOrderMark;
+  header.nDims = grid_t::DIM;
+  header.nComponents = grid_t::DIM;
+  const auto nBins = grid.numLocalBins();
+  const auto min = grid.minPosition();
+  const auto max = grid.maxPosition();
+  for (size_t i = 0; i < grid_t::DIM; ++i) {
+    header.nBins[i] = nBins[i];
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+  }
+  header.nValues = grid.size();
+  header.dataOffset =
+      ((sizeof(Header) + s_dataAlignment - 1) / s_dataAlignment) *
+      s_dataAlignment;
+
+  std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (not file) {
+    throw std::runtime_error("Could not open '" + path + "' for writing");
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  std::vector<char> padding(header.dataOffset - sizeof(Header), '\0');
+  file.write(padding.data(), padding.size());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    const value_t& value = grid.at(bin);
+    file.write(reinterpret_cast<const char*>(value.data()), sizeof(value_t));
+  }
+  if (not file) {
+    throw std::runtime_error("Could not write field map to '" + path + "'");
+  }
+}
+
+/// Check the header for consistency with itself and with the file size.
+void checkHeader(const Header& header, const std::string& path,
+                 uint64_t fileSize) {
+  if (std::memcmp(header.magic, s_magic, sizeof(s_magic)) != 0) {
+    throw std::runtime_error("'" + path + "' is not a binary field map");
+  }
+  if (header.version != s_version) {
+    throw std::runtime_error("Unsupported binary field map version " +
+                             std::to_string(header.version) + " in '" + path +
+                             "'");
+  }
+  if (header.byteOrderMark != s_byteOrderMark) {
+    throw std::runtime_error("Binary field map '" + path +
+                             "' was written with a different byte order");
+  }
+  if ((header.nDims != 2u and header.nDims != 3u) or
+      (header.nComponents != header.nDims)) {
+    throw std::runtime_error("Invalid dimensions in binary field map '" +
+                             path + "'");
+  }
+  uint64_t nValues = 1u;
+  for (uint32_t i = 0; i < header.nDims; ++i) {
+    nValues *= header.nBins[i] + 2u;
+  }
+  const uint64_t nBytes = header.nValues * header.nComponents * sizeof(double);
+  if ((header.nValues != nValues) or
+      (header.dataOffset % s_dataAlignment != 0u) or
+      (fileSize < header.dataOffset + nBytes)) {
+    throw std::runtime_error("Inconsistent or truncated binary field map '" +
+                             path + "'");
+  }
+}
+
+/// Map the file read-only and verify its header.
+///
+/// The returned pointer owns the mapping which is released together with the
+/// last copy of the pointer.
+std::shared_ptr<const char> mapFieldMap(const std::string& path,
+                                        uint32_t nDims, Header& header) {
+  auto file = ActsExamples::mapFile(path);
+  if (file.size < sizeof(Header)) {
+    throw std::runtime_error("Could not read binary field map '" + path + "'");
+  }
+  std::memcpy(&header, file.data.get(), sizeof(Header));
+  checkHeader(header, path, file.size);
+  if (header.nDims != nDims) {
+    throw std::runtime_error("Binary field map '" + path + "' has " +
+                             std::to_string(header.nDims) +
+                             " dimensions instead of " +
+                             std::to_string(nDims));
+  }
+  return std::move(file.data);
+}
+
+Acts::detail::EquidistantAxis makeAxis(const Header& header, size_t i) {
+  return Acts::detail::EquidistantAxis(header.min[i], header.max[i],
+                                       header.nBins[i]);
+}
+
+}  // namespace
+
+void ActsExamples::BField::binary::writeFieldMap(
+    const std::string& fieldMapFile, const Grid2D& grid) {
+  writeGrid(fieldMapFile, grid);
+}
+
+void ActsExamples::BField::binary::writeFieldMap(
+    const std::string& fieldMapFile, const Grid3D& grid) {
+  writeGrid(fieldMapFile, grid);
+}
+
+size_t ActsExamples::BField::binary::fieldMapDimension(
+    const std::string& fieldMapFile) {
+  std::ifstream file(fieldMapFile, std::ios::in | std::ios::binary);
+  Header header{};
+  if (not file.read(reinterpret_cast<char*>(&header), sizeof(Header))) {
+    throw std::runtime_error("Could not read binary field map '" +
+                             fieldMapFile + "'");
+  }
+  file.seekg(0, std::ios::end);
+  checkHeader(header, fieldMapFile, file.tellg());
+  return header.nDims;
+}
+
+Acts::InterpolatedBFieldMapper<Grid2D>
+ActsExamples::BField::binary::fieldMapperRZ(const std::string& fieldMapFile) {
+  Header header{};
+  auto data = mapFieldMap(fieldMapFile, 2u, header);
+  // aliasing pointer that shares the ownership of the mapping
+  std::shared_ptr<const Acts::Vector2D> values(
+      data,
+      reinterpret_cast<const Acts::Vector2D*>(data.get() + header.dataOffset));
+  Grid2D grid(std::make_tuple(makeAxis(header, 0), makeAxis(header, 1)),
+              std::move(values));
+  return Acts::fieldMapperRZ(std::move(grid));
+}
+
+Acts::InterpolatedBFieldMapper<Grid3D>
+ActsExamples::BField::binary::fieldMapperXYZ(const std::string& fieldMapFile) {
+  Header header{};
+  auto data = mapFieldMap(fieldMapFile, 3u, header);
+  // aliasing pointer that shares the ownership of the mapping
+  std::shared_ptr<const Acts::Vector3D> values(
+      data,
+      reinterpret_cast<const Acts::Vector3D*>(data.get() + header.dataOffset));
+  Grid3D grid(std::make_tuple(makeAxis(header, 0), makeAxis(header, 1),
+                              makeAxis(header, 2)),
+              std::move(values));
+  return Acts::fieldMapperXYZ(std::move(grid));
+}
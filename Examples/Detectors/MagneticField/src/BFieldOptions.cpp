@@ -45,7 +45,8 @@ namespace Options {
 void addBFieldOptions(boost::program_options::options_description& opt) {
   opt.add_options()("bf-map", po::value<std::string>()->default_value(""),
                     "Set this string to point to the bfield source file."
-                    "That can either be a '.txt', a '.csv' or a '.root' file. "
+                    "That can either be a '.txt', a '.csv', a '.root' or a "
+                    "binary '.bfmap' file. "
                     "Omit for a constant magnetic field.")(
       "bf-name", po::value<std::string>()->default_value("bField"),
       "In case your field map file is given in root format, please specify "
@@ -85,7 +86,7 @@ void addBFieldOptions(boost::program_options::options_description& opt) {
 BFieldVariant readBField(const boost::program_options::variables_map& vm) {
   std::string bfieldmap = "constfield";
 
-  enum BFieldMapType { constant = 0, root = 1, text = 2 };
+  enum BFieldMapType { constant = 0, root = 1, text = 2, binary = 3 };
 
   std::shared_ptr<InterpolatedBFieldMap2D> map2D = nullptr;
   std::shared_ptr<InterpolatedBFieldMap3D> map3D = nullptr;
@@ -104,9 +105,12 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
                bfieldmap.find(".csv") != std::string::npos) {
       std::cout << "- txt format for magnetic field detected" << std::endl;
       bfieldmaptype = text;
+    } else if (bfieldmap.find(".bfmap") != std::string::npos) {
+      std::cout << "- binary format for magnetic field detected" << std::endl;
+      bfieldmaptype = binary;
     } else {
       std::cout << "- magnetic field format could not be detected";
-      std::cout << " use '.root', '.txt', or '.csv'." << std::endl;
+      std::cout << " use '.root', '.txt', '.csv', or '.bfmap'." << std::endl;
       throw std::runtime_error("Invalid BField options");
     }
   }
@@ -115,7 +119,8 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
               << vm["bf-gridpoints"].template as<size_t>() << std::endl;
   }
   double lscalor = 1.;
-  if (bfieldmaptype != constant && vm.count("bf-lscalor")) {
+  if (bfieldmaptype != constant && bfieldmaptype != binary &&
+      vm.count("bf-lscalor")) {
     lscalor = vm["bf-lscalor"].template as<double>();
     std::cout << "- length scalor to mm set to: " << lscalor << std::endl;
   }
@@ -125,12 +130,18 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
     std::cout << "- BField (scalor to/in) Tesla set to: " << bscalor
               << std::endl;
   }
-  if (bfieldmaptype != constant && vm["bf-rz"].template as<bool>())
+  if (bfieldmaptype == binary) {
+    std::cout << "- binary BField maps are stored in native lengths and "
+                 "coordinates, the length scalor, coordinate, and octant "
+                 "options are ignored"
+              << std::endl;
+  } else if (bfieldmaptype != constant && vm["bf-rz"].template as<bool>())
     std::cout << "- BField map is given in 'rz' coordiantes." << std::endl;
   else if (bfieldmaptype != constant)
     std::cout << "- BField map is given in 'xyz' coordiantes." << std::endl;
 
-  if (bfieldmaptype != constant && vm["bf-foctant"].template as<bool>()) {
+  if (bfieldmaptype != constant && bfieldmaptype != binary &&
+      vm["bf-foctant"].template as<bool>()) {
     std::cout
         << "- Only the first octant/quadrant is given, bField map will be "
            "symmetrically created for all other octants/quadrants"
@@ -206,6 +217,20 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
       // create BField service
       return std::make_shared<InterpolatedBFieldMap3D>(std::move(config3D));
     }
+  } else if (bfieldmaptype == binary) {
+    // the binary map is memory mapped and viewed in place
+    const auto& file = vm["bf-map"].template as<std::string>();
+    if (ActsExamples::BField::binary::fieldMapDimension(file) == 2u) {
+      InterpolatedBFieldMap2D::Config config2D(
+          ActsExamples::BField::binary::fieldMapperRZ(file));
+      config2D.scale = bscalor;
+      return std::make_shared<InterpolatedBFieldMap2D>(std::move(config2D));
+    } else {
+      InterpolatedBFieldMap3D::Config config3D(
+          ActsExamples::BField::binary::fieldMapperXYZ(file));
+      config3D.scale = bscalor;
+      return std::make_shared<InterpolatedBFieldMap3D>(std::move(config3D));
+    }
   } else {  // constant
     // No bfield map is handed over
     // get the constant bField values
@@ -26,14 +26,26 @@
 #include "ActsExamples/TGeoDetector/BuildTGeoDetector.hpp"
 #include "ActsExamples/TGeoDetector/TGeoDetectorOptions.hpp"
 
+#include <functional>
 #include <list>
 #include <vector>
 
 #include "TGeoManager.h"
+#include "TROOT.h"
 
 namespace ActsExamples {
 namespace TGeo {
 
+namespace detail {
+
+/// Run the tasks with the given indices concurrently.
+///
+/// @param nTasks is the number of tasks
+/// @param func is called once for every index in [0, nTasks)
+void parallelFor(size_t nTasks, const std::function<void(size_t)>& func);
+
+}  // namespace detail
+
 /// @brief global method to build the generic tracking geometry
 // from a TGeo object.
 ///
@@ -131,6 +143,12 @@ std::shared_ptr<const Acts::TrackingGeometry> buildTGeoDetector(
   auto layerBuilderConfigs =
       ActsExamples::Options::readTGeoLayerBuilderConfigs<variable_maps_t>(vm);
 
+  // Parse and convert in parallel, the branches are merged in order
+  bool parallel = vm["geo-tgeo-parallel"].template as<bool>();
+  if (parallel) {
+    ROOT::EnableThreadSafety();
+  }
+
   // remember the layer builders to collect the detector elements
   std::vector<std::shared_ptr<const Acts::TGeoLayerBuilder>> tgLayerBuilders;
 
@@ -168,6 +186,9 @@ std::shared_ptr<const Acts::TrackingGeometry> buildTGeoDetector(
         (layerCreatorLB != nullptr) ? layerCreatorLB : layerCreator;
     lbc.protoLayerHelper =
         (protoLayerHelperLB != nullptr) ? protoLayerHelperLB : protoLayerHelper;
+    if (parallel) {
+      lbc.executor = detail::parallelFor;
+    }
 
     auto layerBuilder = std::make_shared<const Acts::TGeoLayerBuilder>(
         lbc, Acts::getDefaultLogger(lbc.configurationName + "LayerBuilder",
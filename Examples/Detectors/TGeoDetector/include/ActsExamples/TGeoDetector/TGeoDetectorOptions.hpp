@@ -39,6 +39,8 @@ void addTGeoGeometryOptions(options_t& opt) {
       "Root world volume to start search from.")(
       "geo-tgeo-unit-scalor", po::value<double>()->default_value(10.),
       "Unit scalor from ROOT to Acts.")(
+      "geo-tgeo-parallel", po::bool_switch(),
+      "Parse the TGeo tree and convert the sensitive surfaces in parallel.")(
       "geo-tgeo-bp-parameters",
       po::value<read_range>()->multitoken()->default_value({}),
       "Potential beam pipe parameters {r, z, t} in [mm].")(
@@ -14,6 +14,13 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/TGeoDetector/BuildTGeoDetector.hpp"
 
+#include <tbb/tbb.h>
+
+void ActsExamples::TGeo::detail::parallelFor(
+    size_t nTasks, const std::function<void(size_t)>& func) {
+  tbb::parallel_for(size_t(0), nTasks, func);
+}
+
 void TGeoDetector::addOptions(
     boost::program_options::options_description& opt) const {
   ActsExamples::Options::addTGeoGeometryOptions(opt);
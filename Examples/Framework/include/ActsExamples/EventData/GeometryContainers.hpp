@@ -13,8 +13,12 @@
 #include "ActsExamples/Utilities/Range.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -86,6 +90,98 @@ using GeometryIdMultiset =
 template <typename T>
 using GeometryIdMultimap = GeometryIdMultiset<std::pair<Acts::GeometryID, T>>;
 
+namespace detail {
+/// Stable radix sort of the element indices by geometry id.
+///
+/// @return the index of the element at each position of the sorted sequence
+template <typename index_t, typename sequence_t>
+std::vector<index_t> sortedIndicesByGeometryId(const sequence_t& sequence) {
+  constexpr unsigned int kBits = 8u;
+  constexpr std::size_t kBuckets = 1u << kBits;
+
+  const std::size_t size = sequence.size();
+  std::vector<index_t> order(size);
+  std::vector<index_t> sorted(size);
+  // the digit of every position for the current pass, such that each pass
+  // reads the elements only once
+  std::vector<uint8_t> digits(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    order[i] = i;
+  }
+
+  for (unsigned int shift = 0; shift < 8 * sizeof(Acts::GeometryID::Value);
+       shift += kBits) {
+    std::array<std::size_t, kBuckets> offsets = {};
+    for (std::size_t i = 0; i < size; ++i) {
+      digits[i] = (GeometryIdGetter()(sequence[order[i]]).value() >> shift) &
+                  (kBuckets - 1u);
+      ++offsets[digits[i]];
+    }
+    // all elements are in the same bucket, i.e. nothing to sort
+    if (std::find(offsets.begin(), offsets.end(), size) != offsets.end()) {
+      continue;
+    }
+    std::size_t sum = 0;
+    for (auto& offset : offsets) {
+      sum += std::exchange(offset, sum);
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+      sorted[offsets[digits[i]]++] = order[i];
+    }
+    std::swap(order, sorted);
+  }
+  return order;
+}
+
+/// Move the elements of a sequence to their sorted positions in-place.
+///
+/// @param sequence is the sequence to permute
+/// @param order is the index of the element at each sorted position, it is
+///              reset to the identity while the cycles are followed
+template <typename index_t, typename sequence_t>
+void applySortedIndices(sequence_t& sequence, std::vector<index_t>& order) {
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if (order[i] == i) {
+      continue;
+    }
+    auto first = std::move(sequence[i]);
+    std::size_t j = i;
+    while (true) {
+      const std::size_t k = std::exchange(order[j], j);
+      if (k == i) {
+        break;
+      }
+      sequence[j] = std::move(sequence[k]);
+      j = k;
+    }
+    sequence[j] = std::move(first);
+  }
+}
+}  // namespace detail
+
+/// Stable sort of a sequence of elements by their geometry id.
+///
+/// @param sequence is a random access container with elements that are
+///                 compatible with `CompareGeometryId`
+///
+/// This is a least-significant-digit radix sort over the bytes of the encoded
+/// geometry ids that skips bytes that are identical for all elements. Only
+/// 32bit element indices are sorted, the elements are permuted in-place
+/// afterwards. The temporary memory is about 9 bytes per element, i.e. well
+/// below the size of e.g. a simulated hit. Elements with the same geometry id
+/// keep their order. The sorted sequence can be adopted by a
+/// `GeometryIdMultiset` as an ordered range without sorting it again.
+template <typename sequence_t>
+void sortByGeometryId(sequence_t& sequence) {
+  if (sequence.size() <= std::numeric_limits<uint32_t>::max()) {
+    auto order = detail::sortedIndicesByGeometryId<uint32_t>(sequence);
+    detail::applySortedIndices(sequence, order);
+  } else {
+    auto order = detail::sortedIndicesByGeometryId<std::size_t>(sequence);
+    detail::applySortedIndices(sequence, order);
+  }
+}
+
 /// Select all elements within the given volume.
 template <typename T>
 inline Range<typename GeometryIdMultiset<T>::const_iterator> selectVolume(
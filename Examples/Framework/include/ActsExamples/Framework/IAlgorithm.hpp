@@ -12,6 +12,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -28,6 +29,13 @@ class IAlgorithm {
 
   /// Execute the algorithm for one event.
   virtual ProcessCode execute(const AlgorithmContext& context) const = 0;
+
+  /// The output collections whose containers can be reused.
+  ///
+  /// These are kept emptied when the event store is recycled. The algorithm
+  /// should then take them via `WhiteBoard::recycled` to fill them for the
+  /// next event. By default, no output is reused.
+  virtual std::vector<std::string> reusableOutputs() const { return {}; }
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,135 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ActsExamples {
+
+/// Counter-based Philox4x32-10 random number engine.
+///
+/// The engine output is a bijective function of a 64 bit key and a 128 bit
+/// counter (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+/// SC11). Its complete state is the key, the counter and the position in the
+/// current output block, i.e. a few words instead of the 2.5 kB of the
+/// Mersenne Twister, and a new stream is set up in constant time.
+///
+/// The upper half of the counter selects the stream, the lower half counts
+/// the generated blocks within that stream. Engines with the same key and
+/// different stream indices are statistically independent, such that work
+/// within an event can be distributed in any order and still give the same
+/// random numbers for every index.
+///
+/// The engine fulfills the UniformRandomBitGenerator requirements and can be
+/// used with all standard library distributions.
+class PhiloxRandomEngine {
+ public:
+  using result_type = uint32_t;
+
+  /// Construct an engine for a given key and stream
+  ///
+  /// @param key The key, e.g. an event and algorithm specific seed
+  /// @param stream The index of the stream for this key
+  explicit PhiloxRandomEngine(uint64_t key = 0u, uint64_t stream = 0u)
+      : m_key{static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)},
+        m_counter{0u, 0u, static_cast<uint32_t>(stream),
+                  static_cast<uint32_t>(stream >> 32)} {}
+
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Generate the next random number
+  result_type operator()() {
+    if (m_position == 4u) {
+      m_block = generateBlock(m_counter, m_key);
+      incrementCounter();
+      m_position = 0u;
+    }
+    return m_block[m_position++];
+  }
+
+  /// Skip the next n random numbers in constant time
+  void discard(uint64_t n) {
+    const uint64_t buffered = 4u - m_position;
+    if (n <= buffered) {
+      m_position += n;
+      return;
+    }
+    n -= buffered;
+    // Skip whole blocks and regenerate the one the next number is taken from
+    uint64_t blocks = n / 4u;
+    uint64_t low = (static_cast<uint64_t>(m_counter[1]) << 32) | m_counter[0];
+    low += blocks;
+    m_counter[0] = static_cast<uint32_t>(low);
+    m_counter[1] = static_cast<uint32_t>(low >> 32);
+    m_position = 4u;
+    if (n % 4u != 0u) {
+      (*this)();
+      m_position = n % 4u;
+    }
+  }
+
+  /// The Philox4x32-10 bijection from a counter and a key to four numbers
+  ///
+  /// @param counter The 128 bit counter
+  /// @param key The 64 bit key
+  static std::array<uint32_t, 4> generateBlock(
+      std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    for (unsigned int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += s_weyl0;
+        key[1] += s_weyl1;
+      }
+      const uint64_t product0 =
+          static_cast<uint64_t>(s_multiplier0) * counter[0];
+      const uint64_t product1 =
+          static_cast<uint64_t>(s_multiplier1) * counter[2];
+      counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                 static_cast<uint32_t>(product1),
+                 static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                 static_cast<uint32_t>(product0)};
+    }
+    return counter;
+  }
+
+  friend bool operator==(const PhiloxRandomEngine& lhs,
+                         const PhiloxRandomEngine& rhs) {
+    return lhs.m_key == rhs.m_key and lhs.m_counter == rhs.m_counter and
+           lhs.m_position == rhs.m_position;
+  }
+  friend bool operator!=(const PhiloxRandomEngine& lhs,
+                         const PhiloxRandomEngine& rhs) {
+    return not(lhs == rhs);
+  }
+
+ private:
+  static constexpr uint32_t s_multiplier0 = 0xD2511F53u;
+  static constexpr uint32_t s_multiplier1 = 0xCD9E8D57u;
+  static constexpr uint32_t s_weyl0 = 0x9E3779B9u;
+  static constexpr uint32_t s_weyl1 = 0xBB67AE85u;
+
+  /// Advance the block counter within the stream, i.e. the lower 64 bits
+  void incrementCounter() {
+    if (++m_counter[0] == 0u) {
+      ++m_counter[1];
+    }
+  }
+
+  std::array<uint32_t, 2> m_key;
+  std::array<uint32_t, 4> m_counter;
+  std::array<uint32_t, 4> m_block = {};
+  // Position of the next number in the block, 4 if it must be regenerated
+  unsigned int m_position = 4u;
+};
+
+}  // namespace ActsExamples
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxRandomEngine.hpp"
 
 #include <cstdint>
 #include <random>
@@ -25,6 +26,8 @@ namespace ActsExamples {
 
 /// The random number generator used in the framework.
 using RandomEngine = std::mt19937;  ///< Mersenne Twister
+/// The counter-based generator used for independent streams within an event.
+using StreamRandomEngine = PhiloxRandomEngine;
 
 /// Provide event and algorithm specific random number generator.s
 ///
@@ -54,6 +57,20 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a generator for one of many independent streams within an event.
+  ///
+  /// The generator is counter-based and set up in constant time, such that
+  /// one can be spawned e.g. for every particle or track. The numbers of a
+  /// stream only depend on the seed, the event, the algorithm, and the
+  /// stream index, but not on the order in which the streams are used.
+  /// Work within an event can hence be split across threads and remains
+  /// reproducible.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param index is the index of the stream, e.g. a particle index
+  StreamRandomEngine spawnGenerator(const AlgorithmContext& context,
+                                    uint64_t index) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
@@ -41,6 +41,9 @@ class Sequencer {
     int numThreads = -1;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// number of events to read ahead in a separate reader stage, 0 to read
+    /// each event within the event loop
+    size_t prefetchEvents = 0;
   };
 
   Sequencer(const Config& cfg);
@@ -92,6 +95,11 @@ class Sequencer {
   /// This will run the start-of-run hook for all configured services, run all
   /// configured readers, algorithms, and writers for each event, then invoke
   /// the end-of-run hook for all configured writers.
+  ///
+  /// If prefetching is enabled, the services, context decorators, and
+  /// readers run for one event after another on a dedicated reader thread.
+  /// The prepared events are handed to the algorithms and writers through a
+  /// queue that holds at most the configured number of events.
   int run();
 
  private:
@@ -16,6 +16,7 @@
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace ActsExamples {
@@ -26,6 +27,10 @@ namespace ActsExamples {
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the liftime of the white board.
+///
+/// A white board can be cleared to process another event. Selected objects
+/// are then only emptied and can be taken back by their producer, such that
+/// their allocated memory is reused for the next event.
 class WhiteBoard {
  public:
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
@@ -51,12 +56,39 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Take the emptied object that was stored in a previous event.
+  ///
+  /// @param name Identifier the object was stored under
+  /// @return the emptied object, or a default-constructed one if there is
+  ///         no reusable object of the requested type
+  ///
+  /// The returned object keeps the memory it allocated previously. It should
+  /// be filled and stored under the same name again.
+  template <typename T>
+  T recycled(const std::string& name);
+
+  /// Remove all objects to prepare the white board for another event.
+  ///
+  /// @param reusable Identifiers of the objects that are kept emptied
+  ///
+  /// Objects are only kept if they can be emptied via `clear()`.
+  void clear(const std::unordered_set<std::string>& reusable = {});
+
  private:
   // type-erased value holder for move-constructible types
   struct IHolder {
     virtual ~IHolder() = default;
     virtual const std::type_info& type() const = 0;
+    /// Empty the value for reuse, false if this is not possible.
+    virtual bool clear() = 0;
+    /// Whether the value is stored or only kept for reuse.
+    bool stored = true;
   };
+  template <typename T, typename = void>
+  struct HasClear : std::false_type {};
+  template <typename T>
+  struct HasClear<T, std::void_t<decltype(std::declval<T&>().clear())>>
+      : std::true_type {};
   template <typename T,
             typename =
                 std::enable_if_t<std::is_nothrow_move_constructible<T>::value>>
@@ -65,6 +97,14 @@ class WhiteBoard {
 
     HolderT(T&& v) : value(std::move(v)) {}
     const std::type_info& type() const { return typeid(T); }
+    bool clear() {
+      if constexpr (HasClear<T>::value and std::is_move_assignable_v<T>) {
+        value.clear();
+        return true;
+      } else {
+        return false;
+      }
+    }
   };
 
   std::unique_ptr<const Acts::Logger> m_logger;
@@ -84,17 +124,32 @@ inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (0 < m_store.count(name)) {
+  auto it = m_store.find(name);
+  if (it == m_store.end()) {
+    m_store.emplace(name,
+                    std::make_unique<HolderT<T>>(std::forward<T>(object)));
+  } else if (it->second->stored) {
     throw std::invalid_argument("Object '" + name + "' already exists");
+  } else if constexpr (std::is_move_assignable_v<T>) {
+    if (typeid(T) == it->second->type()) {
+      // reuse the holder of the object kept from the previous event
+      auto* holder = static_cast<HolderT<T>*>(it->second.get());
+      holder->value = std::forward<T>(object);
+      holder->stored = true;
+    } else {
+      it->second = std::make_unique<HolderT<T>>(std::forward<T>(object));
+    }
+  } else {
+    // only move-assignable objects are kept for reuse, see HolderT::clear
+    it->second = std::make_unique<HolderT<T>>(std::forward<T>(object));
   }
-  m_store.emplace(name, std::make_unique<HolderT<T>>(std::forward<T>(object)));
   ACTS_VERBOSE("Added object '" << name << "'");
 }
 
 template <typename T>
 inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
   auto it = m_store.find(name);
-  if (it == m_store.end()) {
+  if (it == m_store.end() or not it->second->stored) {
     throw std::out_of_range("Object '" + name + "' does not exists");
   }
   const IHolder* holder = it->second.get();
@@ -104,3 +159,26 @@ inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
   ACTS_VERBOSE("Retrieved object '" << name << "'");
   return reinterpret_cast<const HolderT<T>*>(holder)->value;
 }
+
+template <typename T>
+inline T ActsExamples::WhiteBoard::recycled(const std::string& name) {
+  auto it = m_store.find(name);
+  if (it == m_store.end() or it->second->stored or
+      typeid(T) != it->second->type()) {
+    return T();
+  }
+  ACTS_VERBOSE("Recycled object '" << name << "'");
+  return std::move(static_cast<HolderT<T>*>(it->second.get())->value);
+}
+
+inline void ActsExamples::WhiteBoard::clear(
+    const std::unordered_set<std::string>& reusable) {
+  for (auto it = m_store.begin(); it != m_store.end();) {
+    if ((0 < reusable.count(it->first)) and it->second->clear()) {
+      it->second->stored = false;
+      ++it;
+    } else {
+      it = m_store.erase(it);
+    }
+  }
+}
@@ -0,0 +1,35 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+
+/// A read-only memory mapping of a complete file.
+///
+/// The mapping is released together with the last copy of the data pointer,
+/// i.e. aliasing pointers into the mapped data keep it alive.
+struct MappedFile {
+  /// The start of the mapped file content
+  std::shared_ptr<const char> data;
+  /// The size of the file in bytes
+  size_t size = 0;
+};
+
+/// Map a file read-only into memory.
+///
+/// @param path The path of the file
+///
+/// @note Throws std::runtime_error if the file can not be opened or mapped
+MappedFile mapFile(const std::string& path);
+
+}  // namespace ActsExamples
@@ -23,6 +23,11 @@ ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
   return RandomEngine(generateSeed(context));
 }
 
+ActsExamples::StreamRandomEngine ActsExamples::RandomNumbers::spawnGenerator(
+    const AlgorithmContext& context, uint64_t index) const {
+  return StreamRandomEngine(generateSeed(context), index);
+}
+
 uint64_t ActsExamples::RandomNumbers::generateSeed(
     const AlgorithmContext& context) const {
   // use Cantor pairing function to generate a unique generator id from
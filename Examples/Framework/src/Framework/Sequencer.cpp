@@ -13,9 +13,13 @@
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <unordered_set>
 
 #include <TROOT.h>
 #include <dfe/dfe_io_dsv.hpp>
@@ -223,6 +227,58 @@ void storeTiming(const std::vector<std::string>& identifiers,
     writer.append(info);
   }
 }
+/// Event stores that are recycled between events.
+///
+/// Stores are only created if all existing ones are in use, i.e. the number
+/// of stores is the largest number of events processed at the same time.
+class EventStorePool {
+ public:
+  /// Return the event store to the pool.
+  struct Release {
+    EventStorePool* pool;
+    void operator()(ActsExamples::WhiteBoard* store) const {
+      pool->release(store);
+    }
+  };
+  using Handle = std::unique_ptr<ActsExamples::WhiteBoard, Release>;
+
+  /// @param reusable Outputs that are kept emptied for the next event
+  /// @param level Logging level of the event stores
+  EventStorePool(std::unordered_set<std::string> reusable,
+                 Acts::Logging::Level level)
+      : m_reusable(std::move(reusable)), m_level(level) {}
+
+  /// Get a free event store or create a new one.
+  Handle acquire() {
+    ActsExamples::WhiteBoard* store = nullptr;
+    if (not m_free.try_pop(store)) {
+      std::lock_guard<std::mutex> lock(m_storesMutex);
+      auto name = "EventStore#" + std::to_string(m_stores.size());
+      m_stores.push_back(std::make_unique<ActsExamples::WhiteBoard>(
+          Acts::getDefaultLogger(name, m_level)));
+      store = m_stores.back().get();
+    }
+    return Handle(store, Release{this});
+  }
+
+  /// The number of event stores created so far.
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(m_storesMutex);
+    return m_stores.size();
+  }
+
+ private:
+  void release(ActsExamples::WhiteBoard* store) {
+    store->clear(m_reusable);
+    m_free.push(store);
+  }
+
+  std::unordered_set<std::string> m_reusable;
+  Acts::Logging::Level m_level;
+  mutable std::mutex m_storesMutex;
+  std::vector<std::unique_ptr<ActsExamples::WhiteBoard>> m_stores;
+  tbb::concurrent_queue<ActsExamples::WhiteBoard*> m_free;
+};
 }  // namespace
 
 int ActsExamples::Sequencer::run() {
@@ -257,67 +313,198 @@ int ActsExamples::Sequencer::run() {
     service->startRun();
   }
 
+  // prepare the event store and the context, i.e. everything up to and
+  // including the readers.
+  auto readEvent = [&](AlgorithmContext& context,
+                       std::vector<Duration>& localClocksAlgorithms) {
+    size_t ialgo = 0;
+    // Prepare event store w/ service information
+    for (auto& service : m_services) {
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      service->prepare(++context);
+    }
+    /// Decorate the context
+    for (auto& cdr : m_decorators) {
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to decorate event context");
+      }
+    }
+    // Read everything in
+    for (auto& rdr : m_readers) {
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (rdr->read(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to read input data");
+      }
+    }
+  };
+  // process a prepared event, i.e. run the algorithms and writers.
+  auto processEvent = [&](AlgorithmContext& context,
+                          std::vector<Duration>& localClocksAlgorithms) {
+    size_t ialgo = m_services.size() + m_decorators.size() + m_readers.size();
+    // Execute all algorithms
+    for (auto& alg : m_algorithms) {
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (alg->execute(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    }
+    // Write out results
+    for (auto& wrt : m_writers) {
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (wrt->write(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write output data");
+      }
+    }
+    ACTS_INFO("finished event " << context.eventNumber);
+  };
+  // add timing info to global information
+  auto addClocks = [&](const std::vector<Duration>& localClocksAlgorithms) {
+    tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+    for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+      clocksAlgorithms[i] += localClocksAlgorithms[i];
+    }
+  };
+
+  // event stores are recycled and keep the outputs that can be reused
+  std::unordered_set<std::string> reusableOutputs;
+  for (const auto& alg : m_algorithms) {
+    for (auto& output : alg->reusableOutputs()) {
+      reusableOutputs.insert(std::move(output));
+    }
+  }
+  EventStorePool eventStores(std::move(reusableOutputs), m_cfg.logLevel);
+
   // execute the parallel event loop
   tbb::task_scheduler_init init(m_cfg.numThreads);
-  tbb::parallel_for(
-      tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-      [&](const tbb::blocked_range<size_t>& r) {
-        std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                    Duration::zero());
-
-        for (size_t event = r.begin(); event != r.end(); ++event) {
-          // Use per-event store
-          WhiteBoard eventStore(Acts::getDefaultLogger(
-              "EventStore#" + std::to_string(event), m_cfg.logLevel));
-          // If we ever wanted to run algorithms in parallel, this needs to be
-          // changed to Algorithm context copies
-          AlgorithmContext context(0, event, eventStore);
-          size_t ialgo = 0;
-
-          // Prepare event store w/ service information
-          for (auto& service : m_services) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            service->prepare(++context);
-          }
-          /// Decorate the context
-          for (auto& cdr : m_decorators) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to decorate event context");
-            }
-          }
-          // Read everything in
-          for (auto& rdr : m_readers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (rdr->read(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to read input data");
-            }
-          }
-          // Execute all algorithms
-          for (auto& alg : m_algorithms) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (alg->execute(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to process event data");
-            }
-          }
-          // Write out results
-          for (auto& wrt : m_writers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (wrt->write(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to write output data");
-            }
+  if (m_cfg.prefetchEvents == 0u) {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
+        [&](const tbb::blocked_range<size_t>& r) {
+          std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                      Duration::zero());
+
+          for (size_t event = r.begin(); event != r.end(); ++event) {
+            // Use a recycled per-event store
+            auto eventStore = eventStores.acquire();
+            // If we ever wanted to run algorithms in parallel, this needs to
+            // be changed to Algorithm context copies
+            AlgorithmContext context(0, event, *eventStore);
+            readEvent(context, localClocksAlgorithms);
+            processEvent(context, localClocksAlgorithms);
           }
-          ACTS_INFO("finished event " << event);
-        }
 
-        // add timing info to global information
-        {
-          tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-          for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-            clocksAlgorithms[i] += localClocksAlgorithms[i];
-          }
+          addClocks(localClocksAlgorithms);
+        });
+  } else {
+    // an event prepared by the reader stage
+    struct PrefetchedEvent {
+      EventStorePool::Handle eventStore;
+      AlgorithmContext context;
+    };
+    // a missing event signals that the reader stage failed
+    tbb::concurrent_bounded_queue<std::unique_ptr<PrefetchedEvent>> queue;
+    queue.set_capacity(m_cfg.prefetchEvents);
+    std::atomic<bool> cancelled(false);
+    std::atomic<bool> readerDone(false);
+    std::exception_ptr readerError;
+    // waiting times of the reader and the workers and the number of prepared
+    // events that were waiting in the queue whenever a worker requested one
+    Duration readerStall = Duration::zero();
+    Duration workerStall = Duration::zero();
+    size_t occupancySum = 0;
+    size_t occupancyMax = 0;
+
+    std::thread reader([&]() {
+      std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                  Duration::zero());
+      size_t event = eventsRange.first;
+      try {
+        for (; (event < eventsRange.second) and not cancelled; ++event) {
+          auto eventStore = eventStores.acquire();
+          WhiteBoard& store = *eventStore;
+          auto prefetched = std::make_unique<PrefetchedEvent>(
+              PrefetchedEvent{std::move(eventStore),
+                              AlgorithmContext(0, event, store)});
+          readEvent(prefetched->context, localClocksAlgorithms);
+          StopWatch sw(readerStall);
+          queue.push(std::move(prefetched));
+        }
+      } catch (...) {
+        readerError = std::current_exception();
+        // every worker that still waits for an event must receive one
+        for (; (event < eventsRange.second) and not cancelled; ++event) {
+          queue.push(nullptr);
         }
-      });
+      }
+      addClocks(localClocksAlgorithms);
+      readerDone = true;
+    });
+
+    try {
+      // every task processes exactly one event, which is the next prepared
+      // one and not necessarily the one with the iteration number. thus, no
+      // task waits for an event that is not going to be read.
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second,
+                                     1u),
+          [&](const tbb::blocked_range<size_t>& r) {
+            std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                        Duration::zero());
+            Duration localStall = Duration::zero();
+            size_t localOccupancySum = 0;
+            size_t localOccupancyMax = 0;
+
+            for (size_t i = r.begin(); i != r.end(); ++i) {
+              // the size also counts a push that waits for free space
+              size_t occupancy = std::clamp<std::ptrdiff_t>(
+                  queue.size(), 0, m_cfg.prefetchEvents);
+              localOccupancySum += occupancy;
+              localOccupancyMax = std::max(localOccupancyMax, occupancy);
+
+              std::unique_ptr<PrefetchedEvent> prefetched;
+              {
+                StopWatch sw(localStall);
+                queue.pop(prefetched);
+              }
+              if (not prefetched) {
+                throw std::runtime_error("Failed to read input data");
+              }
+              processEvent(prefetched->context, localClocksAlgorithms);
+            }
+
+            addClocks(localClocksAlgorithms);
+            tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+            workerStall += localStall;
+            occupancySum += localOccupancySum;
+            occupancyMax = std::max(occupancyMax, localOccupancyMax);
+          },
+          tbb::simple_partitioner());
+    } catch (...) {
+      // stop the reader and release it if it waits for free space
+      cancelled = true;
+      std::unique_ptr<PrefetchedEvent> unused;
+      while (not readerDone) {
+        queue.try_pop(unused);
+        std::this_thread::yield();
+      }
+      reader.join();
+      if (readerError) {
+        std::rethrow_exception(readerError);
+      }
+      throw;
+    }
+    reader.join();
+
+    size_t numEvents = eventsRange.second - eventsRange.first;
+    ACTS_INFO("Prefetched up to " << m_cfg.prefetchEvents << " events");
+    ACTS_INFO("  reader waited for free space for " << asString(readerStall));
+    ACTS_INFO("  workers waited for events for " << asString(workerStall)
+                                                 << " in total");
+    ACTS_INFO("  queue occupancy on request: "
+              << static_cast<double>(occupancySum) / numEvents
+              << " on average, " << occupancyMax << " at most");
+  }
 
   // run end-of-run hooks
   for (auto& wrt : m_writers) {
@@ -334,6 +521,7 @@ int ActsExamples::Sequencer::run() {
   Duration totalReal = std::accumulate(
       clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
   size_t numEvents = eventsRange.second - eventsRange.first;
+  ACTS_DEBUG("Used " << eventStores.size() << " recycled event stores");
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
@@ -0,0 +1,45 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Utilities/MappedFile.hpp"
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ActsExamples::MappedFile ActsExamples::mapFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open '" + path + "'");
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Could not read the size of '" + path + "'");
+  }
+  const size_t size = status.st_size;
+  if (size == 0u) {
+    ::close(fd);
+    throw std::runtime_error("Empty file '" + path + "'");
+  }
+  void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping stays valid after the descriptor is closed
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error("Could not map '" + path + "'");
+  }
+  MappedFile file;
+  file.data = std::shared_ptr<const char>(
+      static_cast<const char*>(address),
+      [size](const char* p) { ::munmap(const_cast<char*>(p), size); });
+  file.size = size;
+  return file;
+}
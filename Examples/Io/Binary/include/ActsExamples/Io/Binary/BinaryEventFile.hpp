@@ -0,0 +1,64 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Io/Binary/BinaryEventFormat.hpp"
+#include "ActsExamples/Utilities/MappedFile.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace ActsExamples {
+
+/// The columns of a single event, viewed in place in the mapped file.
+struct BinaryEventView {
+  uint64_t eventNumber = 0;
+  Range<const BinaryEventFormat::ParticleRecord*> particles{nullptr, nullptr};
+  Range<const BinaryEventFormat::SimHitRecord*> simHits{nullptr, nullptr};
+  Range<const BinaryEventFormat::HitRecord*> hits{nullptr, nullptr};
+  Range<const BinaryEventFormat::CellRecord*> cells{nullptr, nullptr};
+  Range<const uint64_t*> hitSimHits{nullptr, nullptr};
+};
+
+/// A read-only binary event file.
+///
+/// The file is mapped into memory and the header and the index are verified
+/// at construction. The events are accessed without copying, the views stay
+/// valid as long as the file object exists. Concurrent access is safe.
+class BinaryEventFile {
+ public:
+  /// @param path The path of the file
+  ///
+  /// @note Throws std::runtime_error for files that are not consistent
+  explicit BinaryEventFile(const std::string& path);
+
+  /// The number of stored events
+  size_t size() const { return m_nEvents; }
+
+  /// The range of event numbers, the upper limit is exclusive
+  std::pair<size_t, size_t> availableEvents() const;
+
+  /// Access the columns of a single event
+  ///
+  /// @param eventNumber The event number
+  ///
+  /// @note Throws std::out_of_range if the event is not stored and
+  ///       std::runtime_error if the event block is not consistent
+  BinaryEventView event(size_t eventNumber) const;
+
+ private:
+  std::string m_path;
+  MappedFile m_file;
+  size_t m_nEvents = 0;
+  const BinaryEventFormat::IndexEntry* m_index = nullptr;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,122 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+/// Layout of the binary event files.
+///
+/// A file consists of the file header, the event blocks in the order they
+/// were written and the event index sorted by event number. Every event
+/// block starts at an aligned offset with the event header, followed by the
+/// columns
+///
+///   - particles,
+///   - simulated hits,
+///   - hits, i.e. the digitized clusters,
+///   - cells of all hits, referenced by range from the hits,
+///   - simulated hit indices of all hits, referenced by range from the hits.
+///
+/// All records have a size that is a multiple of eight bytes, such that the
+/// records of every column are naturally aligned within the mapped file and
+/// can be accessed in place.
+///
+/// All numbers are stored in native units and in the byte order of the
+/// writing machine, which is identified by the byte order mark.
+namespace ActsExamples {
+namespace BinaryEventFormat {
+
+constexpr char s_magic[8] = {'A', 'C', 'T', 'S', 'E', 'V', 'T', '\0'};
+constexpr uint32_t s_version = 1u;
+constexpr uint32_t s_byteOrderMark = 0x01020304u;
+/// Alignment of the event blocks and of the index
+constexpr uint64_t s_alignment = 64u;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t nEvents;
+  uint64_t indexOffset;
+  uint64_t fileSize;
+  uint64_t reserved[3];
+};
+
+struct IndexEntry {
+  uint64_t eventNumber;
+  uint64_t offset;
+  uint64_t size;
+};
+
+struct EventHeader {
+  uint64_t eventNumber;
+  uint64_t nParticles;
+  uint64_t nSimHits;
+  uint64_t nHits;
+  uint64_t nCells;
+  uint64_t nHitSimHits;
+};
+
+struct ParticleRecord {
+  uint64_t particleId;
+  int32_t pdg;
+  uint32_t process;
+  double position4[4];
+  double direction[3];
+  double absMomentum;
+  double mass;
+  double charge;
+};
+
+struct SimHitRecord {
+  uint64_t geometryId;
+  uint64_t particleId;
+  int64_t index;
+  double position4[4];
+  double momentum4Before[4];
+  double momentum4After[4];
+};
+
+struct HitRecord {
+  uint64_t geometryId;
+  /// The hit identifier, i.e. the index of the hit in the event
+  uint64_t hitId;
+  /// The local position and time
+  double parameters[3];
+  double covariance[9];
+  uint64_t cellsBegin;
+  uint64_t nCells;
+  uint64_t simHitsBegin;
+  uint64_t nSimHits;
+};
+
+struct CellRecord {
+  uint64_t channel0;
+  uint64_t channel1;
+  float value;
+  uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<Header> and
+                  std::is_trivially_copyable_v<IndexEntry> and
+                  std::is_trivially_copyable_v<EventHeader> and
+                  std::is_trivially_copyable_v<ParticleRecord> and
+                  std::is_trivially_copyable_v<SimHitRecord> and
+                  std::is_trivially_copyable_v<HitRecord> and
+                  std::is_trivially_copyable_v<CellRecord>,
+              "Records must be trivially copyable");
+static_assert(sizeof(Header) == s_alignment and
+                  sizeof(ParticleRecord) == 96u and
+                  sizeof(SimHitRecord) == 120u and sizeof(HitRecord) == 144u and
+                  sizeof(CellRecord) == 24u,
+              "Records must not contain padding");
+
+}  // namespace BinaryEventFormat
+}  // namespace ActsExamples
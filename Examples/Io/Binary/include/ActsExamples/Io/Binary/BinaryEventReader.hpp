@@ -0,0 +1,77 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFile.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Acts {
+class Surface;
+}
+
+namespace ActsExamples {
+
+/// Read particles, simulated hits and clusters from a binary event file.
+///
+/// The file is mapped into memory once and the event blocks are converted
+/// directly into the event data collections, without any parsing or
+/// sorting. The collections are identical to the ones of the csv readers.
+///
+/// All output collections are optional, but at least one must be given.
+/// The clusters require the tracking geometry to look up their surfaces.
+class BinaryEventReader final : public IReader {
+ public:
+  struct Config {
+    /// Path of the input file.
+    std::string filePath = "events.actsevt";
+    /// Output particles collection.
+    std::string outputParticles;
+    /// Output simulated (truth) hits collection.
+    std::string outputSimulatedHits;
+    /// Output cluster collection.
+    std::string outputClusters;
+    /// For each cluster/ hit index the original hit id stored on file.
+    std::string outputHitIds;
+    /// Output hit-particles mapping collection.
+    std::string outputHitParticlesMap;
+    /// Tracking geometry required to access the cluster surfaces.
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry;
+  };
+
+  /// Construct the reader and map the input file.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryEventReader(const Config& cfg, Acts::Logging::Level lvl);
+
+  std::string name() const final override;
+
+  /// Return the available events range.
+  std::pair<size_t, size_t> availableEvents() const final override;
+
+  /// Read out data from the input stream.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) final override;
+
+ private:
+  Config m_cfg;
+  BinaryEventFile m_file;
+  std::unordered_map<Acts::GeometryID, const Acts::Surface*> m_surfaces;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFormat.hpp"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Write particles, simulated hits and clusters into a binary event file.
+///
+/// All events of the run are stored in a single file, see
+/// BinaryEventFormat for the layout. Each event is encoded into a
+/// separate block concurrently and only the append to the file is
+/// serialized. The blocks are stored in the order they are finished and the
+/// index, which is sorted by event number, is written at the end of the run.
+///
+/// All input collections are optional, but at least one must be given. The
+/// clusters require the simulated hits they refer to.
+class BinaryEventWriter final : public IWriter {
+ public:
+  struct Config {
+    /// Input particles collection.
+    std::string inputParticles;
+    /// Input simulated hits collection.
+    std::string inputSimulatedHits;
+    /// Input clusters collection.
+    std::string inputClusters;
+    /// Path of the output file.
+    std::string filePath = "events.actsevt";
+  };
+
+  /// Construct the writer and open the output file.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryEventWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+  std::string name() const final override;
+
+  /// Encode and append the event block.
+  ProcessCode write(const AlgorithmContext& ctx) final override;
+
+  /// Write the index and complete the file.
+  ProcessCode endRun() final override;
+
+ private:
+  Config m_cfg;
+  std::mutex m_writeMutex;
+  std::ofstream m_file;
+  uint64_t m_offset = 0;
+  std::vector<BinaryEventFormat::IndexEntry> m_index;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,77 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Acts {
+class IMaterialDecorator;
+class TrackingGeometry;
+}  // namespace Acts
+
+namespace ActsExamples {
+
+/// @brief Reader of a closed tracking geometry from a binary cache file
+///
+/// Restores the tracking geometry written by the BinaryGeometryWriter without
+/// the detector construction or any of its external dependencies. Sensitive
+/// surfaces are attached to identified detector elements that are owned by
+/// the returned geometry and carry the stored identifier and digitization
+/// module. They provide the nominal transforms only, i.e. contextual
+/// transforms, e.g. from an alignment decorator, are not available.
+///
+/// The geometry is closed again with the optional material decorator, and
+/// the geometry identifiers of all restored objects are verified against the
+/// stored ones.
+class BinaryGeometryReader {
+ public:
+  /// @class Config
+  /// Configuration of the Reader
+  class Config {
+   public:
+    /// The name of the input file
+    std::string fileName = "geometry.actsgeo";
+    /// The default logger
+    std::shared_ptr<const Acts::Logger> logger;
+    // The name of the reader
+    std::string name = "";
+
+    /// Constructor
+    ///
+    /// @param lname Name of the reader tool
+    /// @param lvl The output logging level
+    Config(const std::string& lname = "BinaryGeometryReader",
+           Acts::Logging::Level lvl = Acts::Logging::INFO)
+        : logger(Acts::getDefaultLogger(lname, lvl)), name(lname) {}
+  };
+
+  /// Constructor
+  ///
+  /// @param cfg configuration struct for the reader
+  BinaryGeometryReader(const Config& cfg);
+
+  /// Read the tracking geometry
+  ///
+  /// @param materialDecorator is the optional decorator used when closing
+  ///        the geometry, the stored material is kept without it
+  std::shared_ptr<const Acts::TrackingGeometry> read(
+      const Acts::IMaterialDecorator* materialDecorator = nullptr) const;
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_cfg.logger; }
+};
+
+}  // namespace ActsExamples
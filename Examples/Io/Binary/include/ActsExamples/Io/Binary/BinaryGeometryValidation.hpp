@@ -0,0 +1,42 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace Acts {
+class TrackingGeometry;
+}
+
+namespace ActsExamples {
+
+/// Compare the navigation through a restored geometry with the original
+///
+/// Straight lines from the origin on a regular grid in eta and phi are
+/// propagated through both geometries. The crossed sensitive and material
+/// surfaces must agree in their geometry identifiers and their intersection
+/// positions, every mismatch is reported as an error. A line that fails to
+/// propagate through either geometry counts as a mismatch.
+///
+/// @param reference The original tracking geometry
+/// @param restored The tracking geometry restored from the binary cache
+/// @param nEta The number of lines in eta within [-4,4]
+/// @param nPhi The number of lines in phi
+/// @param logger The logger for the mismatches
+///
+/// @return the number of lines with a different navigation
+size_t compareNavigation(
+    const std::shared_ptr<const Acts::TrackingGeometry>& reference,
+    const std::shared_ptr<const Acts::TrackingGeometry>& restored, size_t nEta,
+    size_t nPhi, Acts::LoggerWrapper logger);
+
+}  // namespace ActsExamples
@@ -0,0 +1,77 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Acts {
+class TrackingGeometry;
+}
+
+namespace ActsExamples {
+
+/// @brief Writer of a closed tracking geometry into a binary cache file
+///
+/// The complete geometry is written, i.e. the volume hierarchy with the
+/// volume bounds and material, the layers with their surface arrays and
+/// approach surfaces, the sensitive surfaces with the identifier and the
+/// digitization module of their detector element, the boundary surfaces with
+/// their attached volumes and the geometry identifiers of all objects. The
+/// BinaryGeometryReader restores the geometry from the file without running
+/// the detector construction.
+///
+/// The nominal geometry is written, i.e. all transforms are evaluated in the
+/// default geometry context. Dense volumes, bounding volume hierarchies, cone
+/// layers, sub-binning of layer or volume arrays and digitization modules
+/// without cartesian segmentation are not supported and throw
+/// std::invalid_argument.
+class BinaryGeometryWriter {
+ public:
+  /// @class Config
+  ///
+  /// Configuration of the Writer
+  struct Config {
+    /// The name of the output file
+    std::string fileName = "geometry.actsgeo";
+    /// The default logger
+    std::shared_ptr<const Acts::Logger> logger;
+    // The name of the writer
+    std::string name = "";
+
+    /// Constructor
+    ///
+    /// @param lname Name of the writer tool
+    /// @param lvl The output logging level
+    Config(const std::string& lname = "BinaryGeometryWriter",
+           Acts::Logging::Level lvl = Acts::Logging::INFO)
+        : logger(Acts::getDefaultLogger(lname, lvl)), name(lname) {}
+  };
+
+  /// Constructor
+  ///
+  /// @param cfg The configuration struct
+  BinaryGeometryWriter(const Config& cfg);
+
+  /// Write out the tracking geometry
+  ///
+  /// @param tGeometry is the closed tracking geometry
+  void write(const Acts::TrackingGeometry& tGeometry);
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_cfg.logger; }
+};
+
+}  // namespace ActsExamples
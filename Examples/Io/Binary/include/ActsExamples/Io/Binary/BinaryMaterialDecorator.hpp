@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+
+/// @class BinaryMaterialDecorator
+///
+/// @brief Decorate surfaces with material from the indexed binary format
+///
+/// The file written by the BinaryMaterialWriter is mapped into memory at
+/// construction and only its header is verified. Decorating a surface looks
+/// up its geometry identifier in the sorted index and decodes its material.
+///
+/// With lazy decoding, the surface is given a proxy that decodes the material
+/// when it is first accessed, such that the material of surfaces that are
+/// never crossed is never decoded. The proxy returns the decoded material
+/// from ISurfaceMaterial::concreteMaterial, which the material writers and
+/// the material mapping use to access the concrete material type.
+///
+/// The file contains surface material only, the material of all volumes is
+/// removed.
+class BinaryMaterialDecorator : public Acts::IMaterialDecorator {
+ public:
+  /// @class Config
+  /// Configuration of the Reader
+  class Config {
+   public:
+    /// The name of the input file
+    std::string fileName = "material-maps.actsmat";
+    /// Decode the material when it is first accessed instead of when the
+    /// surface is decorated
+    bool lazyDecoding = true;
+    /// Precompute the interaction constants of the decoded material, which
+    /// are used for the energy loss in the propagation
+    bool tabulateInteractionConstants = false;
+    /// The default logger
+    std::shared_ptr<const Acts::Logger> logger;
+    // The name of the reader
+    std::string name = "";
+
+    /// Constructor
+    ///
+    /// @param lname Name of the reader tool
+    /// @param lvl The output logging level
+    Config(const std::string& lname = "BinaryMaterialDecorator",
+           Acts::Logging::Level lvl = Acts::Logging::INFO)
+        : logger(Acts::getDefaultLogger(lname, lvl)), name(lname) {}
+  };
+
+  /// Constructor
+  ///
+  /// @param cfg configuration struct for the reader
+  BinaryMaterialDecorator(const Config& cfg);
+
+  /// Decorate a surface
+  ///
+  /// @param surface the non-cost surface that is decorated
+  void decorate(Acts::Surface& surface) const final;
+
+  /// Decorate a TrackingVolume
+  ///
+  /// @param volume the non-cost volume that is decorated
+  void decorate(Acts::TrackingVolume& volume) const final;
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// The mapped file content
+  std::shared_ptr<const char> m_data;
+
+  /// The size of the mapped file
+  size_t m_size = 0;
+
+  /// The number of index entries
+  size_t m_nEntries = 0;
+
+  /// The offset of the index from the start of the file
+  size_t m_indexOffset = 0;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_cfg.logger; }
+};
+
+}  // namespace ActsExamples
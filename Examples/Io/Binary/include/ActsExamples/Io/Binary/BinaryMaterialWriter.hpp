@@ -0,0 +1,77 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace Acts {
+using SurfaceMaterialMap =
+    std::map<GeometryID, std::shared_ptr<const ISurfaceMaterial>>;
+using VolumeMaterialMap =
+    std::map<GeometryID, std::shared_ptr<const IVolumeMaterial>>;
+using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
+}  // namespace Acts
+
+namespace ActsExamples {
+
+/// @brief Material writer for the indexed binary format
+///
+/// Writes the surface material maps into a single file with an index sorted
+/// by geometry identifier, such that the BinaryMaterialDecorator can map the
+/// file and decode the material of every surface on its own. Homogeneous,
+/// binned and proto surface material is supported, volume material is not
+/// written.
+class BinaryMaterialWriter {
+ public:
+  /// @class Config
+  ///
+  /// Configuration of the Writer
+  struct Config {
+    /// The name of the output file
+    std::string fileName = "material-maps.actsmat";
+    /// The default logger
+    std::shared_ptr<const Acts::Logger> logger;
+    // The name of the writer
+    std::string name = "";
+
+    /// Constructor
+    ///
+    /// @param lname Name of the writer tool
+    /// @param lvl The output logging level
+    Config(const std::string& lname = "BinaryMaterialWriter",
+           Acts::Logging::Level lvl = Acts::Logging::INFO)
+        : logger(Acts::getDefaultLogger(lname, lvl)), name(lname) {}
+  };
+
+  /// Constructor
+  ///
+  /// @param cfg The configuration struct
+  BinaryMaterialWriter(const Config& cfg);
+
+  /// Write out the material map
+  ///
+  /// @param detMaterial is the SurfaceMaterial and VolumeMaterial maps
+  void write(const Acts::DetectorMaterialMaps& detMaterial);
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_cfg.logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,141 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Definitions.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Growing byte buffer for sequentially written binary records.
+///
+/// Objects are stored as raw bytes in the byte order of the machine.
+class BinaryWriteBuffer {
+ public:
+  /// Append the raw bytes of a trivially copyable object
+  template <typename T>
+  void write(const T& object) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be written");
+    const char* bytes = reinterpret_cast<const char*>(&object);
+    m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+  }
+
+  /// Append a string prefixed by its size
+  void write(const std::string& string) {
+    write<uint64_t>(string.size());
+    m_data.insert(m_data.end(), string.begin(), string.end());
+  }
+
+  /// Append all matrix elements of a transform
+  void write(const Acts::Transform3D& transform) {
+    const auto& matrix = transform.matrix();
+    m_data.insert(m_data.end(), reinterpret_cast<const char*>(matrix.data()),
+                  reinterpret_cast<const char*>(matrix.data() + matrix.size()));
+  }
+
+  /// Append a vector of trivially copyable objects prefixed by its size
+  template <typename T>
+  void write(const std::vector<T>& objects) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be written");
+    write<uint64_t>(objects.size());
+    const char* bytes = reinterpret_cast<const char*>(objects.data());
+    m_data.insert(m_data.end(), bytes, bytes + objects.size() * sizeof(T));
+  }
+
+  /// Append a block of raw bytes prefixed by its size
+  void writeBlock(const std::vector<char>& bytes) { write(bytes); }
+
+  const std::vector<char>& data() const { return m_data; }
+
+ private:
+  std::vector<char> m_data;
+};
+
+/// Bounds-checked sequential reader for binary records.
+///
+/// Reading beyond the end of the buffer throws std::runtime_error.
+class BinaryReadBuffer {
+ public:
+  /// @param data The start of the buffer
+  /// @param size The size of the buffer in bytes
+  BinaryReadBuffer(const char* data, size_t size)
+      : m_position(data), m_end(data + size) {}
+
+  /// Read a trivially copyable object from possibly unaligned bytes
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be read");
+    T object;
+    std::memcpy(&object, take(sizeof(T)), sizeof(T));
+    return object;
+  }
+
+  /// Read a string prefixed by its size
+  std::string readString() {
+    const uint64_t size = read<uint64_t>();
+    const char* bytes = take(size);
+    return std::string(bytes, bytes + size);
+  }
+
+  /// Read all matrix elements of a transform
+  Acts::Transform3D readTransform() {
+    Acts::Transform3D transform;
+    auto& matrix = transform.matrix();
+    std::memcpy(matrix.data(), take(matrix.size() * sizeof(double)),
+                matrix.size() * sizeof(double));
+    return transform;
+  }
+
+  /// Read a vector of trivially copyable objects prefixed by its size
+  template <typename T>
+  std::vector<T> readVector() {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be read");
+    const uint64_t size = read<uint64_t>();
+    if (size > remaining() / sizeof(T)) {
+      throw std::runtime_error("Truncated binary record");
+    }
+    std::vector<T> objects(size);
+    std::memcpy(objects.data(), take(size * sizeof(T)), size * sizeof(T));
+    return objects;
+  }
+
+  /// Read a block of raw bytes prefixed by its size without copying it
+  BinaryReadBuffer readBlock() {
+    const uint64_t size = read<uint64_t>();
+    return BinaryReadBuffer(take(size), size);
+  }
+
+  /// The number of bytes that are not read yet
+  size_t remaining() const { return m_end - m_position; }
+
+ private:
+  const char* take(size_t size) {
+    if (size > remaining()) {
+      throw std::runtime_error("Truncated binary record");
+    }
+    const char* bytes = m_position;
+    m_position += size;
+    return bytes;
+  }
+
+  const char* m_position;
+  const char* m_end;
+};
+
+}  // namespace ActsExamples
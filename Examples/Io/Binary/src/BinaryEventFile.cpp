@@ -0,0 +1,135 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryEventFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+namespace Format = ActsExamples::BinaryEventFormat;
+
+/// View a column of records at the given offset of the block
+template <typename T>
+ActsExamples::Range<const T*> column(const char* block, size_t& offset,
+                                     size_t count, size_t blockSize) {
+  if (count > (blockSize - offset) / sizeof(T)) {
+    throw std::runtime_error("Truncated binary event block");
+  }
+  const T* begin = reinterpret_cast<const T*>(block + offset);
+  offset += count * sizeof(T);
+  return ActsExamples::makeRange(begin, begin + count);
+}
+
+}  // namespace
+
+ActsExamples::BinaryEventFile::BinaryEventFile(const std::string& path)
+    : m_path(path), m_file(mapFile(path)) {
+  Format::Header header;
+  if (m_file.size < sizeof(header)) {
+    throw std::runtime_error("'" + m_path + "' is not a binary event file");
+  }
+  std::memcpy(&header, m_file.data.get(), sizeof(header));
+  if (std::memcmp(header.magic, Format::s_magic, sizeof(Format::s_magic)) !=
+      0) {
+    throw std::runtime_error("'" + m_path + "' is not a binary event file");
+  }
+  if (header.version != Format::s_version) {
+    throw std::runtime_error("Unsupported binary event file version " +
+                             std::to_string(header.version) + " in '" +
+                             m_path + "'");
+  }
+  if (header.byteOrderMark != Format::s_byteOrderMark) {
+    throw std::runtime_error("Binary event file '" + m_path +
+                             "' was written with a different byte order");
+  }
+  // the index is only written when the writer is closed
+  if (header.fileSize != m_file.size or header.indexOffset > m_file.size or
+      header.indexOffset % Format::s_alignment != 0u or
+      header.nEvents >
+          (m_file.size - header.indexOffset) / sizeof(Format::IndexEntry)) {
+    throw std::runtime_error("Incomplete or truncated binary event file '" +
+                             m_path + "'");
+  }
+  m_nEvents = header.nEvents;
+  m_index = reinterpret_cast<const Format::IndexEntry*>(m_file.data.get() +
+                                                        header.indexOffset);
+  for (size_t i = 0; i < m_nEvents; ++i) {
+    const auto& entry = m_index[i];
+    if ((0u < i and entry.eventNumber <= m_index[i - 1].eventNumber) or
+        entry.offset % Format::s_alignment != 0u or
+        entry.offset > header.indexOffset or
+        entry.size > header.indexOffset - entry.offset) {
+      throw std::runtime_error("Inconsistent index in binary event file '" +
+                               m_path + "'");
+    }
+  }
+}
+
+std::pair<size_t, size_t> ActsExamples::BinaryEventFile::availableEvents()
+    const {
+  if (m_nEvents == 0u) {
+    return {0u, 0u};
+  }
+  return {m_index[0].eventNumber, m_index[m_nEvents - 1].eventNumber + 1u};
+}
+
+ActsExamples::BinaryEventView ActsExamples::BinaryEventFile::event(
+    size_t eventNumber) const {
+  const auto* end = m_index + m_nEvents;
+  const auto* entry = std::lower_bound(
+      m_index, end, eventNumber,
+      [](const Format::IndexEntry& e, size_t n) { return e.eventNumber < n; });
+  if (entry == end or entry->eventNumber != eventNumber) {
+    throw std::out_of_range("Event " + std::to_string(eventNumber) +
+                            " is not stored in '" + m_path + "'");
+  }
+
+  const char* block = m_file.data.get() + entry->offset;
+  size_t offset = 0;
+  const auto* header =
+      column<Format::EventHeader>(block, offset, 1u, entry->size).begin();
+  if (header->eventNumber != eventNumber) {
+    throw std::runtime_error("Inconsistent block of event " +
+                             std::to_string(eventNumber) + " in '" + m_path +
+                             "'");
+  }
+  BinaryEventView view;
+  view.eventNumber = eventNumber;
+  view.particles = column<Format::ParticleRecord>(
+      block, offset, header->nParticles, entry->size);
+  view.simHits = column<Format::SimHitRecord>(block, offset, header->nSimHits,
+                                              entry->size);
+  view.hits =
+      column<Format::HitRecord>(block, offset, header->nHits, entry->size);
+  view.cells =
+      column<Format::CellRecord>(block, offset, header->nCells, entry->size);
+  view.hitSimHits =
+      column<uint64_t>(block, offset, header->nHitSimHits, entry->size);
+  // the hits must only refer to the cells and simulated hits of the event
+  for (const auto& hit : view.hits) {
+    if (hit.cellsBegin > view.cells.size() or
+        hit.nCells > view.cells.size() - hit.cellsBegin or
+        hit.simHitsBegin > view.hitSimHits.size() or
+        hit.nSimHits > view.hitSimHits.size() - hit.simHitsBegin) {
+      throw std::runtime_error("Inconsistent hit of event " +
+                               std::to_string(eventNumber) + " in '" +
+                               m_path + "'");
+    }
+  }
+  for (auto simHitIndex : view.hitSimHits) {
+    if (simHitIndex >= view.simHits.size()) {
+      throw std::runtime_error("Inconsistent hit of event " +
+                               std::to_string(eventNumber) + " in '" +
+                               m_path + "'");
+    }
+  }
+  return view;
+}
@@ -0,0 +1,192 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
+
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/IndexContainers.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimIdentifier.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+namespace Format = ActsExamples::BinaryEventFormat;
+
+ActsFatras::Hit::Vector4 makeVector4(const double (&values)[4]) {
+  return {values[0], values[1], values[2], values[3]};
+}
+
+}  // namespace
+
+ActsExamples::BinaryEventReader::BinaryEventReader(
+    const ActsExamples::BinaryEventReader::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_file(cfg.filePath),
+      m_logger(Acts::getDefaultLogger("BinaryEventReader", lvl)) {
+  if (m_cfg.outputParticles.empty() and m_cfg.outputSimulatedHits.empty() and
+      m_cfg.outputClusters.empty() and m_cfg.outputHitIds.empty() and
+      m_cfg.outputHitParticlesMap.empty()) {
+    throw std::invalid_argument("Missing output collections");
+  }
+  if (not m_cfg.outputClusters.empty()) {
+    if (not m_cfg.trackingGeometry) {
+      throw std::invalid_argument("Missing tracking geometry");
+    }
+    // fill the geo id to surface map once to speed up lookups later on
+    m_cfg.trackingGeometry->visitSurfaces([this](const Acts::Surface* surface) {
+      this->m_surfaces[surface->geometryId()] = surface;
+    });
+  }
+  ACTS_DEBUG("Mapped " << m_file.size() << " events from '" << m_cfg.filePath
+                       << "'");
+}
+
+std::string ActsExamples::BinaryEventReader::name() const {
+  return "BinaryEventReader";
+}
+
+std::pair<size_t, size_t> ActsExamples::BinaryEventReader::availableEvents()
+    const {
+  return m_file.availableEvents();
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryEventReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  BinaryEventView event;
+  try {
+    event = m_file.event(ctx.eventNumber);
+  } catch (const std::exception& e) {
+    ACTS_FATAL(e.what());
+    return ProcessCode::ABORT;
+  }
+
+  if (not m_cfg.outputParticles.empty()) {
+    SimParticleContainer::sequence_type unordered;
+    unordered.reserve(event.particles.size());
+    for (const auto& record : event.particles) {
+      ActsFatras::Particle particle(ActsFatras::Barcode(record.particleId),
+                                    Acts::PdgParticle(record.pdg),
+                                    record.charge, record.mass);
+      particle.setProcess(static_cast<ActsFatras::ProcessType>(record.process));
+      particle.setPosition4(record.position4[0], record.position4[1],
+                            record.position4[2], record.position4[3]);
+      particle.setDirection(record.direction[0], record.direction[1],
+                            record.direction[2]);
+      particle.setAbsMomentum(record.absMomentum);
+      unordered.push_back(std::move(particle));
+    }
+    SimParticleContainer particles;
+    particles.adopt_sequence(std::move(unordered));
+    ctx.eventStore.add(m_cfg.outputParticles, std::move(particles));
+  }
+
+  // the simulated hits were written in container order. they are adopted
+  // without reordering such that the cluster indices remain valid.
+  SimHitContainer::sequence_type ordered;
+  ordered.reserve(event.simHits.size());
+  for (const auto& record : event.simHits) {
+    if (not ordered.empty() and
+        record.geometryId < ordered.back().geometryId().value()) {
+      ACTS_FATAL("Simulated hits of event " << ctx.eventNumber
+                                            << " are not ordered");
+      return ProcessCode::ABORT;
+    }
+    ordered.emplace_back(Acts::GeometryID(record.geometryId),
+                         ActsFatras::Barcode(record.particleId),
+                         makeVector4(record.position4),
+                         makeVector4(record.momentum4Before),
+                         makeVector4(record.momentum4After), record.index);
+  }
+
+  if (not m_cfg.outputClusters.empty()) {
+    GeometryIdMultimap<Acts::PlanarModuleCluster> clusters;
+    clusters.reserve(event.hits.size());
+    for (const auto& record : event.hits) {
+      const Acts::GeometryID geoId(record.geometryId);
+      auto it = m_surfaces.find(geoId);
+      if (it == m_surfaces.end() or not it->second) {
+        ACTS_FATAL("Could not retrieve the surface for hit " << record.hitId);
+        return ProcessCode::ABORT;
+      }
+      const Acts::Surface& surface = *(it->second);
+
+      Acts::ActsSymMatrixD<3> cov;
+      for (unsigned int i = 0; i < 3; ++i) {
+        for (unsigned int j = 0; j < 3; ++j) {
+          cov(i, j) = record.covariance[3 * i + j];
+        }
+      }
+      std::vector<Acts::DigitizationCell> cells;
+      cells.reserve(record.nCells);
+      for (size_t i = record.cellsBegin; i < record.cellsBegin + record.nCells;
+           ++i) {
+        const auto& cell = event.cells.begin()[i];
+        cells.emplace_back(cell.channel0, cell.channel1, cell.value);
+      }
+      std::vector<std::size_t> simHitIndices(
+          event.hitSimHits.begin() + record.simHitsBegin,
+          event.hitSimHits.begin() + record.simHitsBegin + record.nSimHits);
+
+      Acts::PlanarModuleCluster cluster(
+          surface.getSharedPtr(),
+          Identifier(identifier_type(geoId.value()), std::move(simHitIndices)),
+          std::move(cov), record.parameters[0], record.parameters[1],
+          record.parameters[2], std::move(cells));
+      // the clusters were written in container order, i.e. the cluster
+      // indices are identical to the ones of the writing job.
+      auto inserted =
+          clusters.emplace_hint(clusters.end(), geoId, std::move(cluster));
+      if (std::next(inserted) != clusters.end()) {
+        ACTS_FATAL("Hits of event " << ctx.eventNumber << " are not ordered");
+        return ProcessCode::ABORT;
+      }
+    }
+    ctx.eventStore.add(m_cfg.outputClusters, std::move(clusters));
+  }
+
+  if (not m_cfg.outputHitIds.empty()) {
+    std::vector<uint64_t> hitIds;
+    hitIds.reserve(event.hits.size());
+    for (const auto& record : event.hits) {
+      hitIds.push_back(record.hitId);
+    }
+    ctx.eventStore.add(m_cfg.outputHitIds, std::move(hitIds));
+  }
+
+  if (not m_cfg.outputHitParticlesMap.empty()) {
+    IndexMultimap<ActsFatras::Barcode> hitParticlesMap;
+    hitParticlesMap.reserve(event.hitSimHits.size());
+    for (size_t hitIndex = 0; hitIndex < event.hits.size(); ++hitIndex) {
+      const auto& record = event.hits.begin()[hitIndex];
+      for (size_t i = record.simHitsBegin;
+           i < record.simHitsBegin + record.nSimHits; ++i) {
+        const auto& simHit = ordered[event.hitSimHits.begin()[i]];
+        hitParticlesMap.emplace_hint(hitParticlesMap.end(), hitIndex,
+                                     simHit.particleId());
+      }
+    }
+    ctx.eventStore.add(m_cfg.outputHitParticlesMap,
+                       std::move(hitParticlesMap));
+  }
+
+  if (not m_cfg.outputSimulatedHits.empty()) {
+    SimHitContainer simHits;
+    simHits.adopt_sequence(boost::container::ordered_range,
+                           std::move(ordered));
+    ctx.eventStore.add(m_cfg.outputSimulatedHits, std::move(simHits));
+  }
+
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,234 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
+
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+namespace Format = ActsExamples::BinaryEventFormat;
+
+/// Append the raw bytes of a column of records
+template <typename T>
+void appendColumn(std::vector<char>& block, const std::vector<T>& records) {
+  const char* bytes = reinterpret_cast<const char*>(records.data());
+  block.insert(block.end(), bytes, bytes + records.size() * sizeof(T));
+}
+
+}  // namespace
+
+ActsExamples::BinaryEventWriter::BinaryEventWriter(
+    const ActsExamples::BinaryEventWriter::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg), m_logger(Acts::getDefaultLogger("BinaryEventWriter", lvl)) {
+  if (m_cfg.inputParticles.empty() and m_cfg.inputSimulatedHits.empty() and
+      m_cfg.inputClusters.empty()) {
+    throw std::invalid_argument("Missing input collections");
+  }
+  if (not m_cfg.inputClusters.empty() and m_cfg.inputSimulatedHits.empty()) {
+    throw std::invalid_argument("Missing simulated hits input collection");
+  }
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+
+  m_file.open(m_cfg.filePath,
+              std::ios::out | std::ios::binary | std::ios::trunc);
+  if (not m_file) {
+    throw std::runtime_error("Could not open '" + m_cfg.filePath +
+                             "' for writing");
+  }
+  // the header is completed at the end of the run. until then the file is
+  // recognized as incomplete since the file size does not match.
+  Format::Header header{};
+  std::memcpy(header.magic, Format::s_magic, sizeof(Format::s_magic));
+  header.version = Format::s_version;
+  header.byteOrderMark = Format::s_byteOrderMark;
+  m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  m_offset = sizeof(header);
+}
+
+std::string ActsExamples::BinaryEventWriter::name() const {
+  return "BinaryEventWriter";
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryEventWriter::write(
+    const AlgorithmContext& ctx) {
+  Format::EventHeader header{};
+  header.eventNumber = ctx.eventNumber;
+
+  std::vector<Format::ParticleRecord> particles;
+  if (not m_cfg.inputParticles.empty()) {
+    const auto& input =
+        ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+    particles.reserve(input.size());
+    for (const auto& particle : input) {
+      Format::ParticleRecord record{};
+      record.particleId = particle.particleId().value();
+      record.pdg = particle.pdg();
+      record.process = static_cast<uint32_t>(particle.process());
+      for (unsigned int i = 0; i < 4; ++i) {
+        record.position4[i] = particle.position4()[i];
+      }
+      for (unsigned int i = 0; i < 3; ++i) {
+        record.direction[i] = particle.unitDirection()[i];
+      }
+      record.absMomentum = particle.absMomentum();
+      record.mass = particle.mass();
+      record.charge = particle.charge();
+      particles.push_back(record);
+    }
+  }
+
+  std::vector<Format::SimHitRecord> simHits;
+  if (not m_cfg.inputSimulatedHits.empty()) {
+    const auto& input =
+        ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
+    simHits.reserve(input.size());
+    for (const auto& simHit : input) {
+      Format::SimHitRecord record{};
+      record.geometryId = simHit.geometryId().value();
+      record.particleId = simHit.particleId().value();
+      record.index = simHit.index();
+      for (unsigned int i = 0; i < 4; ++i) {
+        record.position4[i] = simHit.position4()[i];
+        record.momentum4Before[i] = simHit.momentum4Before()[i];
+        record.momentum4After[i] = simHit.momentum4After()[i];
+      }
+      simHits.push_back(record);
+    }
+  }
+
+  std::vector<Format::HitRecord> hits;
+  std::vector<Format::CellRecord> cells;
+  std::vector<uint64_t> hitSimHits;
+  if (not m_cfg.inputClusters.empty()) {
+    const auto& input =
+        ctx.eventStore.get<GeometryIdMultimap<Acts::PlanarModuleCluster>>(
+            m_cfg.inputClusters);
+    hits.reserve(input.size());
+    for (const auto& entry : input) {
+      const Acts::PlanarModuleCluster& cluster = entry.second;
+      Format::HitRecord record{};
+      record.geometryId = entry.first.value();
+      record.hitId = hits.size();
+      for (unsigned int i = 0; i < 3; ++i) {
+        record.parameters[i] = cluster.parameters()[i];
+        for (unsigned int j = 0; j < 3; ++j) {
+          record.covariance[3 * i + j] = cluster.covariance()(i, j);
+        }
+      }
+      record.cellsBegin = cells.size();
+      record.nCells = cluster.digitizationCells().size();
+      for (const auto& cell : cluster.digitizationCells()) {
+        cells.push_back({cell.channel0, cell.channel1, cell.data, 0u});
+      }
+      record.simHitsBegin = hitSimHits.size();
+      record.nSimHits = cluster.sourceLink().indices().size();
+      for (auto index : cluster.sourceLink().indices()) {
+        if (index >= simHits.size()) {
+          ACTS_FATAL("Simulation hit with index " << index
+                                                  << " does not exist");
+          return ProcessCode::ABORT;
+        }
+        hitSimHits.push_back(index);
+      }
+      hits.push_back(record);
+    }
+  }
+
+  header.nParticles = particles.size();
+  header.nSimHits = simHits.size();
+  header.nHits = hits.size();
+  header.nCells = cells.size();
+  header.nHitSimHits = hitSimHits.size();
+
+  // encode the complete block before taking the lock
+  std::vector<char> block;
+  block.reserve(sizeof(header) +
+                particles.size() * sizeof(Format::ParticleRecord) +
+                simHits.size() * sizeof(Format::SimHitRecord) +
+                hits.size() * sizeof(Format::HitRecord) +
+                cells.size() * sizeof(Format::CellRecord) +
+                hitSimHits.size() * sizeof(uint64_t) + Format::s_alignment);
+  block.insert(block.end(), reinterpret_cast<const char*>(&header),
+               reinterpret_cast<const char*>(&header) + sizeof(header));
+  appendColumn(block, particles);
+  appendColumn(block, simHits);
+  appendColumn(block, hits);
+  appendColumn(block, cells);
+  appendColumn(block, hitSimHits);
+  const uint64_t blockSize = block.size();
+
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // the block size is padded such that the next block is aligned again
+  const uint64_t offset = m_offset;
+  block.resize(((offset + blockSize + Format::s_alignment - 1) /
+                Format::s_alignment) *
+                   Format::s_alignment -
+               offset);
+  m_file.write(block.data(), block.size());
+  if (not m_file) {
+    ACTS_FATAL("Could not write event " << ctx.eventNumber << " to '"
+                                        << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+  m_offset += block.size();
+  m_index.push_back({ctx.eventNumber, offset, blockSize});
+  return ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryEventWriter::endRun() {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // the blocks are stored in completion order, only the index is reordered
+  std::sort(m_index.begin(), m_index.end(),
+            [](const Format::IndexEntry& lhs, const Format::IndexEntry& rhs) {
+              return lhs.eventNumber < rhs.eventNumber;
+            });
+  auto duplicate = std::adjacent_find(
+      m_index.begin(), m_index.end(),
+      [](const Format::IndexEntry& lhs, const Format::IndexEntry& rhs) {
+        return lhs.eventNumber == rhs.eventNumber;
+      });
+  if (duplicate != m_index.end()) {
+    ACTS_FATAL("Event " << duplicate->eventNumber << " was written twice");
+    return ProcessCode::ABORT;
+  }
+
+  // the first block starts right after the header and every block is padded,
+  // thus the index is aligned as well
+  Format::Header header{};
+  std::memcpy(header.magic, Format::s_magic, sizeof(Format::s_magic));
+  header.version = Format::s_version;
+  header.byteOrderMark = Format::s_byteOrderMark;
+  header.nEvents = m_index.size();
+  header.indexOffset = m_offset;
+  header.fileSize =
+      m_offset + m_index.size() * sizeof(Format::IndexEntry);
+  m_file.write(reinterpret_cast<const char*>(m_index.data()),
+               m_index.size() * sizeof(Format::IndexEntry));
+  m_file.seekp(0);
+  m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  m_file.close();
+  if (not m_file) {
+    ACTS_FATAL("Could not complete '" << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+  ACTS_INFO("Wrote " << m_index.size() << " events to '" << m_cfg.filePath
+                     << "'");
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/// Layout of the binary tracking geometry files.
+///
+/// A file consists of the file header followed by the sections
+///
+///   - digitization modules: the modules of the identified detector elements
+///     with their cartesian segmentation,
+///   - surfaces: all surfaces that are not layer representations, i.e.
+///     sensitive, approach, navigation layer, boundary and beam line surfaces,
+///   - volume arrays: the binning and the volume index grid of all arrays of
+///     confined volumes and of all volume arrays attached to boundaries,
+///   - volumes: all volumes in post-order, i.e. confined volumes are stored
+///     before their container, each with its layers and surface arrays,
+///   - boundaries: all boundary surfaces with their attached volumes,
+///
+/// and the index of the beam line surface. Every section starts with the
+/// number of its entries. Objects refer to each other by their index in the
+/// section, shared objects are stored only once.
+///
+/// Transforms are stored as their full matrix, bounds as their type and
+/// their values, and the geometry identifier of every object is stored to
+/// verify the restored geometry. Surface material is stored as a record of
+/// the binary material map format. Detector elements are stored with their
+/// thickness, identifier and digitization module, and are restored as
+/// identified detector elements with their nominal transform.
+///
+/// All numbers are stored in the byte order of the writing machine, which is
+/// identified by the byte order mark.
+namespace ActsExamples {
+namespace BinaryGeometryFormat {
+
+constexpr char s_magic[8] = {'A', 'C', 'T', 'S', 'G', 'E', 'O', '\0'};
+constexpr uint32_t s_version = 2u;
+constexpr uint32_t s_byteOrderMark = 0x01020304u;
+/// Index of an object that does not exist
+constexpr uint32_t s_invalidIndex = std::numeric_limits<uint32_t>::max();
+
+/// The kind of the layer, which determines its representing surface
+enum LayerKind : uint32_t {
+  cylinderLayer = 0u,
+  discLayer = 1u,
+  planeLayer = 2u,
+  navigationLayer = 3u
+};
+
+/// The kind of the surface array, which determines its local coordinates
+enum SurfaceArrayKind : uint32_t {
+  noSurfaceArray = 0u,
+  singleElement = 1u,
+  cylinderArray = 2u,
+  discArray = 3u,
+  planeArray = 4u
+};
+
+/// The supported types of volume material
+enum VolumeMaterialType : uint32_t {
+  noVolumeMaterial = 0u,
+  homogeneousVolumeMaterial = 1u,
+  protoVolumeMaterial = 2u
+};
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t fileSize;
+};
+
+static_assert(std::is_trivially_copyable_v<Header>,
+              "Records must be trivially copyable");
+static_assert(sizeof(Header) == 24u, "Records must not contain padding");
+
+}  // namespace BinaryGeometryFormat
+}  // namespace ActsExamples
@@ -0,0 +1,868 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryGeometryReader.hpp"
+
+#include "Acts/Geometry/ConeVolumeBounds.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GenericApproachDescriptor.hpp"
+#include "Acts/Geometry/GenericCuboidVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Material/ProtoVolumeMaterial.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Identification/IdentifiedDetectorElement.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "ActsExamples/Utilities/MappedFile.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+#include "BinaryBuffer.hpp"
+#include "BinaryGeometryFormat.hpp"
+#include "BinaryMaterialRecord.hpp"
+
+namespace {
+
+namespace Format = ActsExamples::BinaryGeometryFormat;
+
+using ActsExamples::BinaryReadBuffer;
+
+/// Detector element of a restored sensitive surface with its nominal transform
+class CachedDetectorElement final : public Acts::IdentifiedDetectorElement {
+ public:
+  CachedDetectorElement(
+      const Acts::Transform3D& transform, double thickness,
+      Identifier identifier,
+      std::shared_ptr<const Acts::DigitizationModule> digitizationModule)
+      : m_transform(transform),
+        m_thickness(thickness),
+        m_identifier(std::move(identifier)),
+        m_digitizationModule(std::move(digitizationModule)) {}
+
+  const Acts::Transform3D& transform(
+      const Acts::GeometryContext& /*gctx*/) const final {
+    return m_transform;
+  }
+
+  const Acts::Surface& surface() const final { return *m_surface; }
+
+  double thickness() const final { return m_thickness; }
+
+  Identifier identifier() const final { return m_identifier; }
+
+  const std::shared_ptr<const Acts::DigitizationModule> digitizationModule()
+      const final {
+    return m_digitizationModule;
+  }
+
+  void attachSurface(const Acts::Surface& surface) { m_surface = &surface; }
+
+ private:
+  Acts::Transform3D m_transform;
+  double m_thickness;
+  Identifier m_identifier;
+  std::shared_ptr<const Acts::DigitizationModule> m_digitizationModule;
+  const Acts::Surface* m_surface = nullptr;
+};
+
+/// The restored geometry together with the detector elements it refers to
+struct CachedTrackingGeometry {
+  // the detector elements must outlive the surfaces of the geometry
+  std::vector<std::unique_ptr<CachedDetectorElement>> elements;
+  std::unique_ptr<const Acts::TrackingGeometry> geometry;
+};
+
+/// Create bounds from their values with the size checked
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> makeBounds(const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> array;
+  if (values.size() != array.size()) {
+    throw std::runtime_error("Inconsistent number of bound values");
+  }
+  std::copy(values.begin(), values.end(), array.begin());
+  return std::make_shared<const bounds_t>(array);
+}
+
+struct BoundsRecord {
+  uint32_t type;
+  std::vector<double> values;
+};
+
+BoundsRecord readBounds(BinaryReadBuffer& buffer) {
+  BoundsRecord bounds;
+  bounds.type = buffer.read<uint32_t>();
+  bounds.values = buffer.readVector<double>();
+  return bounds;
+}
+
+std::shared_ptr<const Acts::PlanarBounds> makePlanarBounds(
+    const BoundsRecord& bounds) {
+  switch (bounds.type) {
+    case Acts::SurfaceBounds::eBoundless:
+      return nullptr;
+    case Acts::SurfaceBounds::eRectangle:
+      return makeBounds<Acts::RectangleBounds>(bounds.values);
+    case Acts::SurfaceBounds::eTrapezoid:
+      return makeBounds<Acts::TrapezoidBounds>(bounds.values);
+    case Acts::SurfaceBounds::eDiamond:
+      return makeBounds<Acts::DiamondBounds>(bounds.values);
+    case Acts::SurfaceBounds::eEllipse:
+      return makeBounds<Acts::EllipseBounds>(bounds.values);
+    case Acts::SurfaceBounds::eConvexPolygon: {
+      std::vector<Acts::Vector2D> vertices;
+      for (size_t i = 0; i + 1 < bounds.values.size(); i += 2) {
+        vertices.emplace_back(bounds.values[i], bounds.values[i + 1]);
+      }
+      return std::make_shared<
+          const Acts::ConvexPolygonBounds<Acts::PolygonDynamic>>(vertices);
+    }
+    default:
+      throw std::runtime_error("Unsupported planar bounds type " +
+                               std::to_string(bounds.type));
+  }
+}
+
+std::shared_ptr<const Acts::DiscBounds> makeDiscBounds(
+    const BoundsRecord& bounds) {
+  switch (bounds.type) {
+    case Acts::SurfaceBounds::eBoundless:
+      return nullptr;
+    case Acts::SurfaceBounds::eDisc:
+      return makeBounds<Acts::RadialBounds>(bounds.values);
+    case Acts::SurfaceBounds::eDiscTrapezoid:
+      return makeBounds<Acts::DiscTrapezoidBounds>(bounds.values);
+    case Acts::SurfaceBounds::eAnnulus:
+      return makeBounds<Acts::AnnulusBounds>(bounds.values);
+    default:
+      throw std::runtime_error("Unsupported disc bounds type " +
+                               std::to_string(bounds.type));
+  }
+}
+
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> makeOptionalBounds(const BoundsRecord& bounds,
+                                                   uint32_t type) {
+  if (bounds.type == Acts::SurfaceBounds::eBoundless) {
+    return nullptr;
+  }
+  if (bounds.type != type) {
+    throw std::runtime_error("Unsupported bounds type " +
+                             std::to_string(bounds.type));
+  }
+  return makeBounds<bounds_t>(bounds.values);
+}
+
+std::shared_ptr<const Acts::VolumeBounds> makeVolumeBounds(
+    const BoundsRecord& bounds) {
+  switch (bounds.type) {
+    case Acts::VolumeBounds::eCone:
+      return makeBounds<Acts::ConeVolumeBounds>(bounds.values);
+    case Acts::VolumeBounds::eCuboid:
+      return makeBounds<Acts::CuboidVolumeBounds>(bounds.values);
+    case Acts::VolumeBounds::eCutoutCylinder:
+      return makeBounds<Acts::CutoutCylinderVolumeBounds>(bounds.values);
+    case Acts::VolumeBounds::eCylinder:
+      return makeBounds<Acts::CylinderVolumeBounds>(bounds.values);
+    case Acts::VolumeBounds::eGenericCuboid:
+      return makeBounds<Acts::GenericCuboidVolumeBounds>(bounds.values);
+    case Acts::VolumeBounds::eTrapezoid:
+      return makeBounds<Acts::TrapezoidVolumeBounds>(bounds.values);
+    default:
+      throw std::runtime_error("Unsupported volume bounds type " +
+                               std::to_string(bounds.type));
+  }
+}
+
+std::shared_ptr<const Acts::ISurfaceMaterial> readMaterial(
+    BinaryReadBuffer& buffer) {
+  const auto record = buffer.readVector<char>();
+  if (record.empty()) {
+    return nullptr;
+  }
+  return ActsExamples::BinaryMaterialFormat::decodeSurfaceMaterial(
+      record.data(), record.size());
+}
+
+Acts::BinUtility readBinUtility(BinaryReadBuffer& buffer) {
+  const auto nDims = buffer.read<uint32_t>();
+  Acts::BinUtility binUtility(buffer.readTransform());
+  if (nDims > 3u) {
+    throw std::runtime_error("Invalid binning dimension");
+  }
+  for (uint32_t i = 0; i < nDims; ++i) {
+    auto option = static_cast<Acts::BinningOption>(buffer.read<uint32_t>());
+    auto value = static_cast<Acts::BinningValue>(buffer.read<uint32_t>());
+    auto type = static_cast<Acts::BinningType>(buffer.read<uint32_t>());
+    const auto bins = buffer.read<uint32_t>();
+    const auto min = buffer.read<float>();
+    const auto max = buffer.read<float>();
+    const auto boundaries = buffer.readVector<float>();
+    if (type == Acts::arbitrary) {
+      binUtility += Acts::BinUtility(
+          Acts::BinningData(option, value, boundaries), Acts::s_idTransform);
+    } else {
+      binUtility += Acts::BinUtility(
+          Acts::BinningData(option, value, bins, min, max),
+          Acts::s_idTransform);
+    }
+  }
+  return binUtility;
+}
+
+/// Read a binned array with the objects given by their index
+template <typename T, typename object_t>
+std::unique_ptr<Acts::BinnedArrayXD<T>> readBinnedArray(
+    BinaryReadBuffer& buffer, object_t&& object) {
+  if (buffer.read<uint8_t>() == 0u) {
+    return std::make_unique<Acts::BinnedArrayXD<T>>(
+        object(buffer.read<uint32_t>()));
+  }
+  auto binUtility =
+      std::make_unique<const Acts::BinUtility>(readBinUtility(buffer));
+  const auto bins2 = buffer.read<uint64_t>();
+  const auto bins1 = buffer.read<uint64_t>();
+  const auto bins0 = buffer.read<uint64_t>();
+  if (bins2 != binUtility->bins(2) or bins1 != binUtility->bins(1) or
+      bins0 != binUtility->bins(0)) {
+    throw std::runtime_error("Binned array does not match its binning");
+  }
+  std::vector<std::vector<std::vector<T>>> grid(
+      bins2, std::vector<std::vector<T>>(bins1, std::vector<T>(bins0)));
+  for (auto& o2 : grid) {
+    for (auto& o1 : o2) {
+      for (auto& o0 : o1) {
+        const auto index = buffer.read<uint32_t>();
+        if (index != Format::s_invalidIndex) {
+          o0 = object(index);
+        }
+      }
+    }
+  }
+  return std::make_unique<Acts::BinnedArrayXD<T>>(grid, std::move(binUtility));
+}
+
+template <Acts::detail::AxisBoundaryType bdt>
+using EquidistantAxis =
+    Acts::detail::Axis<Acts::detail::AxisType::Equidistant, bdt>;
+template <Acts::detail::AxisBoundaryType bdt>
+using VariableAxis = Acts::detail::Axis<Acts::detail::AxisType::Variable, bdt>;
+using AnyAxis =
+    std::variant<EquidistantAxis<Acts::detail::AxisBoundaryType::Open>,
+                 EquidistantAxis<Acts::detail::AxisBoundaryType::Bound>,
+                 EquidistantAxis<Acts::detail::AxisBoundaryType::Closed>,
+                 VariableAxis<Acts::detail::AxisBoundaryType::Open>,
+                 VariableAxis<Acts::detail::AxisBoundaryType::Bound>,
+                 VariableAxis<Acts::detail::AxisBoundaryType::Closed>>;
+
+template <Acts::detail::AxisBoundaryType bdt>
+AnyAxis makeAxis(bool equidistant, double min, double max, size_t nBins,
+                 std::vector<double> edges) {
+  if (equidistant) {
+    return EquidistantAxis<bdt>(min, max, nBins);
+  }
+  return VariableAxis<bdt>(std::move(edges));
+}
+
+AnyAxis readAxis(BinaryReadBuffer& buffer) {
+  using Acts::detail::AxisBoundaryType;
+  const bool equidistant = buffer.read<uint8_t>() != 0u;
+  const auto boundaryType = buffer.read<uint32_t>();
+  const auto nBins = buffer.read<uint64_t>();
+  const auto min = buffer.read<double>();
+  const auto max = buffer.read<double>();
+  auto edges = buffer.readVector<double>();
+  if (not equidistant and edges.size() != nBins + 1) {
+    throw std::runtime_error("Inconsistent variable axis");
+  }
+  switch (static_cast<AxisBoundaryType>(boundaryType)) {
+    case AxisBoundaryType::Open:
+      return makeAxis<AxisBoundaryType::Open>(equidistant, min, max, nBins,
+                                              std::move(edges));
+    case AxisBoundaryType::Bound:
+      return makeAxis<AxisBoundaryType::Bound>(equidistant, min, max, nBins,
+                                               std::move(edges));
+    case AxisBoundaryType::Closed:
+      return makeAxis<AxisBoundaryType::Closed>(equidistant, min, max, nBins,
+                                                std::move(edges));
+  }
+  throw std::runtime_error("Invalid axis boundary type");
+}
+
+/// Decoder of the sections of the file into a tracking geometry
+class GeometryDecoder {
+ public:
+  GeometryDecoder(BinaryReadBuffer buffer, CachedTrackingGeometry& cache)
+      : m_cache(cache) {
+    const auto nModules = buffer.read<uint64_t>();
+    auto modules = buffer.readBlock();
+    m_nSurfaces = buffer.read<uint64_t>();
+    m_surfaceSection = std::make_unique<BinaryReadBuffer>(buffer.readBlock());
+    const auto nVolumeArrays = buffer.read<uint64_t>();
+    auto volumeArrays = buffer.readBlock();
+    const auto nVolumes = buffer.read<uint64_t>();
+    auto volumes = buffer.readBlock();
+    const auto nBoundaries = buffer.read<uint64_t>();
+    auto boundaries = buffer.readBlock();
+    const auto beamline = buffer.read<uint32_t>();
+    if (buffer.remaining() != 0u) {
+      throw std::runtime_error("Inconsistent binary tracking geometry");
+    }
+
+    for (uint64_t i = 0; i < nModules; ++i) {
+      readModule(modules);
+    }
+    readSurfaces();
+    // the volume arrays are built on first use since they refer to volumes
+    for (uint64_t i = 0; i < nVolumeArrays; ++i) {
+      m_volumeArrayRecords.push_back(volumeArrays);
+      readBinnedArray<Acts::TrackingVolumePtr>(
+          volumeArrays, [](uint32_t) { return Acts::TrackingVolumePtr(); });
+    }
+    m_volumeArrays.resize(nVolumeArrays);
+    for (uint64_t i = 0; i < nVolumes; ++i) {
+      readVolume(volumes);
+    }
+    for (uint64_t i = 0; i < nBoundaries; ++i) {
+      readBoundary(boundaries);
+    }
+    for (size_t i = 0; i < m_volumes.size(); ++i) {
+      auto& volume = m_volumes[i];
+      const auto& indices = m_volumeBoundaries[i];
+      if (indices.size() != volume->boundarySurfaces().size()) {
+        throw std::runtime_error("Inconsistent boundaries of volume '" +
+                                 volume->volumeName() + "'");
+      }
+      for (size_t face = 0; face < indices.size(); ++face) {
+        volume->updateBoundarySurface(
+            static_cast<Acts::BoundarySurfaceFace>(face),
+            m_boundaries.at(indices[face]), false);
+      }
+    }
+    if (m_volumes.empty()) {
+      throw std::runtime_error("Binary tracking geometry without volumes");
+    }
+    if (beamline != Format::s_invalidIndex) {
+      m_beamline = std::dynamic_pointer_cast<const Acts::PerigeeSurface>(
+          m_surfaces.at(beamline));
+      if (m_beamline == nullptr) {
+        throw std::runtime_error("Invalid beam line surface");
+      }
+    }
+  }
+
+  const Acts::MutableTrackingVolumePtr& world() const {
+    return m_volumes.back();
+  }
+
+  const std::shared_ptr<const Acts::PerigeeSurface>& beamline() const {
+    return m_beamline;
+  }
+
+  /// Verify the geometry identifiers assigned when closing the geometry
+  void verify() const {
+    auto check = [](const Acts::GeometryObject& object, uint64_t expected,
+                    const char* what) {
+      if (object.geometryId().value() != expected) {
+        std::ostringstream os;
+        os << "Restored " << what << " " << object.geometryId()
+           << " does not match the stored " << Acts::GeometryID(expected);
+        throw std::runtime_error(os.str());
+      }
+    };
+    for (size_t i = 0; i < m_surfaces.size(); ++i) {
+      check(*m_surfaces[i], m_surfaceIds[i], "surface");
+    }
+    for (size_t i = 0; i < m_layers.size(); ++i) {
+      check(*m_layers[i], m_layerIds[i], "layer");
+    }
+    for (size_t i = 0; i < m_volumes.size(); ++i) {
+      check(*m_volumes[i], m_volumeIds[i], "volume");
+    }
+  }
+
+  size_t nSurfaces() const { return m_surfaces.size(); }
+  size_t nVolumes() const { return m_volumes.size(); }
+
+ private:
+  void readModule(BinaryReadBuffer& buffer) {
+    const auto halfThickness = buffer.read<double>();
+    const auto readoutDirection = buffer.read<int32_t>();
+    const auto lorentzAngle = buffer.read<double>();
+    const auto energyThreshold = buffer.read<double>();
+    const bool analogue = buffer.read<uint8_t>() != 0u;
+    auto moduleBounds = makePlanarBounds(readBounds(buffer));
+    auto binUtility =
+        std::make_shared<const Acts::BinUtility>(readBinUtility(buffer));
+    auto segmentation = std::make_shared<const Acts::CartesianSegmentation>(
+        std::move(binUtility), std::move(moduleBounds));
+    m_modules.push_back(std::make_shared<const Acts::DigitizationModule>(
+        std::move(segmentation), halfThickness, readoutDirection,
+        lorentzAngle, energyThreshold, analogue));
+  }
+
+  void readSurfaces() {
+    auto& buffer = *m_surfaceSection;
+    for (uint64_t i = 0; i < m_nSurfaces; ++i) {
+      const auto type = buffer.read<uint32_t>();
+      const auto bounds = readBounds(buffer);
+      const auto transform = buffer.readTransform();
+      const bool sensitive = buffer.read<uint8_t>() != 0u;
+      const auto thickness = buffer.read<double>();
+      const auto identifier = buffer.read<uint64_t>();
+      const auto module = buffer.read<uint32_t>();
+      auto material = readMaterial(buffer);
+      m_surfaceIds.push_back(buffer.read<uint64_t>());
+
+      CachedDetectorElement* element = nullptr;
+      if (sensitive) {
+        m_cache.elements.push_back(
+            std::make_unique<CachedDetectorElement>(
+                transform, thickness, Identifier(identifier_type(identifier)),
+                module != Format::s_invalidIndex ? m_modules.at(module)
+                                                 : nullptr));
+        element = m_cache.elements.back().get();
+      }
+      std::shared_ptr<Acts::Surface> surface;
+      switch (type) {
+        case Acts::Surface::Plane:
+          surface = element ? makeSurface<Acts::PlaneSurface>(
+                                  makePlanarBounds(bounds), *element)
+                            : makeSurface<Acts::PlaneSurface>(
+                                  transform, makePlanarBounds(bounds));
+          break;
+        case Acts::Surface::Disc:
+          surface = element ? makeSurface<Acts::DiscSurface>(
+                                  makeDiscBounds(bounds), *element)
+                            : makeSurface<Acts::DiscSurface>(
+                                  transform, makeDiscBounds(bounds));
+          break;
+        case Acts::Surface::Cylinder:
+          surface = element ? makeSurface<Acts::CylinderSurface>(
+                                  makeBounds<Acts::CylinderBounds>(
+                                      bounds.values),
+                                  *element)
+                            : makeSurface<Acts::CylinderSurface>(
+                                  transform, makeBounds<Acts::CylinderBounds>(
+                                                 bounds.values));
+          break;
+        case Acts::Surface::Straw: {
+          auto lBounds = makeOptionalBounds<Acts::LineBounds>(
+              bounds, Acts::SurfaceBounds::eLine);
+          surface = element ? makeSurface<Acts::StrawSurface>(lBounds, *element)
+                            : makeSurface<Acts::StrawSurface>(transform,
+                                                              lBounds);
+          break;
+        }
+        case Acts::Surface::Cone:
+          surface = makeSurface<Acts::ConeSurface>(
+              transform, makeBounds<Acts::ConeBounds>(bounds.values));
+          break;
+        case Acts::Surface::Perigee:
+          surface = makeSurface<Acts::PerigeeSurface>(transform);
+          break;
+        default:
+          throw std::runtime_error("Unsupported surface type " +
+                                   std::to_string(type));
+      }
+      if (element != nullptr) {
+        if (type == Acts::Surface::Cone or type == Acts::Surface::Perigee) {
+          throw std::runtime_error("Unsupported surface type " +
+                                   std::to_string(type) +
+                                   " of a detector element");
+        }
+        element->attachSurface(*surface);
+      }
+      surface->assignSurfaceMaterial(std::move(material));
+      m_surfaces.push_back(std::move(surface));
+    }
+  }
+
+  template <typename surface_t, typename... args_t>
+  static std::shared_ptr<Acts::Surface> makeSurface(args_t&&... args) {
+    return Acts::Surface::makeShared<surface_t>(std::forward<args_t>(args)...);
+  }
+
+  const std::shared_ptr<Acts::Surface>& surface(uint32_t index) const {
+    if (index >= m_surfaces.size()) {
+      throw std::runtime_error("Invalid surface index");
+    }
+    return m_surfaces[index];
+  }
+
+  std::unique_ptr<Acts::SurfaceArray> readSurfaceArray(
+      BinaryReadBuffer& buffer) {
+    const auto kind = buffer.read<uint32_t>();
+    if (kind == Format::noSurfaceArray) {
+      return nullptr;
+    }
+    if (kind == Format::singleElement) {
+      return std::make_unique<Acts::SurfaceArray>(
+          surface(buffer.read<uint32_t>()));
+    }
+
+    const auto transform = buffer.readTransform();
+    const auto position = buffer.read<double>();
+    std::vector<Acts::BinningValue> bValues;
+    std::vector<AnyAxis> axes;
+    for (size_t i = 0; i < 2u; ++i) {
+      bValues.push_back(
+          static_cast<Acts::BinningValue>(buffer.read<uint32_t>()));
+      axes.push_back(readAxis(buffer));
+    }
+
+    // The local coordinates follow the SurfaceArrayCreator
+    using Acts::VectorHelpers::perp;
+    using Acts::VectorHelpers::phi;
+    const Acts::Transform3D itransform = transform.inverse();
+    std::function<Acts::Vector2D(const Acts::Vector3D&)> globalToLocal;
+    std::function<Acts::Vector3D(const Acts::Vector2D&)> localToGlobal;
+    if (kind == Format::cylinderArray) {
+      globalToLocal = [transform](const Acts::Vector3D& pos) {
+        Acts::Vector3D loc = transform * pos;
+        return Acts::Vector2D(phi(loc), loc.z());
+      };
+      localToGlobal = [itransform, position](const Acts::Vector2D& loc) {
+        return Acts::Vector3D(itransform *
+                              Acts::Vector3D(position * std::cos(loc[0]),
+                                             position * std::sin(loc[0]),
+                                             loc[1]));
+      };
+    } else if (kind == Format::discArray) {
+      globalToLocal = [transform](const Acts::Vector3D& pos) {
+        Acts::Vector3D loc = transform * pos;
+        return Acts::Vector2D(perp(loc), phi(loc));
+      };
+      localToGlobal = [itransform, position](const Acts::Vector2D& loc) {
+        return Acts::Vector3D(
+            itransform * Acts::Vector3D(loc[0] * std::cos(loc[1]),
+                                        loc[0] * std::sin(loc[1]), position));
+      };
+    } else if (kind == Format::planeArray) {
+      globalToLocal = [transform](const Acts::Vector3D& pos) {
+        Acts::Vector3D loc = transform * pos;
+        return Acts::Vector2D(loc.x(), loc.y());
+      };
+      localToGlobal = [itransform](const Acts::Vector2D& loc) {
+        return Acts::Vector3D(itransform *
+                              Acts::Vector3D(loc.x(), loc.y(), 0.));
+      };
+    } else {
+      throw std::runtime_error("Unsupported surface array kind");
+    }
+
+    std::unique_ptr<Acts::SurfaceArray::ISurfaceGridLookup> lookup;
+    std::visit(
+        [&](auto axisA, auto axisB) {
+          using Lookup = Acts::SurfaceArray::SurfaceGridLookup<decltype(axisA),
+                                                               decltype(axisB)>;
+          lookup = std::make_unique<Lookup>(globalToLocal, localToGlobal,
+                                            std::make_tuple(axisA, axisB),
+                                            bValues);
+        },
+        axes[0], axes[1]);
+
+    std::vector<std::shared_ptr<const Acts::Surface>> surfaces;
+    Acts::SurfaceVector rawSurfaces;
+    for (auto index : buffer.readVector<uint32_t>()) {
+      surfaces.push_back(surface(index));
+      rawSurfaces.push_back(surfaces.back().get());
+    }
+    if (buffer.read<uint64_t>() != lookup->size()) {
+      throw std::runtime_error("Surface array does not match its axes");
+    }
+    for (size_t bin = 0; bin < lookup->size(); ++bin) {
+      auto& content = lookup->lookup(bin);
+      for (auto index : buffer.readVector<uint32_t>()) {
+        content.push_back(rawSurfaces.at(index));
+      }
+    }
+    // filling without surfaces only builds the neighbor cache
+    lookup->fill(m_gctx, {});
+    return std::make_unique<Acts::SurfaceArray>(std::move(lookup),
+                                                std::move(surfaces), transform);
+  }
+
+  Acts::LayerPtr readLayer(BinaryReadBuffer& buffer) {
+    const auto kind = buffer.read<uint32_t>();
+    const auto layerType =
+        static_cast<Acts::LayerType>(buffer.read<uint32_t>());
+    const auto thickness = buffer.read<double>();
+    std::shared_ptr<const Acts::Surface> navigationSurface;
+    BoundsRecord bounds;
+    Acts::Transform3D transform;
+    std::shared_ptr<const Acts::ISurfaceMaterial> material;
+    if (kind == Format::navigationLayer) {
+      navigationSurface = surface(buffer.read<uint32_t>());
+    } else {
+      bounds = readBounds(buffer);
+      transform = buffer.readTransform();
+      material = readMaterial(buffer);
+    }
+    m_layerIds.push_back(buffer.read<uint64_t>());
+
+    std::unique_ptr<Acts::ApproachDescriptor> approach;
+    if (buffer.read<uint8_t>() != 0u) {
+      std::vector<std::shared_ptr<const Acts::Surface>> surfaces;
+      for (auto index : buffer.readVector<uint32_t>()) {
+        surfaces.push_back(surface(index));
+      }
+      approach = std::make_unique<Acts::GenericApproachDescriptor>(
+          std::move(surfaces));
+    }
+    auto surfaceArray = readSurfaceArray(buffer);
+    const auto* sensitive = surfaceArray.get();
+
+    Acts::MutableLayerPtr layer;
+    switch (kind) {
+      case Format::cylinderLayer:
+        layer = Acts::CylinderLayer::create(
+            transform, makeBounds<Acts::CylinderBounds>(bounds.values),
+            std::move(surfaceArray), thickness, std::move(approach),
+            layerType);
+        break;
+      case Format::discLayer:
+        layer = Acts::DiscLayer::create(transform, makeDiscBounds(bounds),
+                                        std::move(surfaceArray), thickness,
+                                        std::move(approach), layerType);
+        break;
+      case Format::planeLayer:
+        layer = Acts::PlaneLayer::create(transform, makePlanarBounds(bounds),
+                                         std::move(surfaceArray), thickness,
+                                         std::move(approach), layerType);
+        break;
+      case Format::navigationLayer:
+        if (approach != nullptr or surfaceArray != nullptr or
+            layerType != Acts::navigation) {
+          throw std::runtime_error("Inconsistent navigation layer");
+        }
+        layer = std::const_pointer_cast<Acts::Layer>(
+            Acts::NavigationLayer::create(std::move(navigationSurface),
+                                          thickness));
+        break;
+      default:
+        throw std::runtime_error("Unsupported layer kind " +
+                                 std::to_string(kind));
+    }
+    if (kind != Format::navigationLayer) {
+      layer->surfaceRepresentation().assignSurfaceMaterial(
+          std::move(material));
+    }
+    if (sensitive != nullptr) {
+      for (const auto* srf : sensitive->surfaces()) {
+        const_cast<Acts::Surface*>(srf)->associateLayer(*layer);
+      }
+    }
+    m_layers.push_back(layer);
+    return layer;
+  }
+
+  std::shared_ptr<const Acts::TrackingVolumeArray> volumeArray(
+      uint32_t index) {
+    if (index == Format::s_invalidIndex) {
+      return nullptr;
+    }
+    if (index >= m_volumeArrays.size()) {
+      throw std::runtime_error("Invalid volume array index");
+    }
+    if (m_volumeArrays[index] == nullptr) {
+      auto record = m_volumeArrayRecords[index];
+      m_volumeArrays[index] = readBinnedArray<Acts::TrackingVolumePtr>(
+          record, [this](uint32_t volume) { return m_volumes.at(volume); });
+    }
+    return m_volumeArrays[index];
+  }
+
+  void readVolume(BinaryReadBuffer& buffer) {
+    const auto name = buffer.readString();
+    const auto transform = buffer.readTransform();
+    auto bounds = makeVolumeBounds(readBounds(buffer));
+
+    std::shared_ptr<const Acts::IVolumeMaterial> material;
+    switch (buffer.read<uint32_t>()) {
+      case Format::noVolumeMaterial:
+        break;
+      case Format::homogeneousVolumeMaterial: {
+        const auto values = buffer.readVector<float>();
+        Acts::Material::ParametersVector parameters;
+        if (values.size() != size_t(parameters.size())) {
+          throw std::runtime_error("Inconsistent volume material");
+        }
+        std::copy(values.begin(), values.end(), parameters.data());
+        material = std::make_shared<const Acts::HomogeneousVolumeMaterial>(
+            Acts::Material(parameters));
+        break;
+      }
+      case Format::protoVolumeMaterial:
+        material = std::make_shared<const Acts::ProtoVolumeMaterial>(
+            readBinUtility(buffer));
+        break;
+      default:
+        throw std::runtime_error("Unsupported volume material type");
+    }
+
+    std::unique_ptr<const Acts::LayerArray> layerArray;
+    if (buffer.read<uint8_t>() != 0u) {
+      const auto nLayers = buffer.read<uint64_t>();
+      std::vector<Acts::LayerPtr> layers;
+      for (uint64_t i = 0; i < nLayers; ++i) {
+        layers.push_back(readLayer(buffer));
+      }
+      layerArray = readBinnedArray<Acts::LayerPtr>(
+          buffer, [&](uint32_t layer) { return layers.at(layer); });
+    }
+    auto confined = volumeArray(buffer.read<uint32_t>());
+
+    m_volumes.push_back(Acts::TrackingVolume::create(
+        transform, std::move(bounds), std::move(material),
+        std::move(layerArray), std::move(confined), {}, name));
+    m_volumeBoundaries.push_back(buffer.readVector<uint32_t>());
+    m_volumeIds.push_back(buffer.read<uint64_t>());
+  }
+
+  void readBoundary(BinaryReadBuffer& buffer) {
+    auto boundarySurface = surface(buffer.read<uint32_t>());
+    auto volume = [this](uint32_t index) -> const Acts::TrackingVolume* {
+      return index == Format::s_invalidIndex ? nullptr
+                                             : m_volumes.at(index).get();
+    };
+    const auto* opposite = volume(buffer.read<uint32_t>());
+    const auto* along = volume(buffer.read<uint32_t>());
+    auto oppositeArray = volumeArray(buffer.read<uint32_t>());
+    auto alongArray = volumeArray(buffer.read<uint32_t>());
+
+    auto boundary = std::make_shared<Acts::BoundarySurface>(
+        boundarySurface, opposite, along);
+    if (oppositeArray != nullptr) {
+      boundary->attachVolumeArray(oppositeArray, Acts::backward);
+    }
+    if (alongArray != nullptr) {
+      boundary->attachVolumeArray(alongArray, Acts::forward);
+    }
+    m_boundaries.push_back(std::move(boundary));
+  }
+
+  CachedTrackingGeometry& m_cache;
+  /// The nominal geometry context
+  Acts::GeometryContext m_gctx;
+
+  std::vector<std::shared_ptr<const Acts::DigitizationModule>> m_modules;
+  uint64_t m_nSurfaces = 0;
+  std::unique_ptr<BinaryReadBuffer> m_surfaceSection;
+  std::vector<BinaryReadBuffer> m_volumeArrayRecords;
+
+  std::vector<std::shared_ptr<Acts::Surface>> m_surfaces;
+  std::vector<uint64_t> m_surfaceIds;
+  std::vector<Acts::LayerPtr> m_layers;
+  std::vector<uint64_t> m_layerIds;
+  std::vector<std::shared_ptr<const Acts::TrackingVolumeArray>> m_volumeArrays;
+  std::vector<Acts::MutableTrackingVolumePtr> m_volumes;
+  std::vector<std::vector<uint32_t>> m_volumeBoundaries;
+  std::vector<uint64_t> m_volumeIds;
+  std::vector<std::shared_ptr<const Acts::BoundarySurface>> m_boundaries;
+  std::shared_ptr<const Acts::PerigeeSurface> m_beamline;
+};
+
+}  // namespace
+
+ActsExamples::BinaryGeometryReader::BinaryGeometryReader(const Config& cfg)
+    : m_cfg(cfg) {
+  // Validate the configuration
+  if (not m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  } else if (m_cfg.name.empty()) {
+    throw std::invalid_argument("Missing service name");
+  }
+}
+
+std::shared_ptr<const Acts::TrackingGeometry>
+ActsExamples::BinaryGeometryReader::read(
+    const Acts::IMaterialDecorator* materialDecorator) const {
+  auto file = mapFile(m_cfg.fileName);
+  BinaryReadBuffer buffer(file.data.get(), file.size);
+  if (file.size < sizeof(Format::Header)) {
+    throw std::runtime_error("'" + m_cfg.fileName +
+                             "' is not a binary tracking geometry");
+  }
+  const auto header = buffer.read<Format::Header>();
+  if (std::memcmp(header.magic, Format::s_magic, sizeof(Format::s_magic)) !=
+      0) {
+    throw std::runtime_error("'" + m_cfg.fileName +
+                             "' is not a binary tracking geometry");
+  }
+  if (header.version != Format::s_version) {
+    throw std::runtime_error("Unsupported binary tracking geometry version " +
+                             std::to_string(header.version) + " in '" +
+                             m_cfg.fileName + "'");
+  }
+  if (header.byteOrderMark != Format::s_byteOrderMark) {
+    throw std::runtime_error("Binary tracking geometry '" + m_cfg.fileName +
+                             "' was written with a different byte order");
+  }
+  if (header.fileSize != file.size) {
+    throw std::runtime_error("Inconsistent or truncated binary tracking "
+                             "geometry '" +
+                             m_cfg.fileName + "'");
+  }
+
+  auto cache = std::make_shared<CachedTrackingGeometry>();
+  GeometryDecoder decoder(buffer, *cache);
+  // the geometry is completed before it becomes const
+  auto geometry = std::make_unique<Acts::TrackingGeometry>(decoder.world(),
+                                                           materialDecorator);
+  if (decoder.beamline() != nullptr) {
+    geometry->registerBeamTube(decoder.beamline());
+  }
+  cache->geometry = std::move(geometry);
+  decoder.verify();
+  ACTS_INFO("Read " << decoder.nVolumes() << " volumes and "
+                    << decoder.nSurfaces() << " surfaces from '"
+                    << m_cfg.fileName << "'");
+
+  // the geometry shares the ownership of the detector elements
+  return std::shared_ptr<const Acts::TrackingGeometry>(
+      cache, cache->geometry.get());
+}
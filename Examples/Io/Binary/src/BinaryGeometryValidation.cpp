@@ -0,0 +1,109 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryGeometryValidation.hpp"
+
+#include "Acts/EventData/NeutralTrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace {
+
+using Propagator = Acts::Propagator<Acts::StraightLineStepper, Acts::Navigator>;
+using Collector = Acts::SurfaceCollector<Acts::SurfaceSelector>;
+
+/// Collect the sensitive and material surfaces crossed by a straight line,
+/// nothing if the propagation fails
+std::optional<std::vector<Acts::SurfaceHit>> navigate(
+    const Propagator& propagator, const Acts::GeometryContext& gctx,
+    const Acts::MagneticFieldContext& mctx,
+    const Acts::NeutralCurvilinearTrackParameters& start,
+    Acts::LoggerWrapper logger) {
+  Acts::PropagatorOptions<Acts::ActionList<Collector>,
+                          Acts::AbortList<Acts::EndOfWorldReached>>
+      options(gctx, mctx, logger);
+  options.actionList.get<Collector>().selector =
+      Acts::SurfaceSelector(true, true, false);
+  auto result = propagator.propagate(start, options);
+  if (not result.ok()) {
+    return std::nullopt;
+  }
+  return result.value().get<Collector::result_type>().collected;
+}
+
+}  // namespace
+
+size_t ActsExamples::compareNavigation(
+    const std::shared_ptr<const Acts::TrackingGeometry>& reference,
+    const std::shared_ptr<const Acts::TrackingGeometry>& restored, size_t nEta,
+    size_t nPhi, Acts::LoggerWrapper logger) {
+  using namespace Acts::UnitLiterals;
+
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+  Propagator referencePropagator(Acts::StraightLineStepper{},
+                                 Acts::Navigator(reference));
+  Propagator restoredPropagator(Acts::StraightLineStepper{},
+                                Acts::Navigator(restored));
+
+  size_t nMismatches = 0;
+  for (size_t iEta = 0; iEta < nEta; ++iEta) {
+    const double eta = -4. + (iEta + 0.5) * 8. / nEta;
+    const double theta = 2. * std::atan(std::exp(-eta));
+    for (size_t iPhi = 0; iPhi < nPhi; ++iPhi) {
+      const double phi = -M_PI + (iPhi + 0.5) * 2. * M_PI / nPhi;
+      Acts::NeutralCurvilinearTrackParameters start(Acts::Vector4D::Zero(),
+                                                    phi, theta, 1. / 1_GeV);
+      auto expected =
+          navigate(referencePropagator, gctx, mctx, start, logger);
+      auto actual = navigate(restoredPropagator, gctx, mctx, start, logger);
+
+      // a failed propagation can not be compared and counts as mismatch
+      if (not expected or not actual) {
+        ++nMismatches;
+        ACTS_ERROR("Navigation failed for eta = "
+                   << eta << ", phi = " << phi << ": propagation "
+                   << (expected ? "succeeded" : "failed")
+                   << " in the original and "
+                   << (actual ? "succeeded" : "failed")
+                   << " in the restored geometry");
+        continue;
+      }
+      bool match = expected->size() == actual->size();
+      for (size_t i = 0; match and i < expected->size(); ++i) {
+        match = (*expected)[i].surface->geometryId() ==
+                    (*actual)[i].surface->geometryId() and
+                ((*expected)[i].position - (*actual)[i].position).norm() <
+                    1_um;
+      }
+      if (not match) {
+        ++nMismatches;
+        ACTS_ERROR("Navigation differs for eta = "
+                   << eta << ", phi = " << phi << ": " << expected->size()
+                   << " surfaces in the original and " << actual->size()
+                   << " in the restored geometry");
+      }
+    }
+  }
+  ACTS_INFO("Compared the navigation of " << nEta * nPhi << " lines, "
+                                          << nMismatches << " differ");
+  return nMismatches;
+}
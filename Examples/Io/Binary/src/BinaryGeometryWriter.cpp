@@ -0,0 +1,502 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryGeometryWriter.hpp"
+
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/ProtoVolumeMaterial.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Identification/IdentifiedDetectorElement.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "BinaryBuffer.hpp"
+#include "BinaryGeometryFormat.hpp"
+#include "BinaryMaterialRecord.hpp"
+
+namespace {
+
+namespace Format = ActsExamples::BinaryGeometryFormat;
+
+using ActsExamples::BinaryWriteBuffer;
+
+/// Write the bounds as their type and their values
+template <typename bounds_t>
+void writeBounds(BinaryWriteBuffer& buffer, const bounds_t& bounds) {
+  buffer.write<uint32_t>(bounds.type());
+  buffer.write(bounds.values());
+}
+
+/// Write the surface material as a record of the material map format
+void writeMaterial(BinaryWriteBuffer& buffer,
+                   const Acts::ISurfaceMaterial* material) {
+  std::vector<char> record;
+  if (material != nullptr and
+      not ActsExamples::BinaryMaterialFormat::encodeSurfaceMaterial(*material,
+                                                                    record)) {
+    throw std::invalid_argument("Unsupported surface material type");
+  }
+  buffer.writeBlock(record);
+}
+
+void writeBinUtility(BinaryWriteBuffer& buffer,
+                     const Acts::BinUtility& binUtility) {
+  buffer.write<uint32_t>(binUtility.binningData().size());
+  buffer.write(binUtility.transform());
+  for (const auto& bData : binUtility.binningData()) {
+    if (bData.subBinningData) {
+      throw std::invalid_argument("Sub-binning is not supported");
+    }
+    buffer.write<uint32_t>(bData.option);
+    buffer.write<uint32_t>(bData.binvalue);
+    buffer.write<uint32_t>(bData.type);
+    buffer.write<uint32_t>(bData.bins());
+    buffer.write(bData.min);
+    buffer.write(bData.max);
+    buffer.write(bData.type == Acts::arbitrary ? bData.boundaries()
+                                               : std::vector<float>());
+  }
+}
+
+/// Write the binning and the object grid of a binned array
+///
+/// The objects are written as their index given by the callable, and the
+/// order of the array objects is required to follow from the grid.
+template <typename T, typename index_t>
+void writeBinnedArray(BinaryWriteBuffer& buffer,
+                      const Acts::BinnedArray<T>& array, index_t&& index) {
+  std::vector<T> gridObjects;
+  const auto& grid = array.objectGrid();
+  buffer.write<uint8_t>(array.binUtility() != nullptr);
+  if (array.binUtility() != nullptr) {
+    writeBinUtility(buffer, *array.binUtility());
+    buffer.write<uint64_t>(grid.size());
+    buffer.write<uint64_t>(grid.empty() ? 0u : grid[0].size());
+    buffer.write<uint64_t>(grid.empty() or grid[0].empty() ? 0u
+                                                           : grid[0][0].size());
+    for (const auto& o2 : grid) {
+      for (const auto& o1 : o2) {
+        if (o1.size() != grid[0][0].size() or o2.size() != grid[0].size()) {
+          throw std::invalid_argument("Irregular binned array grid");
+        }
+        for (const auto& o0 : o1) {
+          buffer.write<uint32_t>(o0 ? index(o0) : Format::s_invalidIndex);
+          if (o0 and std::find(gridObjects.begin(), gridObjects.end(), o0) ==
+                         gridObjects.end()) {
+            gridObjects.push_back(o0);
+          }
+        }
+      }
+    }
+  } else {
+    gridObjects.push_back(array.arrayObjects().at(0));
+    buffer.write<uint32_t>(index(gridObjects[0]));
+  }
+  if (gridObjects != array.arrayObjects()) {
+    throw std::invalid_argument(
+        "Binned array objects are not ordered by their bins");
+  }
+}
+
+/// Encoder of a closed tracking geometry into the sections of the file
+class GeometryEncoder {
+ public:
+  GeometryEncoder(const Acts::TrackingGeometry& tGeometry,
+                  const Acts::Logger& logger)
+      : m_logger(logger) {
+    collectVolumes(*tGeometry.highestTrackingVolume());
+    for (const auto* volume : m_volumes) {
+      writeVolume(*volume);
+    }
+    m_beamline = tGeometry.getBeamline() != nullptr
+                     ? surfaceIndex(*tGeometry.getBeamline())
+                     : Format::s_invalidIndex;
+  }
+
+  /// Concatenate all sections
+  std::vector<char> data() const {
+    BinaryWriteBuffer buffer;
+    Format::Header header{};
+    buffer.write(header);
+    for (const auto& [count, section] :
+         {std::make_pair(m_moduleIndices.size(), &m_modules),
+         std::make_pair(m_surfaceIndices.size(), &m_surfaces),
+          std::make_pair(m_volumeArrayIndices.size(), &m_volumeArrays),
+          std::make_pair(m_volumes.size(), &m_volumeRecords),
+          std::make_pair(m_boundaryIndices.size(), &m_boundaries)}) {
+      buffer.write<uint64_t>(count);
+      buffer.writeBlock(section->data());
+    }
+    buffer.write(m_beamline);
+    return buffer.data();
+  }
+
+  size_t nSurfaces() const { return m_surfaceIndices.size(); }
+  size_t nVolumes() const { return m_volumes.size(); }
+
+ private:
+  const Acts::Logger& logger() const { return m_logger; }
+
+  /// Collect all volumes in post-order
+  void collectVolumes(const Acts::TrackingVolume& volume) {
+    if (not volume.denseVolumes().empty() or
+        volume.hasBoundingVolumeHierarchy()) {
+      throw std::invalid_argument(
+          "Dense volumes and bounding volume hierarchies are not supported");
+    }
+    if (volume.confinedVolumes()) {
+      for (const auto& confined : volume.confinedVolumes()->arrayObjects()) {
+        collectVolumes(*confined);
+      }
+    }
+    m_volumeIndices.emplace(&volume, m_volumes.size());
+    m_volumes.push_back(&volume);
+  }
+
+  uint32_t volumeIndex(const Acts::TrackingVolume* volume) const {
+    if (volume == nullptr) {
+      return Format::s_invalidIndex;
+    }
+    auto it = m_volumeIndices.find(volume);
+    if (it == m_volumeIndices.end()) {
+      throw std::invalid_argument("Volume '" + volume->volumeName() +
+                                  "' is not part of the volume hierarchy");
+    }
+    return it->second;
+  }
+
+  uint32_t surfaceIndex(const Acts::Surface& surface) {
+    auto [it, inserted] =
+        m_surfaceIndices.emplace(&surface, m_surfaceIndices.size());
+    if (not inserted) {
+      return it->second;
+    }
+    m_surfaces.write<uint32_t>(surface.type());
+    writeBounds(m_surfaces, surface.bounds());
+    m_surfaces.write(surface.transform(m_gctx));
+    const auto* element = surface.associatedDetectorElement();
+    if (element != nullptr and surface.type() != Acts::Surface::Plane and
+        surface.type() != Acts::Surface::Disc and
+        surface.type() != Acts::Surface::Cylinder and
+        surface.type() != Acts::Surface::Straw) {
+      throw std::invalid_argument(
+          "Unsupported surface type of a detector element");
+    }
+    m_surfaces.write<uint8_t>(element != nullptr);
+    m_surfaces.write(element != nullptr ? element->thickness() : 0.);
+    // elements without identification are stored without identifier and
+    // digitization module
+    const auto* identified =
+        dynamic_cast<const Acts::IdentifiedDetectorElement*>(element);
+    m_surfaces.write<uint64_t>(
+        identified != nullptr ? identifier_type(identified->identifier())
+                              : 0u);
+    m_surfaces.write(identified != nullptr
+                         ? moduleIndex(identified->digitizationModule().get())
+                         : Format::s_invalidIndex);
+    writeMaterial(m_surfaces, surface.surfaceMaterial());
+    m_surfaces.write(surface.geometryId().value());
+    return it->second;
+  }
+
+  uint32_t moduleIndex(const Acts::DigitizationModule* module) {
+    if (module == nullptr) {
+      return Format::s_invalidIndex;
+    }
+    auto [it, inserted] =
+        m_moduleIndices.emplace(module, m_moduleIndices.size());
+    if (not inserted) {
+      return it->second;
+    }
+    const auto* segmentation =
+        dynamic_cast<const Acts::CartesianSegmentation*>(
+            &module->segmentation());
+    if (segmentation == nullptr) {
+      throw std::invalid_argument("Unsupported digitization segmentation");
+    }
+    m_modules.write(module->halfThickness());
+    m_modules.write<int32_t>(module->readoutDirection());
+    m_modules.write(module->lorentzAngle());
+    m_modules.write(module->energyThreshold());
+    m_modules.write<uint8_t>(module->analogue());
+    writeBounds(m_modules, segmentation->moduleBounds());
+    writeBinUtility(m_modules, segmentation->binUtility());
+    return it->second;
+  }
+
+  uint32_t volumeArrayIndex(
+      const std::shared_ptr<const Acts::TrackingVolumeArray>& array) {
+    if (array == nullptr) {
+      return Format::s_invalidIndex;
+    }
+    auto [it, inserted] =
+        m_volumeArrayIndices.emplace(array.get(), m_volumeArrayIndices.size());
+    if (inserted) {
+      writeBinnedArray(m_volumeArrays, *array,
+                       [this](const Acts::TrackingVolumePtr& volume) {
+                         return volumeIndex(volume.get());
+                       });
+    }
+    return it->second;
+  }
+
+  uint32_t boundaryIndex(const Acts::BoundarySurface& boundary) {
+    auto [it, inserted] =
+        m_boundaryIndices.emplace(&boundary, m_boundaryIndices.size());
+    if (inserted) {
+      m_boundaries.write(surfaceIndex(boundary.surfaceRepresentation()));
+      m_boundaries.write(volumeIndex(boundary.oppositeVolume()));
+      m_boundaries.write(volumeIndex(boundary.alongVolume()));
+      m_boundaries.write(volumeArrayIndex(boundary.oppositeVolumeArray()));
+      m_boundaries.write(volumeArrayIndex(boundary.alongVolumeArray()));
+    }
+    return it->second;
+  }
+
+  void writeSurfaceArray(BinaryWriteBuffer& buffer,
+                         const Acts::SurfaceArray* surfaceArray) {
+    if (surfaceArray == nullptr) {
+      buffer.write<uint32_t>(Format::noSurfaceArray);
+      return;
+    }
+    const auto axes = surfaceArray->getAxes();
+    const auto& surfaces = surfaceArray->surfaces();
+    if (axes.empty()) {
+      if (surfaces.size() != 1u) {
+        throw std::invalid_argument("Unsupported surface array");
+      }
+      buffer.write<uint32_t>(Format::singleElement);
+      buffer.write(surfaceIndex(*surfaces[0]));
+      return;
+    }
+    const auto bValues = surfaceArray->binningValues();
+    if (axes.size() != 2u or bValues.size() != 2u) {
+      throw std::invalid_argument(
+          "Only two-dimensional surface arrays are supported");
+    }
+
+    // The local coordinates follow the SurfaceArrayCreator, the radius or
+    // the z position is only used for the bin centers
+    Format::SurfaceArrayKind kind = Format::planeArray;
+    if (bValues[0] == Acts::binPhi and bValues[1] == Acts::binZ) {
+      kind = Format::cylinderArray;
+    } else if (bValues[0] == Acts::binR and bValues[1] == Acts::binPhi) {
+      kind = Format::discArray;
+    }
+    double position = 0.;
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      if (surfaceArray->isValidBin(bin)) {
+        // the bin center is only accessible through the non-const array
+        Acts::Vector3D center = surfaceArray->transform() *
+                                const_cast<Acts::SurfaceArray*>(surfaceArray)
+                                    ->getBinCenter(bin);
+        position = kind == Format::cylinderArray
+                       ? Acts::VectorHelpers::perp(center)
+                       : center.z();
+        break;
+      }
+    }
+    buffer.write<uint32_t>(kind);
+    buffer.write(surfaceArray->transform());
+    buffer.write(position);
+    for (size_t i = 0; i < 2u; ++i) {
+      const auto* axis = axes[i];
+      buffer.write<uint32_t>(bValues[i]);
+      buffer.write<uint8_t>(axis->isEquidistant());
+      buffer.write<uint32_t>(static_cast<uint32_t>(axis->getBoundaryType()));
+      buffer.write<uint64_t>(axis->getNBins());
+      buffer.write(axis->getMin());
+      buffer.write(axis->getMax());
+      buffer.write(axis->isVariable() ? axis->getBinEdges()
+                                      : std::vector<double>());
+    }
+
+    // The bin content refers to the surfaces of the array
+    std::unordered_map<const Acts::Surface*, uint32_t> local;
+    std::vector<uint32_t> indices;
+    for (const auto* surface : surfaces) {
+      local.emplace(surface, local.size());
+      indices.push_back(surfaceIndex(*surface));
+    }
+    buffer.write(indices);
+    buffer.write<uint64_t>(surfaceArray->size());
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      std::vector<uint32_t> content;
+      for (const auto* surface : surfaceArray->at(bin)) {
+        content.push_back(local.at(surface));
+      }
+      buffer.write(content);
+    }
+  }
+
+  void writeLayer(BinaryWriteBuffer& buffer, const Acts::Layer& layer) {
+    Format::LayerKind kind = Format::navigationLayer;
+    if (dynamic_cast<const Acts::CylinderLayer*>(&layer) != nullptr) {
+      kind = Format::cylinderLayer;
+    } else if (dynamic_cast<const Acts::DiscLayer*>(&layer) != nullptr) {
+      kind = Format::discLayer;
+    } else if (dynamic_cast<const Acts::PlaneLayer*>(&layer) != nullptr) {
+      kind = Format::planeLayer;
+    } else if (dynamic_cast<const Acts::NavigationLayer*>(&layer) == nullptr) {
+      throw std::invalid_argument("Unsupported layer type");
+    }
+    buffer.write<uint32_t>(kind);
+    buffer.write<uint32_t>(layer.layerType());
+    buffer.write(layer.thickness());
+    const auto& representation = layer.surfaceRepresentation();
+    if (kind == Format::navigationLayer) {
+      buffer.write(surfaceIndex(representation));
+    } else {
+      writeBounds(buffer, representation.bounds());
+      buffer.write(representation.transform(m_gctx));
+      writeMaterial(buffer, representation.surfaceMaterial());
+    }
+    buffer.write(layer.geometryId().value());
+
+    const auto* approach = layer.approachDescriptor();
+    buffer.write<uint8_t>(approach != nullptr);
+    if (approach != nullptr) {
+      std::vector<uint32_t> indices;
+      for (const auto* surface : approach->containedSurfaces()) {
+        indices.push_back(surfaceIndex(*surface));
+      }
+      buffer.write(indices);
+    }
+    writeSurfaceArray(buffer, layer.surfaceArray());
+  }
+
+  void writeVolume(const Acts::TrackingVolume& volume) {
+    auto& buffer = m_volumeRecords;
+    buffer.write(volume.volumeName());
+    buffer.write(volume.transform());
+    writeBounds(buffer, volume.volumeBounds());
+
+    const auto* material = volume.volumeMaterial();
+    if (auto hvm =
+            dynamic_cast<const Acts::HomogeneousVolumeMaterial*>(material)) {
+      buffer.write<uint32_t>(Format::homogeneousVolumeMaterial);
+      const auto parameters =
+          hvm->material(Acts::Vector3D::Zero()).parameters();
+      buffer.write(std::vector<float>(parameters.data(),
+                                      parameters.data() + parameters.size()));
+    } else if (auto pvm =
+                   dynamic_cast<const Acts::ProtoVolumeMaterial*>(material)) {
+      buffer.write<uint32_t>(Format::protoVolumeMaterial);
+      writeBinUtility(buffer, pvm->binUtility());
+    } else {
+      if (material != nullptr) {
+        ACTS_WARNING("Unsupported material of volume '"
+                     << volume.volumeName() << "', it is not written");
+      }
+      buffer.write<uint32_t>(Format::noVolumeMaterial);
+    }
+
+    // The layers are written in the order of the layer array
+    const auto* layers = volume.confinedLayers();
+    buffer.write<uint8_t>(layers != nullptr);
+    if (layers != nullptr) {
+      std::unordered_map<const Acts::Layer*, uint32_t> local;
+      buffer.write<uint64_t>(layers->arrayObjects().size());
+      for (const auto& layer : layers->arrayObjects()) {
+        local.emplace(layer.get(), local.size());
+        writeLayer(buffer, *layer);
+      }
+      writeBinnedArray(buffer, *layers, [&](const Acts::LayerPtr& layer) {
+        return local.at(layer.get());
+      });
+    }
+    buffer.write(volumeArrayIndex(volume.confinedVolumes()));
+
+    std::vector<uint32_t> boundaries;
+    for (const auto& boundary : volume.boundarySurfaces()) {
+      boundaries.push_back(boundaryIndex(*boundary));
+    }
+    buffer.write(boundaries);
+    buffer.write(volume.geometryId().value());
+  }
+
+  const Acts::Logger& m_logger;
+  /// The nominal geometry context
+  Acts::GeometryContext m_gctx;
+
+  std::vector<const Acts::TrackingVolume*> m_volumes;
+  std::unordered_map<const Acts::TrackingVolume*, uint32_t> m_volumeIndices;
+  std::unordered_map<const Acts::DigitizationModule*, uint32_t>
+      m_moduleIndices;
+  std::unordered_map<const Acts::Surface*, uint32_t> m_surfaceIndices;
+  std::unordered_map<const Acts::TrackingVolumeArray*, uint32_t>
+      m_volumeArrayIndices;
+  std::unordered_map<const Acts::BoundarySurface*, uint32_t>
+      m_boundaryIndices;
+  uint32_t m_beamline = Format::s_invalidIndex;
+
+  BinaryWriteBuffer m_modules;
+  BinaryWriteBuffer m_surfaces;
+  BinaryWriteBuffer m_volumeArrays;
+  BinaryWriteBuffer m_volumeRecords;
+  BinaryWriteBuffer m_boundaries;
+};
+
+}  // namespace
+
+ActsExamples::BinaryGeometryWriter::BinaryGeometryWriter(const Config& cfg)
+    : m_cfg(cfg) {
+  // Validate the configuration
+  if (not m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  } else if (m_cfg.name.empty()) {
+    throw std::invalid_argument("Missing service name");
+  } else if (m_cfg.fileName.empty()) {
+    throw std::invalid_argument("Missing file name");
+  }
+}
+
+void ActsExamples::BinaryGeometryWriter::write(
+    const Acts::TrackingGeometry& tGeometry) {
+  GeometryEncoder encoder(tGeometry, logger());
+  auto data = encoder.data();
+
+  Format::Header header{};
+  std::memcpy(header.magic, Format::s_magic, sizeof(Format::s_magic));
+  header.version = Format::s_version;
+  header.byteOrderMark = Format::s_byteOrderMark;
+  header.fileSize = data.size();
+  std::memcpy(data.data(), &header, sizeof(header));
+
+  std::ofstream file(m_cfg.fileName,
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+  if (not file) {
+    throw std::runtime_error("Could not open '" + m_cfg.fileName +
+                             "' for writing");
+  }
+  file.write(data.data(), data.size());
+  if (not file) {
+    throw std::runtime_error("Could not write tracking geometry to '" +
+                             m_cfg.fileName + "'");
+  }
+  ACTS_INFO("Wrote " << encoder.nVolumes() << " volumes and "
+                     << encoder.nSurfaces() << " surfaces to '"
+                     << m_cfg.fileName << "'");
+}
@@ -0,0 +1,216 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMaterialDecorator.hpp"
+
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/Utilities/MappedFile.hpp"
+
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+#include "BinaryMaterialFormat.hpp"
+#include "BinaryMaterialRecord.hpp"
+
+namespace {
+
+namespace Format = ActsExamples::BinaryMaterialFormat;
+
+/// Read an object from possibly unaligned raw bytes
+template <typename T>
+T read(const char* bytes) {
+  T object;
+  std::memcpy(&object, bytes, sizeof(T));
+  return object;
+}
+
+/// Decode the record and optionally tabulate the interaction constants
+std::unique_ptr<Acts::ISurfaceMaterial> decode(const char* record,
+                                               size_t size, bool tabulate) {
+  auto material = Format::decodeSurfaceMaterial(record, size);
+  if (tabulate) {
+    if (auto bsm = dynamic_cast<Acts::BinnedSurfaceMaterial*>(material.get())) {
+      bsm->tabulateInteractionConstants();
+    } else if (auto hsm = dynamic_cast<Acts::HomogeneousSurfaceMaterial*>(
+                   material.get())) {
+      hsm->tabulateInteractionConstants();
+    }
+  }
+  return material;
+}
+
+/// Surface material that is decoded from the mapped file on first access.
+///
+/// Only the split factor is read at construction since it is used by the
+/// non-virtual ISurfaceMaterial::factor.
+class LazySurfaceMaterial final : public Acts::ISurfaceMaterial {
+ public:
+  LazySurfaceMaterial(std::shared_ptr<const char> record, size_t size,
+                      bool tabulate)
+      : Acts::ISurfaceMaterial(
+            read<Format::SurfaceRecord>(record.get()).splitFactor),
+        m_record(std::move(record)),
+        m_size(size),
+        m_tabulate(tabulate) {}
+
+  LazySurfaceMaterial& operator*=(double scale) final {
+    material() *= scale;
+    return *this;
+  }
+
+  const Acts::MaterialSlab& materialSlab(
+      const Acts::Vector2D& lp) const final {
+    return material().materialSlab(lp);
+  }
+
+  const Acts::MaterialSlab& materialSlab(
+      const Acts::Vector3D& gp) const final {
+    return material().materialSlab(gp);
+  }
+
+  const Acts::MaterialSlab& materialSlab(size_t ib0, size_t ib1) const final {
+    return material().materialSlab(ib0, ib1);
+  }
+
+  using Acts::ISurfaceMaterial::materialSlab;
+
+  const Acts::MaterialInteractionConstants* interactionConstants(
+      const Acts::Vector3D& gp) const final {
+    return material().interactionConstants(gp);
+  }
+
+  std::ostream& toStream(std::ostream& sl) const final {
+    return material().toStream(sl);
+  }
+
+  const Acts::ISurfaceMaterial& concreteMaterial() const final {
+    return material();
+  }
+
+  /// The decoded material, which is decoded if necessary
+  Acts::ISurfaceMaterial& material() const {
+    std::call_once(m_decoded, [this]() {
+      m_material = decode(m_record.get(), m_size, m_tabulate);
+      // the mapping is not needed anymore by this surface
+      m_record.reset();
+    });
+    return *m_material;
+  }
+
+ private:
+  mutable std::shared_ptr<const char> m_record;
+  size_t m_size;
+  bool m_tabulate;
+  mutable std::once_flag m_decoded;
+  mutable std::unique_ptr<Acts::ISurfaceMaterial> m_material;
+};
+
+}  // namespace
+
+ActsExamples::BinaryMaterialDecorator::BinaryMaterialDecorator(
+    const Config& cfg)
+    : m_cfg(cfg) {
+  // Validate the configuration
+  if (not m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  } else if (m_cfg.name.empty()) {
+    throw std::invalid_argument("Missing service name");
+  }
+
+  auto file = mapFile(m_cfg.fileName);
+  if (file.size < sizeof(Format::Header)) {
+    throw std::runtime_error("'" + m_cfg.fileName +
+                             "' is not a binary material map");
+  }
+  const auto header = read<Format::Header>(file.data.get());
+  if (std::memcmp(header.magic, Format::s_magic, sizeof(Format::s_magic)) !=
+      0) {
+    throw std::runtime_error("'" + m_cfg.fileName +
+                             "' is not a binary material map");
+  }
+  if (header.version != Format::s_version) {
+    throw std::runtime_error("Unsupported binary material map version " +
+                             std::to_string(header.version) + " in '" +
+                             m_cfg.fileName + "'");
+  }
+  if (header.byteOrderMark != Format::s_byteOrderMark) {
+    throw std::runtime_error("Binary material map '" + m_cfg.fileName +
+                             "' was written with a different byte order");
+  }
+  if ((header.slabSize != Format::s_slabSize) or
+      (header.fileSize != file.size) or
+      (header.indexOffset + header.nEntries * sizeof(Format::IndexEntry) >
+       file.size)) {
+    throw std::runtime_error("Inconsistent or truncated binary material map '" +
+                             m_cfg.fileName + "'");
+  }
+  m_data = std::move(file.data);
+  m_size = file.size;
+  m_nEntries = header.nEntries;
+  m_indexOffset = header.indexOffset;
+  ACTS_DEBUG("Mapped material for " << m_nEntries << " surfaces from '"
+                                    << m_cfg.fileName << "'");
+}
+
+void ActsExamples::BinaryMaterialDecorator::decorate(
+    Acts::Surface& surface) const {
+  // Null out the material for this surface
+  surface.assignSurfaceMaterial(nullptr);
+
+  // Binary search of the surface in the sorted index
+  const uint64_t geoId = surface.geometryId().value();
+  const char* index = m_data.get() + m_indexOffset;
+  size_t first = 0;
+  size_t count = m_nEntries;
+  while (count > 0) {
+    size_t step = count / 2;
+    size_t mid = first + step;
+    if (read<uint64_t>(index + mid * sizeof(Format::IndexEntry)) < geoId) {
+      first = mid + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  if (first == m_nEntries) {
+    return;
+  }
+  const auto entry =
+      read<Format::IndexEntry>(index + first * sizeof(Format::IndexEntry));
+  if (entry.geometryId != geoId) {
+    return;
+  }
+  if (entry.offset + entry.size > m_size or
+      entry.size < sizeof(Format::SurfaceRecord)) {
+    throw std::runtime_error("Invalid index entry for surface " +
+                             std::to_string(geoId) + " in '" +
+                             m_cfg.fileName + "'");
+  }
+
+  if (m_cfg.lazyDecoding) {
+    // aliasing pointer that shares the ownership of the mapping
+    std::shared_ptr<const char> record(m_data, m_data.get() + entry.offset);
+    surface.assignSurfaceMaterial(std::make_shared<LazySurfaceMaterial>(
+        std::move(record), entry.size, m_cfg.tabulateInteractionConstants));
+  } else {
+    std::shared_ptr<const Acts::ISurfaceMaterial> material =
+        decode(m_data.get() + entry.offset, entry.size,
+               m_cfg.tabulateInteractionConstants);
+    surface.assignSurfaceMaterial(std::move(material));
+  }
+}
+
+void ActsExamples::BinaryMaterialDecorator::decorate(
+    Acts::TrackingVolume& volume) const {
+  // The binary format does not contain volume material
+  volume.assignVolumeMaterial(nullptr);
+}
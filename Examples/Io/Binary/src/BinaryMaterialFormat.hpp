@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/Material.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+/// Layout of the binary material map files.
+///
+/// A file consists of
+///
+///   - the file header,
+///   - the index with one entry per surface, sorted by geometry identifier,
+///   - one record per surface, aligned to s_recordAlignment.
+///
+/// A record starts with the surface record header, followed by the material
+/// slabs of all bins in local bin order, i.e. the bin in dimension 0 runs
+/// fastest, and by the bin boundaries of all dimensions with arbitrary
+/// binning. Every material slab is stored as the opaque material parameters
+/// vector followed by the thickness. Records of proto material contain the
+/// binning only.
+///
+/// All numbers are stored in the byte order of the writing machine, which is
+/// identified by the byte order mark.
+namespace ActsExamples {
+namespace BinaryMaterialFormat {
+
+constexpr char s_magic[8] = {'A', 'C', 'T', 'S', 'M', 'A', 'T', '\0'};
+constexpr uint32_t s_version = 1u;
+constexpr uint32_t s_byteOrderMark = 0x01020304u;
+constexpr uint64_t s_recordAlignment = 8u;
+constexpr uint32_t s_slabSize =
+    Acts::Material::ParametersVector::RowsAtCompileTime + 1u;
+
+/// The material types of a surface record.
+enum SurfaceMaterialType : uint32_t {
+  homogeneous = 0u,
+  binned = 1u,
+  proto = 2u
+};
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  /// The number of floats per material slab
+  uint32_t slabSize;
+  uint32_t reserved;
+  uint64_t nEntries;
+  uint64_t indexOffset;
+  uint64_t fileSize;
+};
+
+struct IndexEntry {
+  uint64_t geometryId;
+  /// Offset of the record from the start of the file
+  uint64_t offset;
+  /// Size of the record in bytes
+  uint64_t size;
+};
+
+struct BinningRecord {
+  uint32_t option;
+  uint32_t value;
+  uint32_t type;
+  uint32_t bins;
+  float min;
+  float max;
+  /// The number of stored boundaries, zero for equidistant binning
+  uint32_t nBoundaries;
+  uint32_t reserved;
+};
+
+struct SurfaceRecord {
+  uint32_t type;
+  /// The number of binning dimensions, zero for homogeneous material
+  uint32_t nDims;
+  double splitFactor;
+  BinningRecord binning[2];
+};
+
+static_assert(std::is_trivially_copyable_v<Header> and
+                  std::is_trivially_copyable_v<IndexEntry> and
+                  std::is_trivially_copyable_v<SurfaceRecord>,
+              "Records must be trivially copyable");
+static_assert(sizeof(Header) == 48u and sizeof(IndexEntry) == 24u and
+                  sizeof(BinningRecord) == 32u and
+                  sizeof(SurfaceRecord) == 80u,
+              "Records must not contain padding");
+
+}  // namespace BinaryMaterialFormat
+}  // namespace ActsExamples
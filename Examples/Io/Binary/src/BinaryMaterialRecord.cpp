@@ -0,0 +1,234 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BinaryMaterialRecord.hpp"
+
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include "BinaryMaterialFormat.hpp"
+
+namespace {
+
+namespace Format = ActsExamples::BinaryMaterialFormat;
+
+/// Append the raw bytes of an object to the buffer
+template <typename T>
+void append(std::vector<char>& buffer, const T& object) {
+  const char* bytes = reinterpret_cast<const char*>(&object);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/// Read an object from possibly unaligned raw bytes
+template <typename T>
+T read(const char* bytes) {
+  T object;
+  std::memcpy(&object, bytes, sizeof(T));
+  return object;
+}
+
+void appendSlab(std::vector<char>& buffer, const Acts::MaterialSlab& slab) {
+  std::array<float, Format::s_slabSize> values;
+  const auto parameters = slab.material().parameters();
+  for (unsigned int i = 0; i + 1 < Format::s_slabSize; ++i) {
+    values[i] = parameters[i];
+  }
+  values[Format::s_slabSize - 1] = slab.thickness();
+  append(buffer, values);
+}
+
+Acts::MaterialSlab readSlab(const char* bytes) {
+  const auto values = read<std::array<float, Format::s_slabSize>>(bytes);
+  Acts::Material::ParametersVector parameters;
+  for (unsigned int i = 0; i + 1 < Format::s_slabSize; ++i) {
+    parameters[i] = values[i];
+  }
+  return Acts::MaterialSlab(Acts::Material(parameters),
+                            values[Format::s_slabSize - 1]);
+}
+
+/// Fill the binning of the record header from the bin utility
+void encodeBinning(const Acts::BinUtility& binUtility,
+                   Format::SurfaceRecord& header) {
+  const auto& binningData = binUtility.binningData();
+  if (binningData.size() > 2u) {
+    throw std::invalid_argument(
+        "Surface material must have at most two binning dimensions");
+  }
+  if (not binUtility.transform().isApprox(Acts::Transform3D::Identity())) {
+    throw std::invalid_argument(
+        "Surface material binning with a transform is not supported");
+  }
+  header.nDims = binningData.size();
+  for (size_t i = 0; i < binningData.size(); ++i) {
+    const auto& bData = binningData[i];
+    auto& bRecord = header.binning[i];
+    bRecord.option = bData.option;
+    bRecord.value = bData.binvalue;
+    bRecord.type = bData.type;
+    bRecord.bins = bData.bins();
+    bRecord.min = bData.min;
+    bRecord.max = bData.max;
+    bRecord.nBoundaries =
+        bData.type == Acts::arbitrary ? bData.boundaries().size() : 0u;
+  }
+}
+
+void appendBoundaries(const Acts::BinUtility& binUtility,
+                      std::vector<char>& record) {
+  for (const auto& bData : binUtility.binningData()) {
+    if (bData.type == Acts::arbitrary) {
+      for (float boundary : bData.boundaries()) {
+        append(record, boundary);
+      }
+    }
+  }
+}
+
+/// Rebuild the bin utility from the record header and the boundaries
+Acts::BinUtility decodeBinning(const Format::SurfaceRecord& header,
+                               const char* boundaries) {
+  Acts::BinUtility binUtility;
+  for (uint32_t i = 0; i < header.nDims; ++i) {
+    const auto& bRecord = header.binning[i];
+    auto option = static_cast<Acts::BinningOption>(bRecord.option);
+    auto value = static_cast<Acts::BinningValue>(bRecord.value);
+    if (bRecord.type == Acts::arbitrary) {
+      std::vector<float> bValues(bRecord.nBoundaries);
+      std::memcpy(bValues.data(), boundaries, bValues.size() * sizeof(float));
+      boundaries += bValues.size() * sizeof(float);
+      binUtility += Acts::BinUtility(bValues, option, value);
+    } else {
+      binUtility += Acts::BinUtility(bRecord.bins, bRecord.min, bRecord.max,
+                                     option, value);
+    }
+  }
+  return binUtility;
+}
+
+}  // namespace
+
+bool ActsExamples::BinaryMaterialFormat::encodeSurfaceMaterial(
+    const Acts::ISurfaceMaterial& surfaceMaterial, std::vector<char>& record) {
+  // lazily decoded material is encoded as the material it decodes to
+  const auto& material = surfaceMaterial.concreteMaterial();
+
+  Format::SurfaceRecord header{};
+  // the split factor is only accessible through the pre-update factor
+  header.splitFactor = material.factor(Acts::backward, Acts::preUpdate);
+
+  auto hsm = dynamic_cast<const Acts::HomogeneousSurfaceMaterial*>(&material);
+  if (hsm != nullptr) {
+    header.type = Format::homogeneous;
+    header.nDims = 0u;
+    append(record, header);
+    appendSlab(record, hsm->materialSlab(0, 0));
+    return true;
+  }
+
+  auto psm = dynamic_cast<const Acts::ProtoSurfaceMaterial*>(&material);
+  if (psm != nullptr) {
+    header.type = Format::proto;
+    encodeBinning(psm->binUtility(), header);
+    append(record, header);
+    appendBoundaries(psm->binUtility(), record);
+    return true;
+  }
+
+  auto bsm = dynamic_cast<const Acts::BinnedSurfaceMaterial*>(&material);
+  if (bsm == nullptr) {
+    return false;
+  }
+  if (bsm->binUtility().binningData().empty()) {
+    throw std::invalid_argument(
+        "Binned surface material must have one or two binning dimensions");
+  }
+  header.type = Format::binned;
+  encodeBinning(bsm->binUtility(), header);
+  append(record, header);
+
+  const auto& fullMaterial = bsm->fullMaterial();
+  const size_t bins0 = header.binning[0].bins;
+  const size_t bins1 = header.nDims > 1u ? header.binning[1].bins : 1u;
+  if (fullMaterial.size() != bins1) {
+    throw std::invalid_argument(
+        "Binned surface material does not match its binning");
+  }
+  for (const auto& materialVector : fullMaterial) {
+    if (materialVector.size() != bins0) {
+      throw std::invalid_argument(
+          "Binned surface material does not match its binning");
+    }
+    for (const auto& slab : materialVector) {
+      appendSlab(record, slab);
+    }
+  }
+  appendBoundaries(bsm->binUtility(), record);
+  return true;
+}
+
+std::unique_ptr<Acts::ISurfaceMaterial>
+ActsExamples::BinaryMaterialFormat::decodeSurfaceMaterial(const char* record,
+                                                          size_t size) {
+  constexpr size_t slabBytes = Format::s_slabSize * sizeof(float);
+  if (size < sizeof(Format::SurfaceRecord)) {
+    throw std::runtime_error("Truncated surface material record");
+  }
+  const auto header = read<Format::SurfaceRecord>(record);
+  const char* slabs = record + sizeof(Format::SurfaceRecord);
+
+  if (header.type == Format::homogeneous) {
+    if (size != sizeof(Format::SurfaceRecord) + slabBytes) {
+      throw std::runtime_error("Inconsistent surface material record");
+    }
+    return std::make_unique<Acts::HomogeneousSurfaceMaterial>(
+        readSlab(slabs), header.splitFactor);
+  }
+  if (header.nDims > 2u or
+      (header.type == Format::binned and header.nDims < 1u) or
+      (header.type != Format::binned and header.type != Format::proto)) {
+    throw std::runtime_error("Unknown surface material record");
+  }
+
+  size_t nBoundaries = 0;
+  for (uint32_t i = 0; i < header.nDims; ++i) {
+    nBoundaries += header.binning[i].nBoundaries;
+  }
+  if (header.type == Format::proto) {
+    if (size != sizeof(Format::SurfaceRecord) + nBoundaries * sizeof(float)) {
+      throw std::runtime_error("Inconsistent surface material record");
+    }
+    return std::make_unique<Acts::ProtoSurfaceMaterial>(
+        decodeBinning(header, slabs));
+  }
+
+  const size_t bins0 = header.binning[0].bins;
+  const size_t bins1 = header.nDims > 1u ? header.binning[1].bins : 1u;
+  if (size != sizeof(Format::SurfaceRecord) + bins0 * bins1 * slabBytes +
+                  nBoundaries * sizeof(float)) {
+    throw std::runtime_error("Inconsistent surface material record");
+  }
+
+  Acts::BinUtility binUtility =
+      decodeBinning(header, slabs + bins0 * bins1 * slabBytes);
+  Acts::MaterialSlabMatrix fullMaterial(bins1,
+                                        Acts::MaterialSlabVector(bins0));
+  for (size_t b1 = 0; b1 < bins1; ++b1) {
+    for (size_t b0 = 0; b0 < bins0; ++b0) {
+      fullMaterial[b1][b0] = readSlab(slabs + (b1 * bins0 + b0) * slabBytes);
+    }
+  }
+  return std::make_unique<Acts::BinnedSurfaceMaterial>(
+      binUtility, std::move(fullMaterial), header.splitFactor);
+}
@@ -0,0 +1,37 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/ISurfaceMaterial.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ActsExamples {
+namespace BinaryMaterialFormat {
+
+/// Encode the surface material into a record
+///
+/// @param material The surface material to be encoded
+/// @param record The buffer the record is appended to
+///
+/// @return false for material types that are not supported by the format
+bool encodeSurfaceMaterial(const Acts::ISurfaceMaterial& material,
+                           std::vector<char>& record);
+
+/// Decode the record of a single surface
+///
+/// @param record The start of the record
+/// @param size The size of the record in bytes
+std::unique_ptr<Acts::ISurfaceMaterial> decodeSurfaceMaterial(
+    const char* record, size_t size);
+
+}  // namespace BinaryMaterialFormat
+}  // namespace ActsExamples
@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMaterialWriter.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "BinaryMaterialFormat.hpp"
+#include "BinaryMaterialRecord.hpp"
+
+namespace Format = ActsExamples::BinaryMaterialFormat;
+
+ActsExamples::BinaryMaterialWriter::BinaryMaterialWriter(const Config& cfg)
+    : m_cfg(cfg) {
+  // Validate the configuration
+  if (not m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  } else if (m_cfg.name.empty()) {
+    throw std::invalid_argument("Missing service name");
+  } else if (m_cfg.fileName.empty()) {
+    throw std::invalid_argument("Missing file name");
+  }
+}
+
+void ActsExamples::BinaryMaterialWriter::write(
+    const Acts::DetectorMaterialMaps& detMaterial) {
+  if (not detMaterial.second.empty()) {
+    ACTS_WARNING("Volume material is not supported by the binary format, "
+                 << detMaterial.second.size() << " volume maps are skipped");
+  }
+
+  // The surface material map is ordered by geometry identifier, such that
+  // the index is sorted as required by the decorator
+  std::vector<Format::IndexEntry> index;
+  index.reserve(detMaterial.first.size());
+  std::vector<char> records;
+  std::vector<char> record;
+  for (const auto& [geoId, material] : detMaterial.first) {
+    record.clear();
+    if (material == nullptr or
+        not Format::encodeSurfaceMaterial(*material, record)) {
+      ACTS_WARNING("Unsupported material type for surface "
+                   << geoId << ", it is not written");
+      continue;
+    }
+    // pad the previous records such that this one is aligned
+    records.resize(((records.size() + Format::s_recordAlignment - 1) /
+                    Format::s_recordAlignment) *
+                   Format::s_recordAlignment);
+    index.push_back({geoId.value(), records.size(), record.size()});
+    records.insert(records.end(), record.begin(), record.end());
+  }
+
+  Format::Header header{};
+  std::memcpy(header.magic, Format::s_magic, sizeof(Format::s_magic));
+  header.version = Format::s_version;
+  header.byteOrderMark = Format::s_byteOrderMark;
+  header.slabSize = Format::s_slabSize;
+  header.nEntries = index.size();
+  header.indexOffset = sizeof(Format::Header);
+  const uint64_t recordsOffset =
+      header.indexOffset + index.size() * sizeof(Format::IndexEntry);
+  header.fileSize = recordsOffset + records.size();
+  // the records are written after the index
+  for (auto& entry : index) {
+    entry.offset += recordsOffset;
+  }
+
+  std::ofstream file(m_cfg.fileName,
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+  if (not file) {
+    throw std::runtime_error("Could not open '" + m_cfg.fileName +
+                             "' for writing");
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(index.data()),
+             index.size() * sizeof(Format::IndexEntry));
+  file.write(records.data(), records.size());
+  if (not file) {
+    throw std::runtime_error("Could not write material maps to '" +
+                             m_cfg.fileName + "'");
+  }
+  ACTS_INFO("Wrote material for " << index.size() << " surfaces to '"
+                                  << m_cfg.fileName << "'");
+}
@@ -47,7 +47,7 @@ void ActsExamples::RootMaterialWriter::write(
   auto& surfaceMaps = detMaterial.first;
   for (auto& [key, value] : surfaceMaps) {
     // Get the Surface material
-    const Acts::ISurfaceMaterial* sMaterial = value.get();
+    const Acts::ISurfaceMaterial* sMaterial = &value->concreteMaterial();
 
     // get the geometry ID
     Acts::GeometryID geoID = key;
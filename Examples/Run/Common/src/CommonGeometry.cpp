@@ -8,12 +8,17 @@
 
 #include "ActsExamples/Detector/IBaseDetector.hpp"
 #include "ActsExamples/Geometry/MaterialWiper.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryValidation.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialDecorator.hpp"
 #include "ActsExamples/Io/Root/RootMaterialDecorator.hpp"
 #include <Acts/Material/IMaterialDecorator.hpp>
 #include <Acts/Plugins/Json/JsonGeometryConverter.hpp>
 #include <Acts/Plugins/Json/JsonMaterialDecorator.hpp>
 #include <Acts/Utilities/Logger.hpp>
 
+#include <stdexcept>
 #include <string>
 
 #include <boost/program_options.hpp>
@@ -42,7 +47,7 @@ build(const boost::program_options::variables_map& vm,
   } else if (matType == "file") {
     // Retrieve the filename
     auto fileName = vm["mat-input-file"].template as<std::string>();
-    // json or root based decorator
+    // json, root or binary based decorator
     if (fileName.find(".json") != std::string::npos) {
       // Set up the converter first
       Acts::JsonGeometryConverter::Config jsonGeoConvConfig;
@@ -55,11 +60,66 @@ build(const boost::program_options::variables_map& vm,
       rootMatDecConfig.fileName = fileName;
       matDeco = std::make_shared<const ActsExamples::RootMaterialDecorator>(
           rootMatDecConfig);
+    } else if (fileName.find(".actsmat") != std::string::npos) {
+      // Set up the decorator for the memory-mapped binary format
+      ActsExamples::BinaryMaterialDecorator::Config binMatDecConfig;
+      binMatDecConfig.fileName = fileName;
+      binMatDecConfig.lazyDecoding = vm["mat-input-lazy"].template as<bool>();
+      binMatDecConfig.tabulateInteractionConstants =
+          vm["mat-input-tabulate"].template as<bool>();
+      matDeco = std::make_shared<const ActsExamples::BinaryMaterialDecorator>(
+          binMatDecConfig);
+    }
+  }
+
+  // Restore the closed geometry from the cache without the detector
+  auto cacheInput = vm["geo-cache-input"].template as<std::string>();
+  if (not cacheInput.empty()) {
+    // the cache only holds the nominal geometry, the alignment decorators of
+    // the contextual detectors can not be restored
+    if (vm.count("align-loglevel") != 0u) {
+      throw std::invalid_argument(
+          "The geometry cache can not be used with an aligned detector");
+    }
+    ActsExamples::BinaryGeometryReader::Config geoReaderConfig;
+    geoReaderConfig.fileName = cacheInput;
+    ActsExamples::BinaryGeometryReader geoReader(geoReaderConfig);
+    return {geoReader.read(matDeco.get()), {}};
+  }
+
+  auto geometry = detector.finalize(vm, matDeco);
+
+  // Write the closed geometry into the cache and optionally validate it
+  auto cacheOutput = vm["geo-cache-output"].template as<std::string>();
+  if (not cacheOutput.empty()) {
+    if (not geometry.second.empty()) {
+      throw std::invalid_argument(
+          "The geometry cache can not store the context decorators");
+    }
+    ActsExamples::BinaryGeometryWriter::Config geoWriterConfig;
+    geoWriterConfig.fileName = cacheOutput;
+    ActsExamples::BinaryGeometryWriter geoWriter(geoWriterConfig);
+    geoWriter.write(*geometry.first);
+
+    if (vm["geo-cache-validate"].template as<bool>()) {
+      ActsExamples::BinaryGeometryReader::Config geoReaderConfig;
+      geoReaderConfig.fileName = cacheOutput;
+      // the stored material is already decorated
+      auto restored =
+          ActsExamples::BinaryGeometryReader(geoReaderConfig).read();
+      auto logger = Acts::getDefaultLogger("GeometryCacheValidation",
+                                           Acts::Logging::INFO);
+      if (ActsExamples::compareNavigation(geometry.first, restored, 80, 64,
+                                          Acts::LoggerWrapper{*logger}) !=
+          0u) {
+        throw std::runtime_error("Navigation through the geometry cache '" +
+                                 cacheOutput + "' differs");
+      }
     }
   }
 
   /// Return the geometry and context decorators
-  return detector.finalize(vm, matDeco);
+  return geometry;
 }
 
 }  // namespace Geometry
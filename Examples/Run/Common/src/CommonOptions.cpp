@@ -42,7 +42,10 @@ void ActsExamples::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")(
       "jobs,j", value<int>()->default_value(-1),
-      "Number of parallel jobs, negative for automatic.");
+      "Number of parallel jobs, negative for automatic.")(
+      "prefetch-events", value<size_t>()->default_value(0),
+      "Number of events to read ahead on a separate reader thread, 0 to read "
+      "within the event loop.");
 }
 
 void ActsExamples::Options::addRandomNumbersOptions(
@@ -60,7 +63,18 @@ void ActsExamples::Options::addGeometryOptions(
       "geo-volume-loglevel", value<size_t>()->default_value(3),
       "The output log level for the volume building.")(
       "geo-detector-volume", value<read_strings>()->default_value({{}}),
-      "Sub detectors for the output writing");
+      "Sub detectors for the output writing")(
+      "geo-cache-input", value<std::string>()->default_value(""),
+      "Read the closed tracking geometry from this binary cache file instead "
+      "of building it. The nominal geometry with the identifiers and "
+      "digitization modules of the detector elements is restored, it can not "
+      "be used with aligned detectors.")(
+      "geo-cache-output", value<std::string>()->default_value(""),
+      "Write the closed tracking geometry into this binary cache file. "
+      "Detectors with context decorators can not be cached.")(
+      "geo-cache-validate", value<bool>()->default_value(false),
+      "Read back the written cache and compare its navigation with the "
+      "built tracking geometry.");
 }
 
 void ActsExamples::Options::addMaterialOptions(
@@ -69,7 +83,14 @@ void ActsExamples::Options::addMaterialOptions(
       "mat-input-type", value<std::string>()->default_value("build"),
       "The way material is loaded: 'none', 'build', 'proto', 'file'.")(
       "mat-input-file", value<std::string>()->default_value(""),
-      "Name of the material map input file, supported: '.json' or '.root'.")(
+      "Name of the material map input file, supported: '.json', '.root' or "
+      "'.actsmat'.")(
+      "mat-input-lazy", value<bool>()->default_value(true),
+      "Decode the material of a '.actsmat' input file per surface when it is "
+      "first accessed instead of when the geometry is built.")(
+      "mat-input-tabulate", value<bool>()->default_value(false),
+      "Precompute the ionisation constants of the material of a '.actsmat' "
+      "input file for the energy loss in the propagation.")(
       "mat-output-file", value<std::string>()->default_value(""),
       "Name of the material map output file (without extension).")(
       "mat-output-sensitives", value<bool>()->default_value(true),
@@ -103,6 +124,8 @@ void ActsExamples::Options::addOutputOptions(
       "Switch on to write '.obj' ouput file(s).")(
       "output-json", value<bool>()->default_value(false),
       "Switch on to write '.json' ouput file(s).")(
+      "output-binary", value<bool>()->default_value(false),
+      "Switch on to write binary output file(s).")(
       "output-txt", value<bool>()->default_value(false),
       "Switch on to write '.txt' ouput file(s).");
 }
@@ -121,7 +144,9 @@ void ActsExamples::Options::addInputOptions(
                                            value<bool>()->default_value(false),
                                            "Switch on to read '.obj' file(s).")(
       "input-json", value<bool>()->default_value(false),
-      "Switch on to read '.json' file(s).");
+      "Switch on to read '.json' file(s).")(
+      "input-binary", value<bool>()->default_value(false),
+      "Switch on to read binary input file(s).");
 }
 
 boost::program_options::variables_map ActsExamples::Options::parse(
@@ -179,6 +204,7 @@ ActsExamples::Sequencer::Config ActsExamples::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.prefetchEvents = vm["prefetch-events"].as<size_t>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
@@ -9,6 +9,7 @@
 #include "ActsExamples/Detector/IBaseDetector.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
 #include "ActsExamples/Geometry/CommonGeometry.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialWriter.hpp"
 #include "ActsExamples/Io/Root/RootMaterialTrackReader.hpp"
 #include "ActsExamples/Io/Root/RootMaterialTrackWriter.hpp"
 #include "ActsExamples/Io/Root/RootMaterialWriter.hpp"
@@ -182,6 +183,18 @@ int materialMappingExample(int argc, char* argv[],
         std::make_shared<JsonWriter>(std::move(jmwImpl)));
   }
 
+  if (!materialFileName.empty() and vm["output-binary"].template as<bool>()) {
+    // The writer of the indexed binary material
+    ActsExamples::BinaryMaterialWriter::Config bmwConfig;
+    bmwConfig.fileName = materialFileName + ".actsmat";
+    ActsExamples::BinaryMaterialWriter bmwImpl(bmwConfig);
+    // Fullfill the IMaterialWriter interface
+    using BinaryWriter =
+        ActsExamples::MaterialWriterT<ActsExamples::BinaryMaterialWriter>;
+    mmAlgConfig.materialWriters.push_back(
+        std::make_shared<BinaryWriter>(std::move(bmwImpl)));
+  }
+
   // Create the material mapping
   auto mmAlg = std::make_shared<ActsExamples::MaterialMapping>(mmAlgConfig);
 
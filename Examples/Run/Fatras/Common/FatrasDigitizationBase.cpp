@@ -12,6 +12,7 @@
 #include "ActsExamples/Digitization/DigitizationAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvPlanarClusterWriter.hpp"
 #include "ActsExamples/Io/Root/RootPlanarClusterWriter.hpp"
 #include "ActsExamples/Options/CommonOptions.hpp"
@@ -34,6 +35,7 @@ void ActsExamples::setupDigitization(
       Acts::getDefaultLogger("PlanarModuleStepper", logLevel));
   digi.randomNumbers = randomNumbers;
   digi.trackingGeometry = trackingGeometry;
+  digi.parallelDigitization = vars["fatras-digi-parallel"].as<bool>();
   sequencer.addAlgorithm(
       std::make_shared<ActsExamples::DigitizationAlgorithm>(digi, logLevel));
 
@@ -62,4 +64,16 @@ void ActsExamples::setupDigitization(
     sequencer.addWriter(std::make_shared<ActsExamples::RootPlanarClusterWriter>(
         clusterWriterRoot, logLevel));
   }
+
+  // Write particles, hits and clusters into a single binary event file
+  if (vars["output-binary"].template as<bool>()) {
+    ActsExamples::BinaryEventWriter::Config eventWriterBinary;
+    eventWriterBinary.inputParticles = "particles_initial";
+    eventWriterBinary.inputSimulatedHits = digi.inputSimulatedHits;
+    eventWriterBinary.inputClusters = digi.outputClusters;
+    eventWriterBinary.filePath =
+        ActsExamples::joinPaths(outputDir, "events.actsevt");
+    sequencer.addWriter(std::make_shared<ActsExamples::BinaryEventWriter>(
+        eventWriterBinary, logLevel));
+  }
 }
@@ -0,0 +1,58 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "ActsExamples/Options/CommonOptions.hpp"
+#include "ActsExamples/Plugins/BField/BFieldOptions.hpp"
+#include "ActsExamples/Plugins/BField/BFieldUtils.hpp"
+
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+/// The main executable
+///
+/// Creates an InterpolatedBFieldMap from a txt, csv, or root file and writes
+/// its grid into the binary field map format. The binary map can then be
+/// given to all executables via the `--bf-map` option and is memory mapped
+/// instead of parsed.
+int main(int argc, char* argv[]) {
+  using boost::program_options::value;
+
+  // setup and parse options
+  auto desc = ActsExamples::Options::makeDefaultOptions();
+  ActsExamples::Options::addBFieldOptions(desc);
+  desc.add_options()("bf-file-out",
+                     value<std::string>()->default_value("BField.bfmap"),
+                     "Set this name for the output binary field map file.");
+  auto vm = ActsExamples::Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  auto bFieldVar = ActsExamples::Options::readBField(vm);
+  auto fileOut = vm["bf-file-out"].template as<std::string>();
+
+  return std::visit(
+      [&](auto& bField) -> int {
+        using field_type =
+            typename std::decay_t<decltype(bField)>::element_type;
+        if constexpr (!std::is_same_v<field_type, InterpolatedBFieldMap2D> &&
+                      !std::is_same_v<field_type, InterpolatedBFieldMap3D>) {
+          std::cout << "Bfield map could not be read. Exiting." << std::endl;
+          return EXIT_FAILURE;
+        } else {
+          ActsExamples::BField::binary::writeFieldMap(
+              fileOut, bField->getMapper().getGrid());
+          std::cout << "Wrote binary field map to " << fileOut << std::endl;
+          return EXIT_SUCCESS;
+        }
+      },
+      bFieldVar);
+}
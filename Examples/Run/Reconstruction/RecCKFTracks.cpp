@@ -11,6 +11,7 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/GenericDetector/GenericDetector.hpp"
 #include "ActsExamples/Geometry/CommonGeometry.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
 #include "ActsExamples/Io/Csv/CsvOptionsReader.hpp"
 #include "ActsExamples/Io/Csv/CsvParticleReader.hpp"
 #include "ActsExamples/Io/Csv/CsvPlanarClusterReader.hpp"
@@ -69,21 +70,35 @@ int main(int argc, char* argv[]) {
   // Setup the magnetic field
   auto magneticField = Options::readBField(vm);
 
-  // Read particles (initial states) and clusters from CSV files
-  auto particleReader = Options::readCsvParticleReaderConfig(vm);
-  particleReader.inputStem = "particles_initial";
-  particleReader.outputParticles = "particles_initial";
-  sequencer.addReader(
-      std::make_shared<CsvParticleReader>(particleReader, logLevel));
-  // Read clusters from CSV files
-  auto clusterReaderCfg = Options::readCsvPlanarClusterReaderConfig(vm);
-  clusterReaderCfg.trackingGeometry = trackingGeometry;
-  clusterReaderCfg.outputClusters = "clusters";
-  clusterReaderCfg.outputHitIds = "hit_ids";
-  clusterReaderCfg.outputHitParticlesMap = "hit_particles_map";
-  clusterReaderCfg.outputSimulatedHits = "hits";
-  sequencer.addReader(
-      std::make_shared<CsvPlanarClusterReader>(clusterReaderCfg, logLevel));
+  if (vm["input-binary"].as<bool>()) {
+    // Read particles (initial states) and clusters from the binary event file
+    BinaryEventReader::Config eventReaderCfg;
+    eventReaderCfg.filePath = joinPaths(inputDir, "events.actsevt");
+    eventReaderCfg.trackingGeometry = trackingGeometry;
+    eventReaderCfg.outputParticles = "particles_initial";
+    eventReaderCfg.outputClusters = "clusters";
+    eventReaderCfg.outputHitIds = "hit_ids";
+    eventReaderCfg.outputHitParticlesMap = "hit_particles_map";
+    eventReaderCfg.outputSimulatedHits = "hits";
+    sequencer.addReader(
+        std::make_shared<BinaryEventReader>(eventReaderCfg, logLevel));
+  } else {
+    // Read particles (initial states) and clusters from CSV files
+    auto particleReader = Options::readCsvParticleReaderConfig(vm);
+    particleReader.inputStem = "particles_initial";
+    particleReader.outputParticles = "particles_initial";
+    sequencer.addReader(
+        std::make_shared<CsvParticleReader>(particleReader, logLevel));
+    // Read clusters from CSV files
+    auto clusterReaderCfg = Options::readCsvPlanarClusterReaderConfig(vm);
+    clusterReaderCfg.trackingGeometry = trackingGeometry;
+    clusterReaderCfg.outputClusters = "clusters";
+    clusterReaderCfg.outputHitIds = "hit_ids";
+    clusterReaderCfg.outputHitParticlesMap = "hit_particles_map";
+    clusterReaderCfg.outputSimulatedHits = "hits";
+    sequencer.addReader(
+        std::make_shared<CsvPlanarClusterReader>(clusterReaderCfg, logLevel));
+  }
 
   // Pre-select particles
   // The pre-selection will select truth particles satisfying provided criteria
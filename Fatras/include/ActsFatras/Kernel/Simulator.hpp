@@ -71,11 +71,49 @@ struct ParticleSimulator {
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const Particle &particle) const {
+    return simulateImpl<generator_t, std::vector<Hit>>(
+        geoCtx, magCtx, generator, particle, nullptr, nullptr);
+  }
+
+  /// Simulate a single particle and write its outputs to external buffers.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param particle is the initial particle state
+  /// @param hits is the buffer to which generated hits are appended
+  /// @param generatedParticles is the buffer to which secondaries are appended
+  /// @returns the result of the corresponding Interactor propagator action
+  ///          with empty hit and generated particle containers.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam hits_t is a SequenceContainer for hits
+  ///
+  /// @note Hits that were appended before a propagation failure are kept in
+  ///       the buffer; it is the callers responsibility to remove them.
+  template <typename generator_t, typename hits_t>
+  Acts::Result<SimulationResult> simulate(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &particle, hits_t &hits,
+      std::vector<Particle> &generatedParticles) const {
+    return simulateImpl<generator_t, hits_t>(geoCtx, magCtx, generator,
+                                             particle, &hits,
+                                             &generatedParticles);
+  }
+
+ private:
+  template <typename generator_t, typename hits_t>
+  Acts::Result<SimulationResult> simulateImpl(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &particle, hits_t *hits,
+      std::vector<Particle> *generatedParticles) const {
     assert(localLogger and "Missing local logger");
 
     // propagator-related additional types
-    using Interactor =
-        detail::Interactor<generator_t, physics_list_t, hit_surface_selector_t>;
+    using Interactor = detail::Interactor<generator_t, physics_list_t,
+                                          hit_surface_selector_t, hits_t>;
     using InteractorResult = typename Interactor::result_type;
     using Actions = Acts::ActionList<Interactor>;
     using Abort = Acts::AbortList<typename Interactor::ParticleNotAlive,
@@ -93,6 +131,9 @@ struct ParticleSimulator {
     interactor.physics = physics;
     interactor.selectHitSurface = selectHitSurface;
     interactor.particle = particle;
+    interactor.hits = hits;
+    interactor.hitsBegin = hits ? hits->size() : 0u;
+    interactor.generatedParticles = generatedParticles;
     // use AnyCharge to be able to handle neutral and charged parameters
     Acts::SingleCurvilinearTrackParameters<Acts::AnyCharge> start(
         particle.position4(), particle.unitDirection(), particle.absMomentum(),
@@ -183,9 +224,9 @@ struct Simulator {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) and
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using ParticleSimulatorResult = Acts::Result<SimulationResult>;
-
     std::vector<FailedParticle> failedParticles;
+    // buffer for generated secondaries that is reused for all particles
+    std::vector<Particle> generatedParticles;
 
     for (const Particle &inputParticle : inputParticles) {
       // only consider simulatable particles
@@ -197,48 +238,9 @@ struct Simulator {
           (inputParticle.particleId().subParticle() != 0u)) {
         return detail::SimulatorError::eInvalidInputParticleId;
       }
-
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. to avoid issues, access must always
-      //         occur via indices.
-      auto iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
-
-        // only simulatable particles are pushed to the container.
-        // they must therefore be either charged or neutral.
-        ParticleSimulatorResult result = ParticleSimulatorResult::success({});
-        if (selectCharged(initialParticle)) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
-
-        if (not result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
-
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
-      }
+      simulatePrimary(geoCtx, magCtx, generator, inputParticle,
+                      simulatedParticlesInitial, simulatedParticlesFinal, hits,
+                      generatedParticles, failedParticles);
     }
 
     // the overall function call succeeded, i.e. no fatal errors occured.
@@ -248,6 +250,99 @@ struct Simulator {
     return failedParticles;
   }
 
+  /// Simulate multiple particles concurrently with per-primary random streams.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param makeGenerator creates the random number generator for a primary
+  /// @param executor runs a number of independent tasks, possibly in parallel
+  /// @param inputParticles contains all particles that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param primariesPerTask is the number of primaries simulated per task
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  /// @retval Acts::Result::Success with all particles that failed to simulate
+  ///
+  /// Every selected primary is simulated together with all its secondaries
+  /// using its own generator `makeGenerator(primary)`. Consecutive primaries
+  /// are grouped into tasks that fill task-local output containers and are
+  /// dispatched via `executor(numTasks, task)`, where `task(i)` must be called
+  /// exactly once for every `i < numTasks`. The task outputs are appended in
+  /// input order afterwards. The output is thus independent of the executor
+  /// and identical to calling the serial `simulate` once per primary with the
+  /// same generators.
+  ///
+  /// @tparam generator_factory_t is a callable returning a generator
+  /// @tparam executor_t is a callable to run the tasks
+  /// @tparam input_particles_t is a Container for particles
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_factory_t, typename executor_t,
+            typename input_particles_t, typename output_particles_t,
+            typename hits_t>
+  Acts::Result<std::vector<FailedParticle>> simulateConcurrently(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx,
+      generator_factory_t &&makeGenerator, executor_t &&executor,
+      const input_particles_t &inputParticles,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::size_t primariesPerTask = 16u) const {
+    assert(
+        (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) and
+        "Inconsistent initial sizes of the simulated particle containers");
+    assert((0u < primariesPerTask) and "Tasks must contain primaries");
+
+    // select the primaries upfront to be able to split them into tasks
+    std::vector<const Particle *> primaries;
+    for (const Particle &inputParticle : inputParticles) {
+      if (not selectParticle(inputParticle)) {
+        continue;
+      }
+      if ((inputParticle.particleId().generation() != 0u) or
+          (inputParticle.particleId().subParticle() != 0u)) {
+        return detail::SimulatorError::eInvalidInputParticleId;
+      }
+      primaries.push_back(&inputParticle);
+    }
+
+    // task-local outputs that are merged in order afterwards
+    struct TaskOutput {
+      output_particles_t particlesInitial;
+      output_particles_t particlesFinal;
+      hits_t hits;
+      std::vector<FailedParticle> failedParticles;
+    };
+    const std::size_t numTasks =
+        (primaries.size() + primariesPerTask - 1u) / primariesPerTask;
+    std::vector<TaskOutput> outputs(numTasks);
+
+    executor(numTasks, [&](std::size_t itask) {
+      auto &output = outputs[itask];
+      const auto begin = itask * primariesPerTask;
+      const auto end = std::min(begin + primariesPerTask, primaries.size());
+      std::vector<Particle> generatedParticles;
+      for (auto iprimary = begin; iprimary < end; ++iprimary) {
+        const Particle &primary = *primaries[iprimary];
+        auto generator = makeGenerator(primary);
+        simulatePrimary(geoCtx, magCtx, generator, primary,
+                        output.particlesInitial, output.particlesFinal,
+                        output.hits, generatedParticles,
+                        output.failedParticles);
+      }
+    });
+
+    std::vector<FailedParticle> failedParticles;
+    for (auto &output : outputs) {
+      appendMoved(output.particlesInitial, simulatedParticlesInitial);
+      appendMoved(output.particlesFinal, simulatedParticlesFinal);
+      appendMoved(output.hits, hits);
+      appendMoved(output.failedParticles, failedParticles);
+    }
+    return failedParticles;
+  }
+
  private:
   /// Select if the particle should be simulated at all.
   ///
@@ -262,23 +357,96 @@ struct Simulator {
     return isValidCharged xor isValidNeutral;
   }
 
+  /// Simulate a primary particle and all its secondaries.
+  ///
+  /// Simulated particles and hits are appended to the output containers and
+  /// particles that fail to simulate to the list of failed particles.
+  template <typename generator_t, typename particles_t, typename hits_t>
+  void simulatePrimary(const Acts::GeometryContext &geoCtx,
+                       const Acts::MagneticFieldContext &magCtx,
+                       generator_t &generator, const Particle &inputParticle,
+                       particles_t &simulatedParticlesInitial,
+                       particles_t &simulatedParticlesFinal, hits_t &hits,
+                       std::vector<Particle> &generatedParticles,
+                       std::vector<FailedParticle> &failedParticles) const {
+    using ParticleSimulatorResult = Acts::Result<SimulationResult>;
+
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are added to and failed
+    //         particles might be removed. to avoid issues, access must always
+    //         occur via indices.
+    auto iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
+      const auto &initialParticle = simulatedParticlesInitial[iinitial];
+
+      // only simulatable particles are pushed to the container.
+      // they must therefore be either charged or neutral.
+      // hits are written directly to the output and secondaries to the
+      // reused buffer.
+      const auto hitsBegin = hits.size();
+      generatedParticles.clear();
+      ParticleSimulatorResult result = ParticleSimulatorResult::success({});
+      if (selectCharged(initialParticle)) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  hits, generatedParticles);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  hits, generatedParticles);
+      }
+
+      if (not result.ok()) {
+        // remove particle and its partial hits from the output containers
+        // since it was not simulated.
+        hits.erase(std::next(hits.begin(), hitsBegin), hits.end());
+        simulatedParticlesInitial.erase(
+            std::next(simulatedParticlesInitial.begin(), iinitial));
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        continue;
+      }
+
+      copyOutputs(result.value(), generatedParticles,
+                  simulatedParticlesInitial, simulatedParticlesFinal);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    }
+  }
+
+  /// Move all elements of a container to the end of another one.
+  template <typename container_t>
+  static void appendMoved(container_t &source, container_t &target) {
+    target.insert(target.end(), std::make_move_iterator(source.begin()),
+                  std::make_move_iterator(source.end()));
+  }
+
   /// Copy Interactor results to output containers.
   ///
+  /// Hits are already written to the output container by the Interactor.
+  ///
   /// @tparam particles_t is a SequenceContainer for particles
-  /// @tparam hits_t is a SequenceContainer for hits
-  template <typename particles_t, typename hits_t>
+  template <typename particles_t>
   void copyOutputs(const SimulationResult &result,
-                   particles_t &particlesInitial, particles_t &particlesFinal,
-                   hits_t &hits) const {
+                   const std::vector<Particle> &generatedParticles,
+                   particles_t &particlesInitial,
+                   particles_t &particlesFinal) const {
     // initial particle state was already pushed to the container before
     // store final particle state at the end of the simulation
     particlesFinal.push_back(result.particle);
     // move generated secondaries that should be simulated to the output
     std::copy_if(
-        result.generatedParticles.begin(), result.generatedParticles.end(),
+        generatedParticles.begin(), generatedParticles.end(),
         std::back_inserter(particlesInitial),
         [this](const Particle &particle) { return selectParticle(particle); });
-    std::copy(result.hits.begin(), result.hits.end(), std::back_inserter(hits));
   }
 
   /// Renumber particle ids in the tail of the container.
@@ -15,6 +15,8 @@
 #include "ActsFatras/Kernel/SimulationResult.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <vector>
 
 namespace ActsFatras {
 namespace detail {
@@ -30,8 +32,9 @@ namespace detail {
 /// @tparam generator_t is a random number generator
 /// @tparam physics_list_t is a simulation physics lists
 /// @tparam hit_surface_selector_t is a selector of sensitive hit surfaces
+/// @tparam hits_t is a SequenceContainer for hits in an external buffer
 template <typename generator_t, typename physics_list_t,
-          typename hit_surface_selector_t>
+          typename hit_surface_selector_t, typename hits_t = std::vector<Hit>>
 struct Interactor {
   using result_type = SimulationResult;
 
@@ -55,6 +58,14 @@ struct Interactor {
   hit_surface_selector_t selectHitSurface;
   /// Initial particle state.
   Particle particle;
+  /// Optional external buffer to which hits are appended directly. Hits are
+  /// stored in the result if it is not set.
+  hits_t *hits = nullptr;
+  /// Size of the external hit buffer before the simulation of this particle.
+  std::size_t hitsBegin = 0;
+  /// Optional external buffer to which generated particles are appended
+  /// directly. They are stored in the result if it is not set.
+  std::vector<Particle> *generatedParticles = nullptr;
 
   /// Simulate the interaction with a single surface.
   ///
@@ -118,8 +129,10 @@ struct Interactor {
               normal.norm() / normal.dot(before.unitDirection());
           slab.scaleThickness(cosIncidenceInv);
           // physics list returns if the particle was killed.
-          result.isAlive =
-              not physics(*generator, slab, after, result.generatedParticles);
+          result.isAlive = not physics(
+              *generator, slab, after,
+              generatedParticles ? *generatedParticles
+                                 : result.generatedParticles);
           // add the accumulated material; assumes the full material was passsed
           // event if the particle was killed.
           result.pathInX0 += slab.thicknessInX0();
@@ -140,11 +153,18 @@ struct Interactor {
     // store results of this interaction step, including potential hits
     result.particle = after;
     if (selectHitSurface(surface)) {
-      result.hits.emplace_back(
-          surface.geometryId(), before.particleId(),
-          // the interaction could potentially modify the particle position
-          Hit::Scalar(0.5) * (before.position4() + after.position4()),
-          before.momentum4(), after.momentum4(), result.hits.size());
+      // the interaction could potentially modify the particle position
+      const Hit::Vector4 pos4 =
+          Hit::Scalar(0.5) * (before.position4() + after.position4());
+      if (hits) {
+        hits->emplace_back(surface.geometryId(), before.particleId(), pos4,
+                           before.momentum4(), after.momentum4(),
+                           hits->size() - hitsBegin);
+      } else {
+        result.hits.emplace_back(surface.geometryId(), before.particleId(),
+                                 pos4, before.momentum4(), after.momentum4(),
+                                 result.hits.size());
+      }
     }
 
     // continue the propagation with the modified parameters
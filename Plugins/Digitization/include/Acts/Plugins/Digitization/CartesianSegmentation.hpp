@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,7 @@
 #include "Acts/Utilities/Definitions.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace Acts {
 
@@ -94,6 +95,25 @@ class CartesianSegmentation : public Segmentation {
                                     int readoutDirection = 1,
                                     double lorentzAngle = 0.) const final;
 
+  /// Calculate all steps of a straight track through the module
+  ///
+  /// The entry and exit of the sensitive volume are calculated analytically
+  /// and the cells are then found by walking the cell grid along the track
+  /// projected onto the readout surface, i.e. without intersecting any
+  /// segmentation surfaces. The steps are ordered from the readout towards the
+  /// counter readout side of the module.
+  ///
+  /// @param moduleIntersection is the 2d intersection at the module surface
+  /// @param trackDirection is the track direction at the intersection
+  /// @param halfThickness is the half thickness of the module
+  /// @param readoutDirection is the readout direction
+  /// @param lorentzAngle is the lorentz angle
+  /// @param [out] steps is cleared and filled with the digitization steps
+  void cellSteps(const Vector2D& moduleIntersection,
+                 const Vector3D& trackDirection, double halfThickness,
+                 int readoutDirection, double lorentzAngle,
+                 std::vector<DigitizationStep>& steps) const;
+
   /// return the surface bounds by reference
   /// specialization for Rectangle Bounds
   const PlanarBounds& moduleBounds() const final;
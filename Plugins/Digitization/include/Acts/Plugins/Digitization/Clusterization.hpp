@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2018 CERN for the benefit of the Acts project
+// Copyright (C) 2018-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,8 +23,13 @@ namespace Acts {
 /// cut (excluding cells which fall below threshold) can be applied. The
 /// function is templated on the digitization cell type to allow users to use
 /// their own implementation of Acts::DigitizationCell.
+/// The cells are grouped by connected component labelling on the sorted
+/// global grid indices, the clusters are returned in the order of their
+/// lowest cell index and the cells of each cluster in increasing index order.
+/// All clustered cells are flagged as used in the map, cells which are already
+/// flagged are ignored.
 /// @tparam Cell the digitization cell
-/// @param [in] cellMap map of all cells per cell ID on module
+/// @param [in,out] cellMap map of all cells per cell ID on module
 /// @param [in] nBins0 number of bins in direction 0
 /// @param [in] commonCorner flag indicating if also cells sharing a common
 /// corner should be merged into one cluster
@@ -36,30 +41,24 @@ std::vector<std::vector<cell_t>> createClusters(
     std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
     bool commonCorner = true, double energyCut = 0.);
 
-/// @brief fillCluster
+namespace detail {
+
+/// @brief labelClusters
 /// This function is a helper function internally used by Acts::createClusters.
-/// It does connected component labelling using a hash map in order to find out
-/// which cells are neighbours. This function is called recursively by all
-/// neighbours of the current cell. The function is templated on the
-/// digitization cell type to allow users to use their own implementation
-/// inheriting from Acts::DigitizationCell.
-/// @tparam Cell the digitization cell
-/// @param [in,out] mergedCells the final vector of cells to which cells of one
-/// cluster should be added
-/// @param [in,out] cellMap the hashmap of all present cells + a flag indicating
-/// if they have been added to a cluster already, with the key being the global
-/// grid index
-/// @param [in] index the current global grid index of the cell
-/// @param [in] cellA the current cell
+/// It does a two-pass connected component labelling with a union-find
+/// structure over the sorted global grid indices of the cells. Neighbours are
+/// found by walking the sorted indices, i.e. without any hashing and without
+/// recursion.
+/// @param [in] indices the unique global grid indices in increasing order
 /// @param [in] nBins0 number of bins in direction 0
 /// @param [in] commonCorner flag indicating if also cells sharing a common
 /// corner should be merged into one cluster
-/// @param [in] energyCut possible energy cut to be applied
-template <typename cell_t>
-void fillCluster(std::vector<std::vector<cell_t>>& mergedCells,
-                 std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap,
-                 size_t index, size_t nBins0, bool commonCorner = true,
-                 double energyCut = 0.);
+/// @param [out] labels the cluster label for each entry of the indices
+/// @return the number of clusters
+inline size_t labelClusters(const std::vector<size_t>& indices, size_t nBins0,
+                            bool commonCorner, std::vector<size_t>& labels);
+
+}  // namespace detail
 }  // namespace Acts
 
 #include "Acts/Plugins/Digitization/detail/Clusterization.ipp"
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -63,6 +63,23 @@ class PlanarModuleStepper {
                                           const Vector2D& moduleIntersection,
                                           const Vector3D& trackDirection) const;
 
+  /// Calculate the steps caused by this track - fast simulation interface
+  ///
+  /// Steps through cartesian segmentations are calculated analytically, all
+  /// other segmentations are stepped by intersecting the segmentation
+  /// surfaces.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param dmodule is the digitization module
+  /// @param moduleIntersection is the 2d intersection at the module surface
+  /// @param trackDirection is the track direction at the instersection
+  /// @param [out] steps is cleared and filled with the digitization steps,
+  /// i.e. the container can be reused to avoid allocations
+  void cellSteps(const GeometryContext& gctx, const DigitizationModule& dmodule,
+                 const Vector2D& moduleIntersection,
+                 const Vector3D& trackDirection,
+                 std::vector<DigitizationStep>& steps) const;
+
   /// Set logging instance
   ///
   /// @param logger is the logging instance to be set
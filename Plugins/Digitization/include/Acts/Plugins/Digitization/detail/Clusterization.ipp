@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2018 CERN for the benefit of the Acts project
+// Copyright (C) 2018-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,90 +11,109 @@
 #include <utility>
 #include <vector>
 
+inline size_t Acts::detail::labelClusters(const std::vector<size_t>& indices,
+                                          size_t nBins0, bool commonCorner,
+                                          std::vector<size_t>& labels) {
+  const size_t nCells = indices.size();
+  // union-find forest over the positions in the sorted index list. the root of
+  // each tree is always the position of the cell with the lowest index.
+  std::vector<size_t> parents(nCells);
+  auto find = [&parents](size_t i) {
+    while (parents[i] != i) {
+      // path halving keeps the trees flat without a second pass
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  };
+  auto unite = [&](size_t i, size_t j) {
+    size_t rootI = find(i);
+    size_t rootJ = find(j);
+    if (rootI < rootJ) {
+      parents[rootJ] = rootI;
+    } else if (rootJ < rootI) {
+      parents[rootI] = rootJ;
+    }
+  };
+
+  // first pass: connect each cell to its already visited neighbours, i.e. the
+  // left one in the same row and the ones in the previous row. the lower edge
+  // of the neighbourhood in the previous row never decreases, so a single
+  // cursor finds all of them.
+  size_t previousRow = 0;
+  for (size_t i = 0; i < nCells; ++i) {
+    parents[i] = i;
+    const size_t index = indices[i];
+    const size_t bin0 = index % nBins0;
+    if (0 < bin0 and 0 < i and indices[i - 1] + 1 == index) {
+      unite(i, i - 1);
+    }
+    if (index < nBins0) {
+      continue;
+    }
+    const size_t above = index - nBins0;
+    const size_t lower = (commonCorner and 0 < bin0) ? above - 1 : above;
+    const size_t upper =
+        (commonCorner and bin0 + 1 < nBins0) ? above + 1 : above;
+    while (indices[previousRow] < lower) {
+      ++previousRow;
+    }
+    for (size_t j = previousRow; indices[j] <= upper; ++j) {
+      unite(i, j);
+    }
+  }
+
+  // second pass: number the clusters in the order of their first cell. roots
+  // always precede the other cells of their tree and are labelled first.
+  labels.resize(nCells);
+  size_t nClusters = 0;
+  for (size_t i = 0; i < nCells; ++i) {
+    const size_t root = find(i);
+    labels[i] = (root == i) ? nClusters++ : labels[root];
+  }
+  return nClusters;
+}
+
 template <typename cell_t>
 std::vector<std::vector<cell_t>> Acts::createClusters(
     std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
     bool commonCorner, double energyCut) {
-  // the output
-  std::vector<std::vector<cell_t>> mergedCells;
-  // now go through cells and label
+  // collect the unused cells which pass the energy cut and mark them as used.
+  // all lookups are done on the sorted list, the map is not probed again.
+  std::vector<std::pair<size_t, const cell_t*>> entries;
+  entries.reserve(cellMap.size());
   for (auto& cell : cellMap) {
-    // check if the cell was already used
     if (!(cell.second.second) &&
         (cell.second.first.depositedEnergy() >= energyCut)) {
-      // create new cluster
-      mergedCells.push_back(std::vector<cell_t>());
-      // add current cell to current cluster
-      mergedCells.back().push_back(cell.second.first);
-      // set cell to be used already
       cell.second.second = true;
-      // fill all cells belonging to that cluster
-      fillCluster(mergedCells, cellMap, cell.first, nBins0, commonCorner,
-                  energyCut);
+      entries.emplace_back(cell.first, &cell.second.first);
     }
   }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.first < rhs.first;
+            });
+  std::vector<size_t> indices;
+  indices.reserve(entries.size());
+  for (const auto& entry : entries) {
+    indices.push_back(entry.first);
+  }
+
+  std::vector<size_t> labels;
+  const size_t nClusters =
+      detail::labelClusters(indices, nBins0, commonCorner, labels);
+  // the output
+  std::vector<std::vector<cell_t>> mergedCells(nClusters);
+  std::vector<size_t> clusterSizes(nClusters, 0);
+  for (size_t label : labels) {
+    ++clusterSizes[label];
+  }
+  for (size_t c = 0; c < nClusters; ++c) {
+    mergedCells[c].reserve(clusterSizes[c]);
+  }
+  for (size_t i = 0; i < entries.size(); ++i) {
+    mergedCells[labels[i]].push_back(*entries[i].second);
+  }
   // return the grouped together cells
   return mergedCells;
 }
-
-template <typename cell_t>
-void Acts::fillCluster(
-    std::vector<std::vector<cell_t>>& mergedCells,
-    std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t index,
-    size_t nBins0, bool commonCorner, double energyCut) {
-  // go recursively through all neighbours of this cell, if present
-  // calculate neighbour indices first
-  constexpr int iMin = -1;
-  int jMin = -nBins0;
-  constexpr int iMax = 1;
-  int jMax = nBins0;
-  std::vector<int> neighbourIndices;
-  // the neighbour indices - filled depending on merging case
-  if ((index % nBins0) == 0) {
-    // left edge case
-    if (commonCorner) {
-      neighbourIndices = {jMin, jMin + iMax, iMax, jMax, jMax + iMax};
-    } else {
-      neighbourIndices = {jMin, iMax, jMax};
-    }
-  } else if (((index + 1) % nBins0) == 0) {
-    // right edge case
-    if (commonCorner) {
-      neighbourIndices = {jMin + iMin, jMin, iMin, jMax + iMin, jMax};
-    } else {
-      neighbourIndices = {jMin, iMin, jMax};
-    }
-  } else {
-    if (commonCorner) {
-      neighbourIndices = {jMin + iMin, jMin,        jMin + iMax, iMin,
-                          iMax,        jMax + iMin, jMax,        jMax + iMax};
-    } else {
-      neighbourIndices = {jMin, iMin, iMax, jMax};
-    }
-  }
-  // go through neighbours and recursively call connected component algorithm
-  for (auto& i : neighbourIndices) {
-    // calculate neighbour index of current cell
-    int neighbourIndex = int(index) + i;
-    // check if neighbour is there
-    ///   auto startSearchMap = std::chrono::system_clock::now();
-    auto search = cellMap.find(neighbourIndex);
-    if ((search != cellMap.end())) {
-      // get the corresponding index and call function again
-      auto newIndex = search->first;
-      auto currentCell = search->second.first;
-      // if cell was not already added to cluster & deposited energy is higher
-      // than the energy threshold, add it to the cluster
-      if (!search->second.second &&
-          currentCell.depositedEnergy() >= energyCut) {
-        // add current cell to current cluster
-        mergedCells.back().push_back(currentCell);
-        // set cell to be used already
-        search->second.second = true;
-        // add all neighbours to cluster
-        fillCluster(mergedCells, cellMap, newIndex, nBins0, commonCorner,
-                    energyCut);
-      }  // check if was used already
-    }    // check if neighbour is there
-  }      // go through neighbour indics
-}
\ No newline at end of file
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2018 CERN for the benefit of the Acts project
+// Copyright (C) 2018-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,8 +8,10 @@
 
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace Acts {
 namespace detail {
@@ -44,40 +46,57 @@ struct SpacePointParameters {
   double limitExtended = 0.;
 };
 
+/// @brief Global position of a cluster and its angles as seen from the vertex
+struct ClusterPosition {
+  /// @param [in] pos global position of the cluster
+  /// @param [in] posVertex position of the vertex
+  /// @param [in] idx index of the cluster in its collection
+  ClusterPosition(const Vector3D& pos, const Vector3D& posVertex,
+                  unsigned int idx = 0)
+      : position(pos),
+        phi(VectorHelpers::phi(pos - posVertex)),
+        theta(VectorHelpers::theta(pos - posVertex)),
+        index(idx) {}
+
+  /// Global position of the cluster
+  Vector3D position;
+  /// Azimuthal angle with respect to the vertex
+  double phi;
+  /// Polar angle with respect to the vertex
+  double theta;
+  /// Index of the cluster in its collection
+  unsigned int index;
+};
+
 /// @brief Calculates (Delta theta)^2 + (Delta phi)^2 between two clusters
 ///
-/// @param [in] pos1 position of the first cluster
-/// @param [in] pos2 position the second cluster
+/// @param [in] cluster1 position and angles of the first cluster
+/// @param [in] cluster2 position and angles of the second cluster
 /// @param [in] maxDistance Maximum distance between two clusters
 /// @param [in] maxAngleTheta2 Maximum squared theta angle between two clusters
 /// @param [in] maxAnglePhi2 Maximum squared phi angle between two clusters
 ///
 /// @return The squared sum within configuration parameters, otherwise -1
-double differenceOfClustersChecked(const Vector3D& pos1, const Vector3D& pos2,
-                                   const Vector3D& posVertex,
-                                   const double maxDistance,
-                                   const double maxAngleTheta2,
-                                   const double maxAnglePhi2) {
+inline double differenceOfClustersChecked(const ClusterPosition& cluster1,
+                                          const ClusterPosition& cluster2,
+                                          const double maxDistance,
+                                          const double maxAngleTheta2,
+                                          const double maxAnglePhi2) {
   // Check if measurements are close enough to each other
-  if ((pos1 - pos2).norm() > maxDistance) {
+  if ((cluster1.position - cluster2.position).norm() > maxDistance) {
     return -1.;
   }
 
-  // Calculate the angles of the vectors
-  double phi1, theta1, phi2, theta2;
-  phi1 = VectorHelpers::phi(pos1 - posVertex);
-  theta1 = VectorHelpers::theta(pos1 - posVertex);
-  phi2 = VectorHelpers::phi(pos2 - posVertex);
-  theta2 = VectorHelpers::theta(pos2 - posVertex);
-
   // Calculate the squared difference between the theta angles
-  double diffTheta2 = (theta1 - theta2) * (theta1 - theta2);
+  double diffTheta2 =
+      (cluster1.theta - cluster2.theta) * (cluster1.theta - cluster2.theta);
   if (diffTheta2 > maxAngleTheta2) {
     return -1.;
   }
 
   // Calculate the squared difference between the phi angles
-  double diffPhi2 = (phi1 - phi2) * (phi1 - phi2);
+  double diffPhi2 =
+      (cluster1.phi - cluster2.phi) * (cluster1.phi - cluster2.phi);
   if (diffPhi2 > maxAnglePhi2) {
     return -1.;
   }
@@ -346,29 +365,69 @@ void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::makeClusterPairs(
     return;
   }
 
+  // The limits are passed in the same order as for the unbinned pairing
+  const double maxAngleTheta2 = m_cfg.diffPhi2;
+  const double maxAnglePhi2 = m_cfg.diffTheta2;
+
+  // Calculate the global positions of the back clusters once and sort them in
+  // phi. The accepted phi difference then restricts the candidates of each
+  // front cluster to a contiguous window of the sorted clusters.
+  std::vector<detail::ClusterPosition> positionsBack;
+  positionsBack.reserve(clustersBack.size());
+  for (unsigned int iClustersBack = 0; iClustersBack < clustersBack.size();
+       iClustersBack++) {
+    positionsBack.emplace_back(
+        globalCoords(gctx, *(clustersBack[iClustersBack])), m_cfg.vertex,
+        iClustersBack);
+  }
+  std::sort(positionsBack.begin(), positionsBack.end(),
+            [](const detail::ClusterPosition& lhs,
+               const detail::ClusterPosition& rhs) {
+              return lhs.phi < rhs.phi;
+            });
+
   // Declare helper variables
   double currentDiff;
   double diffMin;
   unsigned int clusterMinDist;
 
-  // Walk through all clusters on both surfaces
+  // Walk through all clusters on the front surface
   for (unsigned int iClustersFront = 0; iClustersFront < clustersFront.size();
        iClustersFront++) {
+    const detail::ClusterPosition front(
+        globalCoords(gctx, *(clustersFront[iClustersFront])), m_cfg.vertex);
+    // The window limits use the same squared difference as the final check,
+    // such that no accepted cluster is missed due to rounding
+    auto outsidePhi = [&](const detail::ClusterPosition& back) {
+      return (front.phi - back.phi) * (front.phi - back.phi) > maxAnglePhi2;
+    };
+    auto first = std::partition_point(
+        positionsBack.begin(), positionsBack.end(),
+        [&](const detail::ClusterPosition& back) {
+          return back.phi < front.phi and outsidePhi(back);
+        });
+
     // Set the closest distance to the maximum of double
     diffMin = std::numeric_limits<double>::max();
     // Set the corresponding index to an element not in the list of clusters
     clusterMinDist = clustersBack.size();
-    for (unsigned int iClustersBack = 0; iClustersBack < clustersBack.size();
-         iClustersBack++) {
+    for (auto back = first; back != positionsBack.end(); ++back) {
+      if (front.phi < back->phi and outsidePhi(*back)) {
+        break;
+      }
       // Calculate the distances between the hits
       currentDiff = detail::differenceOfClustersChecked(
-          globalCoords(gctx, *(clustersFront[iClustersFront])),
-          globalCoords(gctx, *(clustersBack[iClustersBack])), m_cfg.vertex,
-          m_cfg.diffDist, m_cfg.diffPhi2, m_cfg.diffTheta2);
-      // Store the closest clusters (distance and index) calculated so far
-      if (currentDiff < diffMin && currentDiff >= 0.) {
+          front, *back, m_cfg.diffDist, maxAngleTheta2, maxAnglePhi2);
+      if (currentDiff < 0.) {
+        continue;
+      }
+      // Store the closest clusters (distance and index) calculated so far. In
+      // case of equal distances the first cluster of the input is kept.
+      if (currentDiff < diffMin ||
+          (currentDiff == diffMin && clusterMinDist < clustersBack.size() &&
+           back->index < clusterMinDist)) {
         diffMin = currentDiff;
-        clusterMinDist = iClustersBack;
+        clusterMinDist = back->index;
       }
     }
 
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,9 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 Acts::CartesianSegmentation::CartesianSegmentation(
@@ -244,3 +247,169 @@ Acts::DigitizationStep Acts::CartesianSegmentation::digitizationStep(
   return DigitizationStep((endStep - startStep).norm(), driftLength, dCell,
                           startStep, endStep, stepCenterProjected, cellCenter);
 }
+
+void Acts::CartesianSegmentation::cellSteps(
+    const Vector2D& moduleIntersection, const Vector3D& trackDirection,
+    double halfThickness, int readoutDirection, double lorentzAngle,
+    std::vector<DigitizationStep>& steps) const {
+  steps.clear();
+  const double tanLorentz = std::tan(lorentzAngle);
+  const double cosLorentz = std::cos(lorentzAngle);
+  const double halfX = m_activeBounds->boundingBox().halfLengthX();
+  const double halfY = m_activeBounds->boundingBox().halfLengthY();
+  // the x position projected along the drift onto the readout surface
+  auto projectedX = [&](const Vector3D& position) {
+    const double driftInZ = halfThickness - readoutDirection * position.z();
+    return position.x() + readoutDirection * driftInZ * tanLorentz;
+  };
+
+  // (A) --- entry and exit of the sensitive volume
+  // -----------------------------------------------------------
+  // clip the track p(t) = start + t * direction with the module volume, it is
+  // bounded by the readout and counter readout surfaces, the module edges in
+  // y and in x. in x one edge is straight and the other one follows the
+  // lorentz angle, like the boundary surfaces of the full 3D segmentation.
+  const Vector3D start(moduleIntersection.x(), moduleIntersection.y(), 0.);
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  double tMin = -inf;
+  double tMax = inf;
+  auto clip = [&](double value, double slope, double lower, double upper) {
+    if (slope == 0.) {
+      return (lower <= value and value <= upper);
+    }
+    double t0 = (lower - value) / slope;
+    double t1 = (upper - value) / slope;
+    if (t1 < t0) {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    return tMin < tMax;
+  };
+  const double slopeProjectedX =
+      trackDirection.x() - trackDirection.z() * tanLorentz;
+  const bool lowerStraight = (lorentzAngle == 0. or
+                              readoutDirection * lorentzAngle > 0.);
+  const bool upperStraight = (lorentzAngle == 0. or
+                              readoutDirection * lorentzAngle < 0.);
+  bool inside =
+      clip(start.z(), trackDirection.z(), -halfThickness, halfThickness) and
+      clip(start.y(), trackDirection.y(), -halfY, halfY);
+  inside = inside and (lowerStraight ? clip(start.x(), trackDirection.x(),
+                                            -halfX, inf)
+                                     : clip(projectedX(start), slopeProjectedX,
+                                            -halfX, inf));
+  inside = inside and (upperStraight ? clip(start.x(), trackDirection.x(),
+                                            -inf, halfX)
+                                     : clip(projectedX(start), slopeProjectedX,
+                                            -inf, halfX));
+  if (not inside) {
+    return;
+  }
+  Vector3D entry = start + tMin * trackDirection;
+  Vector3D exit = start + tMax * trackDirection;
+  // step from the readout towards the counter readout surface
+  if (readoutDirection * entry.z() < readoutDirection * exit.z()) {
+    std::swap(entry, exit);
+  }
+
+  // (B) --- walk through the cells along the projected track
+  // -----------------------------------------------------------
+  // the projected x and y positions are linear in the path fraction s in
+  // [0,1] between entry and exit, every crossed cell boundary starts a new
+  // step. boundaries that are crossed at the same fraction, i.e. at a cell
+  // corner, only start a single step.
+  const Vector3D delta = exit - entry;
+  const double startX = projectedX(entry);
+  const double deltaX = projectedX(exit) - startX;
+  const double startY = entry.y();
+  const double deltaY = delta.y();
+
+  // the current cell, the direction of the walk and the next boundary.
+  // equidistant boundaries are calculated like the segmentation surfaces.
+  struct Walk {
+    const BinningData* binningData = nullptr;
+    double lower = 0.;
+    double pitch = 0.;
+    size_t nCells = 0;
+    size_t cell = 0;
+    int direction = 0;
+    size_t next = 0;
+    double fractionNext = inf;
+
+    double boundary(size_t index) const {
+      return (binningData->type == equidistant)
+                 ? lower + index * pitch
+                 : double(binningData->boundaries()[index]);
+    }
+    void update(double value, double change) {
+      // only the inner boundaries are crossed within the module
+      fractionNext = (direction != 0 and 0 < next and next < nCells)
+                         ? (boundary(next) - value) / change
+                         : inf;
+    }
+  };
+  auto makeWalk = [&](const BinningData& binningData, double halfLength,
+                      double value, double change) {
+    Walk walk;
+    walk.binningData = &binningData;
+    walk.nCells = binningData.bins();
+    walk.lower = -halfLength;
+    walk.pitch = 2. * halfLength / walk.nCells;
+    // the cell which is entered at s = 0+, i.e. the first boundary in front
+    // of the value is searched by bisection
+    size_t index = 0;
+    size_t end = walk.nCells + 1;
+    while (index < end) {
+      const size_t middle = index + (end - index) / 2;
+      const double boundary = walk.boundary(middle);
+      if (boundary < value or (0. <= change and boundary == value)) {
+        index = middle + 1;
+      } else {
+        end = middle;
+      }
+    }
+    walk.cell = std::min<size_t>(std::max<size_t>(index, 1u), walk.nCells) - 1u;
+    walk.direction = (change < 0.) ? -1 : ((change > 0.) ? 1 : 0);
+    walk.next = (walk.direction < 0) ? walk.cell : walk.cell + 1;
+    walk.update(value, change);
+    return walk;
+  };
+  auto advance = [](Walk& walk, double value, double change) {
+    walk.cell += walk.direction;
+    walk.next += walk.direction;
+    walk.update(value, change);
+  };
+  const auto& binningData = m_binUtility->binningData();
+  Walk walkX = makeWalk(binningData[0], halfX, startX, deltaX);
+  Walk walkY = makeWalk(binningData[1], halfY, startY, deltaY);
+
+  // the number of crossed cells for the average pitch
+  steps.reserve(2 + std::abs(deltaX) / walkX.pitch +
+                std::abs(deltaY) / walkY.pitch);
+  double fraction = 0.;
+  Vector3D stepEntry = entry;
+  while (fraction < 1.) {
+    const double fractionNext =
+        std::min(1., std::min(walkX.fractionNext, walkY.fractionNext));
+    Vector3D stepExit =
+        (fractionNext < 1.) ? Vector3D(entry + fractionNext * delta) : exit;
+    // this follows CartesianSegmentation::digitizationStep
+    Vector3D stepCenter = 0.5 * (stepEntry + stepExit);
+    double driftInZ = halfThickness - readoutDirection * stepCenter.z();
+    Vector2D stepCenterProjected(projectedX(stepCenter), stepCenter.y());
+    DigitizationCell dCell(walkX.cell, walkY.cell);
+    steps.emplace_back((stepExit - stepEntry).norm(), driftInZ / cosLorentz,
+                       dCell, stepEntry, stepExit, stepCenterProjected,
+                       cellPosition(dCell));
+    // move on to the next cell(s)
+    if (walkX.fractionNext <= fractionNext) {
+      advance(walkX, startX, deltaX);
+    }
+    if (walkY.fractionNext <= fractionNext) {
+      advance(walkY, startY, deltaY);
+    }
+    fraction = fractionNext;
+    stepEntry = stepExit;
+  }
+}
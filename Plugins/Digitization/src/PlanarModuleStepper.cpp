@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,7 @@
 
 #include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
 
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
 #include "Acts/Plugins/Digitization/DigitizationModule.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -32,6 +33,7 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
 
   // the track direction
   Vector3D trackDirection((endPoint - startPoint).normalized());
+  double trackLength = (endPoint - startPoint).norm();
 
   // the intersections through the surfaces, start one is the first valid one
   std::vector<Acts::Intersection3D> stepIntersections;
@@ -42,7 +44,9 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
     // try it out by intersecting, but do not force the direction
     auto sIntersection =
         sSurface->intersect(gctx, startPoint, trackDirection, true);
-    if (bool(sIntersection)) {
+    // only intersections between start and end point start a new step
+    if (bool(sIntersection) and sIntersection.intersection.pathLength > 0. and
+        sIntersection.intersection.pathLength < trackLength) {
       // now record
       stepIntersections.push_back(sIntersection.intersection);
       ACTS_VERBOSE("Boundary Surface intersected with = "
@@ -53,7 +57,7 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
   }
   // Last one is also valid - now sort
   stepIntersections.push_back(
-      Intersection3D(endPoint, (startPoint - endPoint).norm(),
+      Intersection3D(endPoint, trackLength,
                      Intersection3D::Status::reachable));
   std::sort(stepIntersections.begin(), stepIntersections.end());
 
@@ -74,6 +78,26 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
 std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
     const GeometryContext& gctx, const Acts::DigitizationModule& dmodule,
     const Vector2D& moduleIntersection, const Vector3D& trackDirection) const {
+  std::vector<Acts::DigitizationStep> steps;
+  cellSteps(gctx, dmodule, moduleIntersection, trackDirection, steps);
+  return steps;
+}
+
+void Acts::PlanarModuleStepper::cellSteps(
+    const GeometryContext& gctx, const Acts::DigitizationModule& dmodule,
+    const Vector2D& moduleIntersection, const Vector3D& trackDirection,
+    std::vector<DigitizationStep>& steps) const {
+  // cartesian segmentations are stepped analytically through the cell grid
+  const auto* cartesian =
+      dynamic_cast<const CartesianSegmentation*>(&dmodule.segmentation());
+  if (cartesian != nullptr) {
+    cartesian->cellSteps(moduleIntersection, trackDirection,
+                         dmodule.halfThickness(), dmodule.readoutDirection(),
+                         dmodule.lorentzAngle(), steps);
+    ACTS_VERBOSE("Analytical stepping through " << steps.size() << " cells");
+    return;
+  }
+  steps.clear();
   // first, intersect the boundary surfaces
   auto boundarySurfaces = dmodule.boundarySurfaces();
   // intersect them - fast exit for cases where
@@ -113,10 +137,10 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
     std::sort(boundaryIntersections.begin(), boundaryIntersections.end());
   }
   // if for some reason the intersection does not work
-  if (boundaryIntersections.empty()) {
-    return std::vector<Acts::DigitizationStep>();
+  if (boundaryIntersections.size() < 2) {
+    return;
   }
   // return
-  return cellSteps(gctx, dmodule, boundaryIntersections[0].position,
-                   boundaryIntersections[1].position);
+  steps = cellSteps(gctx, dmodule, boundaryIntersections[0].position,
+                    boundaryIntersections[1].position);
 }
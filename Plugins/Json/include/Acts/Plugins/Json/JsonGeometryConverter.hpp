@@ -228,7 +228,7 @@ class JsonGeometryConverter {
   /// SurfaceMaterial to Json
   ///
   /// @param the SurfaceMaterial
-  nlohmann::json surfaceMaterialToJson(const ISurfaceMaterial& sMaterial);
+  nlohmann::json surfaceMaterialToJson(const ISurfaceMaterial& surfaceMaterial);
 
   /// VolumeMaterial to Json
   ///
@@ -647,7 +647,8 @@ Acts::JsonGeometryConverter::LayerRep Acts::JsonGeometryConverter::convertToRep(
 }
 
 json Acts::JsonGeometryConverter::surfaceMaterialToJson(
-    const Acts::ISurfaceMaterial& sMaterial) {
+    const Acts::ISurfaceMaterial& surfaceMaterial) {
+  const Acts::ISurfaceMaterial& sMaterial = surfaceMaterial.concreteMaterial();
   json smj;
   // A bin utility needs to be written
   const Acts::BinUtility* bUtility = nullptr;
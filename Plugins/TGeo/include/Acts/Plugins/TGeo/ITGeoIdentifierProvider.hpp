@@ -24,6 +24,9 @@ class ITGeoIdentifierProvider {
  public:
   /// Take a geometry context and a TGeoNode and provide an identifier
   ///
+  /// @note The TGeoLayerBuilder calls this concurrently for different nodes
+  /// if it is configured with a concurrent executor
+  ///
   /// @param gctx is a geometry context object
   /// @param tgnode is a TGeoNode that is translated
   virtual Identifier identify(const GeometryContext& gctx,
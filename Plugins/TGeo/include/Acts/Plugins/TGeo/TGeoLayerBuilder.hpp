@@ -20,6 +20,7 @@
 #include "Acts/Utilities/Units.hpp"
 
 #include <climits>
+#include <functional>
 #include <tuple>
 
 class TGeoMatrix;
@@ -100,6 +101,23 @@ class TGeoLayerBuilder : public ILayerBuilder {
     bool autoSurfaceBinning = false;
     /// The surface binning matcher
     Acts::SurfaceBinningMatcher surfaceBinMatcher;
+    /// Executes independent tasks, i.e. the parsing of the daughter branches
+    /// of the search volume and the conversion of the selected nodes: called
+    /// with the number of tasks and a function to be called once for every
+    /// task index. Runs them sequentially by default.
+    ///
+    /// @note The calls may run concurrently, e.g. in a tbb::parallel_for.
+    /// The caller then has to guarantee that
+    /// - ROOT thread safety is enabled with ROOT::EnableThreadSafety()
+    ///   before the layers are built, as the tasks create ROOT objects;
+    /// - the identifier provider can be called concurrently.
+    /// The builder can not detect either and does not check them.
+    std::function<void(size_t, const std::function<void(size_t)>&)> executor =
+        [](size_t nTasks, const std::function<void(size_t)>& func) {
+          for (size_t i = 0; i < nTasks; ++i) {
+            func(i);
+          }
+        };
   };
 
   /// Constructor
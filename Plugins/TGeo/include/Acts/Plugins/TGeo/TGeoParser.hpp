@@ -12,6 +12,7 @@
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -70,6 +71,18 @@ struct TGeoParser {
     double unit = 1_cm;
     /// Parse restrictions, several can apply
     std::vector<std::pair<BinningValue, ParseRange> > parseRanges = {};
+    /// Executes the parsing of independent branches in selectConcurrently:
+    /// called with the number of branches and a function to be called once
+    /// for every branch index. The calls for different indices are
+    /// independent and may run concurrently, e.g. in a tbb::parallel_for,
+    /// if ROOT thread safety is enabled with ROOT::EnableThreadSafety().
+    /// Runs them sequentially by default.
+    std::function<void(size_t, const std::function<void(size_t)>&)> executor =
+        [](size_t nBranches, const std::function<void(size_t)>& func) {
+          for (size_t i = 0; i < nBranches; ++i) {
+            func(i);
+          }
+        };
   };
 
   /// The parsing module, it takes the top Volume and recursively steps down
@@ -78,6 +91,22 @@ struct TGeoParser {
   /// @param gmatrix The current built-up transform to global at this depth
   static void select(State& state, const Options& options,
                      const TGeoMatrix& gmatrix = TGeoIdentity("ID"));
+
+  /// The parsing module that splits the tree at the daughters of the top
+  /// volume and parses the daughter branches through the options executor
+  ///
+  /// The selected nodes are merged in the order of the daughters, i.e. the
+  /// selection is identical to the one of the sequential parsing. The
+  /// branches are only split if the top volume is on a selected branch,
+  /// otherwise a match in one daughter branch changes the parsing of the
+  /// following ones and the tree is parsed sequentially.
+  ///
+  /// @param state [in,out] The parsing state with the top volume set
+  /// @param options [in] The parsing options as requiremed
+  /// @param gmatrix The built-up transform to global of the top volume
+  static void selectConcurrently(
+      State& state, const Options& options,
+      const TGeoMatrix& gmatrix = TGeoIdentity("ID"));
 };
 
 }  // namespace Acts
\ No newline at end of file
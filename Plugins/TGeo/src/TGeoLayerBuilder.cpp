@@ -168,6 +168,7 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
       tgpOptions.targetNames = layerCfg.sensorNames;
       tgpOptions.parseRanges = layerCfg.parseRanges;
       tgpOptions.unit = m_cfg.unit;
+      tgpOptions.executor = m_cfg.executor;
       TGeoParser::State tgpState;
       tgpState.volume = tVolume;
 
@@ -179,20 +180,26 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
                                  << prange.second.second << "]");
       }
 
-      TGeoParser::select(tgpState, tgpOptions);
+      TGeoParser::selectConcurrently(tgpState, tgpOptions);
 
       ACTS_DEBUG("- number of selsected nodes found : "
                  << tgpState.selectedNodes.size());
 
-      for (auto& snode : tgpState.selectedNodes) {
+      // Convert the selected nodes, the elements keep the selection order
+      const auto& selectedNodes = tgpState.selectedNodes;
+      std::vector<std::shared_ptr<const TGeoDetectorElement>> tgElements(
+          selectedNodes.size());
+      m_cfg.executor(selectedNodes.size(), [&](size_t i) {
+        const auto& snode = selectedNodes[i];
         auto identifier =
             m_cfg.identifierProvider != nullptr
                 ? m_cfg.identifierProvider->identify(gctx, *snode.node)
                 : Identifier();
-
-        auto tgElement = std::make_shared<const Acts::TGeoDetectorElement>(
+        tgElements[i] = std::make_shared<const Acts::TGeoDetectorElement>(
             identifier, *snode.node, *snode.transform, layerCfg.localAxes,
             m_cfg.unit);
+      });
+      for (auto& tgElement : tgElements) {
         m_elementStore.push_back(tgElement);
         layerSurfaces.push_back(tgElement->surface().getSharedPtr());
       }
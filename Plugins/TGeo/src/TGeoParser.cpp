@@ -12,6 +12,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <iostream>
+#include <iterator>
 
 #include "TGeoBBox.h"
 #include "TGeoNode.h"
@@ -22,11 +23,10 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
                               const TGeoMatrix& gmatrix) {
   // Volume is present
   if (state.volume != nullptr) {
-    std::string volumeName = state.volume->GetName();
     // If you are on branch, you stay on branch
-    state.onBranch =
-        state.onBranch or
-        TGeoPrimitivesHelper::match(options.volumeNames, volumeName.c_str());
+    state.onBranch = state.onBranch or
+                     TGeoPrimitivesHelper::match(options.volumeNames,
+                                                 state.volume->GetName());
     // Loop over the daughters and collect them
     auto daugthers = state.volume->GetNodes();
     // Daughter node iteration
@@ -42,7 +42,7 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
   } else if (state.node != nullptr) {
     // The node name for checking
     std::string nodeName = state.node->GetName();
-    std::string nodeVolName = state.node->GetVolume()->GetName();
+    const char* nodeVolName = state.node->GetVolume()->GetName();
     // Get the matrix of the current node for positioning
     const TGeoMatrix* nmatrix = state.node->GetMatrix();
     TGeoHMatrix transform = TGeoCombiTrans(gmatrix) * TGeoCombiTrans(*nmatrix);
@@ -50,7 +50,7 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
     transform.SetName((nodeName + suffix).c_str());
     // Check if you had found the target node
     if (state.onBranch and
-        TGeoPrimitivesHelper::match(options.targetNames, nodeVolName.c_str())) {
+        TGeoPrimitivesHelper::match(options.targetNames, nodeVolName)) {
       // Get the placement and orientation in respect to its mother
       const Double_t* rotation = transform.GetRotationMatrix();
       const Double_t* translation = transform.GetTranslation();
@@ -102,4 +102,47 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
     }
   }
   return;
-}
\ No newline at end of file
+}
+
+void Acts::TGeoParser::selectConcurrently(
+    Acts::TGeoParser::State& state, const Acts::TGeoParser::Options& options,
+    const TGeoMatrix& gmatrix) {
+  if (state.volume == nullptr) {
+    select(state, options, gmatrix);
+    return;
+  }
+  state.onBranch =
+      state.onBranch or
+      TGeoPrimitivesHelper::match(options.volumeNames, state.volume->GetName());
+  // Off branch, a match in one daughter branch puts all following daughters
+  // on branch in the sequential parsing: the branches are not independent
+  if (not state.onBranch) {
+    select(state, options, gmatrix);
+    return;
+  }
+  // Collect the daughter nodes as the independent branches
+  std::vector<TGeoNode*> daughters;
+  TIter iObj(state.volume->GetNodes());
+  while (TObject* obj = iObj()) {
+    TGeoNode* node = dynamic_cast<TGeoNode*>(obj);
+    if (node != nullptr) {
+      daughters.push_back(node);
+    }
+  }
+  state.volume = nullptr;
+  // Every branch is parsed with its own state
+  std::vector<State> branchStates(daughters.size());
+  for (size_t i = 0; i < daughters.size(); ++i) {
+    branchStates[i].node = daughters[i];
+    branchStates[i].onBranch = state.onBranch;
+  }
+  options.executor(daughters.size(), [&](size_t i) {
+    select(branchStates[i], options, gmatrix);
+  });
+  // Merge in the order of the daughters
+  for (auto& branchState : branchStates) {
+    std::move(branchState.selectedNodes.begin(),
+              branchState.selectedNodes.end(),
+              std::back_inserter(state.selectedNodes));
+  }
+}
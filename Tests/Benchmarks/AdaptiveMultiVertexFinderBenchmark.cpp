@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/VertexingDataHelper.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  size_t runs = 20;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+
+  using Propagator =
+      Acts::Propagator<Acts::EigenStepper<Acts::ConstantBField>>;
+  using Linearizer = Acts::HelicalTrackLinearizer<Propagator>;
+  using IPEstimator =
+      Acts::ImpactPointEstimator<Acts::BoundTrackParameters, Propagator>;
+  using Fitter =
+      Acts::AdaptiveMultiVertexFitter<Acts::BoundTrackParameters, Linearizer>;
+  using SeedFinder = Acts::TrackDensityVertexFinder<
+      Fitter, Acts::GaussianTrackDensity<Acts::BoundTrackParameters>>;
+  using Finder = Acts::AdaptiveMultiVertexFinder<Fitter, SeedFinder>;
+
+  Acts::GeometryContext geoContext;
+  Acts::MagneticFieldContext magFieldContext;
+
+  Acts::ConstantBField bField(Acts::Vector3D(0., 0., 2_T));
+  Acts::EigenStepper<Acts::ConstantBField> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  IPEstimator::Config ipEstimatorCfg(bField, propagator);
+  IPEstimator ipEstimator(ipEstimatorCfg);
+
+  std::vector<double> temperatures{8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+  Acts::AnnealingUtility::Config annealingConfig(temperatures);
+  Acts::AnnealingUtility annealingUtility(annealingConfig);
+
+  Fitter::Config fitterCfg(ipEstimator);
+  fitterCfg.annealingTool = annealingUtility;
+  fitterCfg.doSmoothing = true;
+  Fitter fitter(fitterCfg);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  SeedFinder seedFinder;
+  Finder::Config finderConfig(std::move(fitter), seedFinder, ipEstimator,
+                              linearizer);
+  Finder finder(finderConfig);
+
+  // Find the vertices of the mu=20 event used by the unit tests
+  auto csvData = Acts::Test::readTracksAndVertexCSV("AMVF");
+  const auto& tracks = std::get<Acts::Test::TracksData>(csvData);
+  std::vector<const Acts::BoundTrackParameters*> tracksPtr;
+  for (const auto& trk : tracks) {
+    tracksPtr.push_back(&trk);
+  }
+
+  Acts::VertexingOptions<Acts::BoundTrackParameters> vertexingOptions(
+      geoContext, magFieldContext);
+  vertexingOptions.vertexConstraint =
+      std::get<Acts::Test::BeamSpotData>(csvData);
+
+  Finder::State state;
+  auto findResult = finder.find(tracksPtr, vertexingOptions, state);
+  if (not findResult.ok()) {
+    std::cerr << "Vertex finding failed: " << findResult.error().message()
+              << std::endl;
+    return 1;
+  }
+  std::cout << "Finding " << (*findResult).size()
+            << " vertices in an event with " << tracks.size()
+            << " tracks: " << std::flush;
+  std::cout << Acts::Test::microBenchmark(
+                   [&] {
+                     return finder.find(tracksPtr, vertexingOptions, state)
+                         .value();
+                   },
+                   1, runs)
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/VertexingDataHelper.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  size_t runs = 200;
+  double zWindow = 0.5_mm;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    zWindow = std::stod(argv[2]) * 1_mm;
+  }
+
+  using Propagator =
+      Acts::Propagator<Acts::EigenStepper<Acts::ConstantBField>>;
+  using Linearizer = Acts::HelicalTrackLinearizer<Propagator>;
+  using VertexFitter =
+      Acts::FullBilloirVertexFitter<Acts::BoundTrackParameters, Linearizer>;
+
+  Acts::GeometryContext geoContext;
+  Acts::MagneticFieldContext magFieldContext;
+
+  Acts::ConstantBField bField(Acts::Vector3D(0., 0., 2_T));
+  Acts::EigenStepper<Acts::ConstantBField> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  VertexFitter::Config fitterCfg;
+  VertexFitter fitter(fitterCfg);
+
+  // Read the mu=20 event and assign the tracks to the reference vertices
+  auto csvData = Acts::Test::readTracksAndVertexCSV("AMVF");
+  const auto& beamSpot = std::get<Acts::Test::BeamSpotData>(csvData);
+  const auto& vertices = std::get<Acts::Test::VerticesData>(csvData);
+  const auto& tracks = std::get<Acts::Test::TracksData>(csvData);
+
+  std::vector<std::vector<const Acts::BoundTrackParameters*>> trackGroups;
+  size_t nGroupedTracks = 0;
+  for (const auto& vtx : vertices) {
+    std::vector<const Acts::BoundTrackParameters*> group;
+    for (const auto& trk : tracks) {
+      double z = trk.position(geoContext).z();
+      if (std::abs(z - vtx.position.z()) < zWindow) {
+        group.push_back(&trk);
+      }
+    }
+    if (group.size() >= 2) {
+      nGroupedTracks += group.size();
+      trackGroups.push_back(std::move(group));
+    }
+  }
+  std::cout << "Fitting " << trackGroups.size() << " vertices with "
+            << nGroupedTracks << " tracks in total" << std::endl;
+
+  Acts::VertexingOptions<Acts::BoundTrackParameters> vfOptions(
+      geoContext, magFieldContext);
+  Acts::VertexingOptions<Acts::BoundTrackParameters> vfOptionsConstr(
+      geoContext, magFieldContext, beamSpot);
+
+  auto fitEvent = [&](const auto& options, VertexFitter::State* sharedState) {
+    size_t nFitted = 0;
+    for (const auto& group : trackGroups) {
+      if (sharedState != nullptr) {
+        nFitted += fitter.fit(group, linearizer, options, *sharedState).ok();
+      } else {
+        VertexFitter::State state(magFieldContext);
+        nFitted += fitter.fit(group, linearizer, options, state).ok();
+      }
+    }
+    return nFitted;
+  };
+
+  VertexFitter::State sharedState(magFieldContext);
+
+  std::cout << "Benchmarking unconstrained fits with a state per fit: "
+            << std::flush;
+  std::cout << Acts::Test::microBenchmark(
+                   [&] { return fitEvent(vfOptions, nullptr); }, 1, runs)
+            << std::endl;
+
+  std::cout << "Benchmarking unconstrained fits with a shared state: "
+            << std::flush;
+  std::cout << Acts::Test::microBenchmark(
+                   [&] { return fitEvent(vfOptions, &sharedState); }, 1, runs)
+            << std::endl;
+
+  std::cout << "Benchmarking beam spot constrained fits with a shared state: "
+            << std::flush;
+  std::cout << Acts::Test::microBenchmark(
+                   [&] { return fitEvent(vfOptionsConstr, &sharedState); }, 1,
+                   runs)
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// The steps of the surface based stepping, i.e. the track is intersected with
+/// the boundary surfaces of the module and stepped through the segmentation
+/// surfaces between the closest boundary intersections on both sides of the
+/// start position.
+std::vector<DigitizationStep> surfaceCellSteps(
+    const GeometryContext& gctx, const PlanarModuleStepper& stepper,
+    const DigitizationModule& dModule, const Vector2D& position,
+    const Vector3D& direction) {
+  const Vector3D start(position.x(), position.y(), 0.);
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  Intersection3D entry(start, -inf, Intersection3D::Status::missed);
+  Intersection3D exit(start, inf, Intersection3D::Status::missed);
+  for (const auto& bSurface : dModule.boundarySurfaces()) {
+    auto bIntersection = bSurface->intersect(gctx, start, direction, true);
+    if (not bIntersection) {
+      continue;
+    }
+    const auto& intersection = bIntersection.intersection;
+    if (intersection.pathLength < 0. and
+        intersection.pathLength > entry.pathLength) {
+      entry = intersection;
+    } else if (intersection.pathLength > 0. and
+               intersection.pathLength < exit.pathLength) {
+      exit = intersection;
+    }
+  }
+  if (not entry or not exit) {
+    return {};
+  }
+  return stepper.cellSteps(gctx, dModule, entry.position, exit.position);
+}
+
+double totalLength(const std::vector<DigitizationStep>& steps) {
+  double length = 0.;
+  for (const auto& step : steps) {
+    length += step.stepLength;
+  }
+  return length;
+}
+
+/// A module with its segmentation and the incidence of the tracks
+struct Scenario {
+  std::string name;
+  double halfX;
+  double halfY;
+  size_t nBinsX;
+  size_t nBinsY;
+  double halfThickness;
+  double lorentzAngle;
+  double maxTheta;
+};
+
+}  // namespace
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  GeometryContext gctx;
+  std::mt19937 rng(42);
+  PlanarModuleStepper stepper;
+
+  // pixel modules with 50x50um cells at normal and at shallow incidence, i.e.
+  // long clusters along y as in the barrel at large eta, and a strip module
+  // with 80um pitch
+  const std::vector<Scenario> scenarios = {
+      {"Pixel, theta < 0.5", 10_mm, 20_mm, 400, 800, 0.075_mm, 0.1, 0.5},
+      {"Pixel, theta < 1.4", 10_mm, 20_mm, 400, 800, 0.075_mm, 0.1, 1.4},
+      {"Strip, theta < 1.0", 30.72_mm, 25_mm, 768, 1, 0.15_mm, 0.03, 1.0},
+  };
+  constexpr size_t nTracks = 1000;
+
+  for (const auto& scenario : scenarios) {
+    auto bounds = std::make_shared<const RectangleBounds>(scenario.halfX,
+                                                          scenario.halfY);
+    auto segmentation = std::make_shared<const CartesianSegmentation>(
+        bounds, scenario.nBinsX, scenario.nBinsY);
+    const DigitizationModule dModule(segmentation, scenario.halfThickness, 1,
+                                     scenario.lorentzAngle);
+
+    // tracks from within the central plane of the sensitive volume
+    const double guardX =
+        2 * scenario.halfThickness * std::tan(scenario.lorentzAngle);
+    std::uniform_real_distribution<double> xDist(-scenario.halfX + guardX,
+                                                 scenario.halfX - guardX);
+    std::uniform_real_distribution<double> yDist(-scenario.halfY,
+                                                 scenario.halfY);
+    std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+    std::uniform_real_distribution<double> thetaDist(0., scenario.maxTheta);
+    std::vector<std::pair<Vector2D, Vector3D>> tracks;
+    tracks.reserve(nTracks);
+    size_t nSteps = 0;
+    std::vector<DigitizationStep> steps;
+    while (tracks.size() < nTracks) {
+      const double theta = thetaDist(rng);
+      const double phi = phiDist(rng);
+      Vector2D position(xDist(rng), yDist(rng));
+      Vector3D direction(std::sin(theta) * std::cos(phi),
+                         std::sin(theta) * std::sin(phi), std::cos(theta));
+      // both implementations must find the same path through the module
+      auto reference =
+          surfaceCellSteps(gctx, stepper, dModule, position, direction);
+      stepper.cellSteps(gctx, dModule, position, direction, steps);
+      if (std::abs(totalLength(reference) - totalLength(steps)) > 1e-9) {
+        std::cerr << "Inconsistent steps for " << scenario.name << std::endl;
+        return 1;
+      }
+      nSteps += steps.size();
+      tracks.emplace_back(position, direction);
+    }
+    std::cout << scenario.name << " (" << double(nSteps) / nTracks
+              << " steps per track):" << std::endl;
+
+    size_t iTrack = 0;
+    auto surfaceBased = Acts::Test::microBenchmark(
+        [&] {
+          const auto& [position, direction] = tracks[iTrack++ % nTracks];
+          return surfaceCellSteps(gctx, stepper, dModule, position,
+                                  direction);
+        },
+        nTracks, 100);
+    std::cout << "- surface based stepping: " << surfaceBased << std::endl;
+    auto analytical = Acts::Test::microBenchmark(
+        [&] {
+          const auto& [position, direction] = tracks[iTrack++ % nTracks];
+          stepper.cellSteps(gctx, dModule, position, direction, steps);
+          return steps.size();
+        },
+        nTracks, 100);
+    std::cout << "- analytical stepping: " << analytical << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Digitization/Clusterization.hpp"
+#include "Acts/Plugins/Digitization/DigitizationCell.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+using CellMap = std::unordered_map<size_t, std::pair<DigitizationCell, bool>>;
+
+/// The previous hash map based flood fill, kept as the reference.
+void fillClusterRecursive(std::vector<std::vector<DigitizationCell>>& clusters,
+                          CellMap& cellMap, size_t index, size_t nBins0,
+                          bool commonCorner) {
+  const int n0 = nBins0;
+  std::vector<int> neighbours;
+  if ((index % nBins0) == 0) {
+    neighbours = commonCorner ? std::vector<int>{-n0, -n0 + 1, 1, n0, n0 + 1}
+                              : std::vector<int>{-n0, 1, n0};
+  } else if (((index + 1) % nBins0) == 0) {
+    neighbours = commonCorner ? std::vector<int>{-n0 - 1, -n0, -1, n0 - 1, n0}
+                              : std::vector<int>{-n0, -1, n0};
+  } else {
+    neighbours = commonCorner ? std::vector<int>{-n0 - 1, -n0, -n0 + 1, -1, 1,
+                                                 n0 - 1, n0, n0 + 1}
+                              : std::vector<int>{-n0, -1, 1, n0};
+  }
+  for (int offset : neighbours) {
+    auto search = cellMap.find(int(index) + offset);
+    if (search != cellMap.end() and not search->second.second) {
+      clusters.back().push_back(search->second.first);
+      search->second.second = true;
+      fillClusterRecursive(clusters, cellMap, search->first, nBins0,
+                           commonCorner);
+    }
+  }
+}
+
+std::vector<std::vector<DigitizationCell>> createClustersRecursive(
+    CellMap& cellMap, size_t nBins0, bool commonCorner) {
+  std::vector<std::vector<DigitizationCell>> clusters;
+  for (auto& cell : cellMap) {
+    if (not cell.second.second) {
+      clusters.push_back({cell.second.first});
+      cell.second.second = true;
+      fillClusterRecursive(clusters, cellMap, cell.first, nBins0,
+                           commonCorner);
+    }
+  }
+  return clusters;
+}
+
+/// A module readout with the given occupancy. The cells are deposited as
+/// rectangular patches with a random extent in both directions, which mimics
+/// the cluster shapes of inclined tracks.
+struct Scenario {
+  std::string name;
+  size_t nBins0;
+  size_t nBins1;
+  double occupancy;
+  size_t maxSize0;
+  size_t maxSize1;
+};
+
+std::vector<CellMap> generateModules(const Scenario& scenario, size_t nModules,
+                                     std::mt19937& rng) {
+  std::uniform_int_distribution<size_t> bin0(0, scenario.nBins0 - 1);
+  std::uniform_int_distribution<size_t> bin1(0, scenario.nBins1 - 1);
+  std::uniform_int_distribution<size_t> size0(1, scenario.maxSize0);
+  std::uniform_int_distribution<size_t> size1(1, scenario.maxSize1);
+  std::uniform_real_distribution<double> charge(0.1, 1.);
+  const double meanSize =
+      0.25 * (scenario.maxSize0 + 1) * (scenario.maxSize1 + 1);
+  const size_t nPatches = std::max<size_t>(
+      1u, scenario.occupancy * scenario.nBins0 * scenario.nBins1 / meanSize);
+
+  std::vector<CellMap> modules(nModules);
+  for (auto& cells : modules) {
+    for (size_t p = 0; p < nPatches; ++p) {
+      const size_t start0 = bin0(rng);
+      const size_t start1 = bin1(rng);
+      const size_t end0 = std::min(start0 + size0(rng), scenario.nBins0);
+      const size_t end1 = std::min(start1 + size1(rng), scenario.nBins1);
+      for (size_t ch1 = start1; ch1 < end1; ++ch1) {
+        for (size_t ch0 = start0; ch0 < end0; ++ch0) {
+          DigitizationCell cell(ch0, ch1, charge(rng));
+          auto inserted = cells.insert(
+              {ch0 + scenario.nBins0 * ch1, {cell, false}});
+          if (not inserted.second) {
+            inserted.first->second.first.addCell(cell, true);
+          }
+        }
+      }
+    }
+  }
+  return modules;
+}
+
+std::vector<size_t> clusterSizes(
+    const std::vector<std::vector<DigitizationCell>>& clusters) {
+  std::vector<size_t> sizes;
+  for (const auto& cluster : clusters) {
+    sizes.push_back(cluster.size());
+  }
+  std::sort(sizes.begin(), sizes.end());
+  return sizes;
+}
+
+void resetFlags(CellMap& cells) {
+  for (auto& cell : cells) {
+    cell.second.second = false;
+  }
+}
+
+}  // namespace
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  std::mt19937 rng(42);
+
+  // occupancies roughly as expected for the innermost layers at mu=200, a few
+  // per mille for pixels and a few percent for strips. the dense pixel module
+  // corresponds to the core of a high energy jet.
+  const std::vector<Scenario> scenarios = {
+      {"Pixel 0.2%", 400, 800, 0.002, 3, 6},
+      {"Pixel 2% (dense)", 400, 800, 0.02, 3, 6},
+      {"Strip 2%", 1280, 1, 0.02, 4, 1},
+  };
+  constexpr size_t nModules = 64;
+
+  for (const auto& scenario : scenarios) {
+    auto modules = generateModules(scenario, nModules, rng);
+    size_t nCells = 0;
+    for (auto& cells : modules) {
+      nCells += cells.size();
+      for (bool commonCorner : {true, false}) {
+        // both implementations must find the same clusters
+        resetFlags(cells);
+        auto reference =
+            createClustersRecursive(cells, scenario.nBins0, commonCorner);
+        resetFlags(cells);
+        auto clusters =
+            createClusters(cells, scenario.nBins0, commonCorner, 0.);
+        if (clusterSizes(reference) != clusterSizes(clusters)) {
+          std::cerr << "Inconsistent clusters for " << scenario.name
+                    << std::endl;
+          return 1;
+        }
+      }
+    }
+    std::cout << scenario.name << " (" << nCells / nModules
+              << " cells per module):" << std::endl;
+
+    // the flags are reset in each iteration since both implementations mark
+    // the clustered cells as used
+    size_t iModule = 0;
+    auto recursive = Acts::Test::microBenchmark(
+        [&] {
+          auto& cells = modules[iModule++ % nModules];
+          resetFlags(cells);
+          return createClustersRecursive(cells, scenario.nBins0, true);
+        },
+        nModules, 200);
+    std::cout << "- recursive flood fill: " << recursive << std::endl;
+    auto unionFind = Acts::Test::microBenchmark(
+        [&] {
+          auto& cells = modules[iModule++ % nModules];
+          resetFlags(cells);
+          return createClusters(cells, scenario.nBins0, true, 0.);
+        },
+        nModules, 200);
+    std::cout << "- union-find: " << unionFind << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/DoubleHitSpacePointBuilder.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using Acts::Test::DetectorElementStub;
+
+namespace {
+
+using ClusterPairs = std::vector<
+    std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>;
+
+/// A strip module with the given stereo angle, at the given radius on the x
+/// axis with the strips along the z axis.
+Transform3D stripModuleTransform(double radius, double stereo) {
+  RotationMatrix3D rotation;
+  rotation.col(0) = Vector3D(0., std::cos(stereo), std::sin(stereo));
+  rotation.col(1) = Vector3D(0., -std::sin(stereo), std::cos(stereo));
+  rotation.col(2) = Vector3D(1., 0., 0.);
+  Transform3D transform(rotation);
+  transform.translation() = Vector3D(radius, 0., 0.);
+  return transform;
+}
+
+}  // namespace
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  GeometryContext gctx;
+  std::mt19937 rng(42);
+
+  // a strip module pair with 80um pitch, 5cm long strips and 40mrad stereo
+  // angle at a radius of 30cm, similar to the innermost strip layers
+  constexpr size_t nStrips = 768;
+  constexpr double pitch = 80_um;
+  constexpr double halfX = 0.5 * nStrips * pitch;
+  constexpr double halfY = 25_mm;
+  constexpr double radiusFront = 300_mm;
+  constexpr double radiusBack = 302_mm;
+  auto bounds = std::make_shared<const RectangleBounds>(halfX, halfY);
+  auto segmentation =
+      std::make_shared<const CartesianSegmentation>(bounds, nStrips);
+  const DigitizationModule digitizationModule(segmentation, 0.15_mm, 1, 0.);
+  DetectorElementStub elementFront(stripModuleTransform(radiusFront, 20e-3));
+  DetectorElementStub elementBack(stripModuleTransform(radiusBack, -20e-3));
+  auto surfaceFront = Surface::makeShared<PlaneSurface>(bounds, elementFront);
+  auto surfaceBack = Surface::makeShared<PlaneSurface>(bounds, elementBack);
+
+  DoubleHitSpacePointConfig cfg;
+  cfg.diffTheta2 = 1e-4;
+  cfg.diffPhi2 = 1e-4;
+  SpacePointBuilder<SpacePoint<PlanarModuleCluster>> builder(cfg);
+
+  // creates a strip cluster centered on the strip that contains the position
+  auto makeCluster = [&](const std::shared_ptr<const Surface>& surface,
+                         double x) {
+    size_t strip = std::min<size_t>((x + halfX) / pitch, nStrips - 1);
+    ActsSymMatrixD<3> cov = ActsSymMatrixD<3>::Zero();
+    return PlanarModuleCluster(surface, {}, cov,
+                               -halfX + (strip + 0.5) * pitch, 0., 0.,
+                               {DigitizationCell(strip, 0, 1.)},
+                               &digitizationModule);
+  };
+
+  // cluster multiplicities per module from the expected occupancy at mu=200
+  // up to the core of dense jets
+  for (size_t nTracks : {10u, 50u, 200u, 800u}) {
+    std::uniform_real_distribution<double> xDist(-0.95 * halfX, 0.95 * halfX);
+    std::uniform_real_distribution<double> yDist(-0.95 * halfY, 0.95 * halfY);
+    std::vector<PlanarModuleCluster> front, back;
+    front.reserve(nTracks);
+    back.reserve(nTracks);
+    // straight tracks from the origin through both modules
+    while (front.size() < nTracks) {
+      Vector3D globalFront = surfaceFront->localToGlobal(
+          gctx, Vector2D(xDist(rng), yDist(rng)), Vector3D(1., 0., 0.));
+      Vector3D globalBack = globalFront * radiusBack / globalFront.x();
+      auto localBack =
+          surfaceBack->globalToLocal(gctx, globalBack, Vector3D(1., 0., 0.));
+      auto localFront =
+          surfaceFront->globalToLocal(gctx, globalFront, Vector3D(1., 0., 0.));
+      if (not localBack.ok() or not localFront.ok() or
+          std::abs(localBack.value().x()) > halfX or
+          std::abs(localBack.value().y()) > halfY) {
+        continue;
+      }
+      front.push_back(makeCluster(surfaceFront, localFront.value().x()));
+      back.push_back(makeCluster(surfaceBack, localBack.value().x()));
+    }
+    std::vector<const PlanarModuleCluster*> clustersFront, clustersBack;
+    for (size_t i = 0; i < nTracks; ++i) {
+      clustersFront.push_back(&front[i]);
+      clustersBack.push_back(&back[i]);
+    }
+    std::shuffle(clustersBack.begin(), clustersBack.end(), rng);
+
+    ClusterPairs clusterPairs;
+    builder.makeClusterPairs(gctx, clustersFront, clustersBack, clusterPairs);
+    std::vector<SpacePoint<PlanarModuleCluster>> spacePoints;
+    builder.calculateSpacePoints(gctx, clusterPairs, spacePoints);
+
+    std::cout << nTracks << " clusters per module, " << spacePoints.size()
+              << " space points:" << std::endl;
+    const size_t nRuns = std::max<size_t>(20u, 20000u / nTracks);
+    auto binnedResult = Acts::Test::microBenchmark(
+        [&] {
+          ClusterPairs pairs;
+          builder.makeClusterPairs(gctx, clustersFront, clustersBack, pairs);
+          return pairs;
+        },
+        1, nRuns);
+    std::cout << "- cluster pairing: " << binnedResult << std::endl;
+    auto spacePointResult = Acts::Test::microBenchmark(
+        [&] {
+          std::vector<SpacePoint<PlanarModuleCluster>> points;
+          builder.calculateSpacePoints(gctx, clusterPairs, points);
+          return points;
+        },
+        1, nRuns);
+    std::cout << "- space point calculation: " << spacePointResult
+              << std::endl;
+  }
+
+  return 0;
+}
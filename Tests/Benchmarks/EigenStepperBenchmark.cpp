@@ -10,9 +10,13 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Units.hpp"
 
@@ -31,6 +35,7 @@ int main(int argc, char* argv[]) {
   double maxPathInM = 1;
   unsigned int lvl = Acts::Logging::INFO;
   bool withCov = true;
+  bool withMaterial = false;
 
   // Create a test context
   GeometryContext tgContext = GeometryContext();
@@ -46,6 +51,7 @@ int main(int argc, char* argv[]) {
       ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
       ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
       ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("material",po::value<bool>(&withMaterial)->default_value(false),"propagation through the material of a cylindrical detector")
       ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
     // clang-format on
     po::variables_map vm;
@@ -71,15 +77,24 @@ int main(int argc, char* argv[]) {
   using BField_type = ConstantBField;
   using Stepper_type = EigenStepper<BField_type>;
   using Propagator_type = Propagator<Stepper_type>;
+  using MaterialPropagator_type = Propagator<Stepper_type, Navigator>;
   using Covariance = BoundSymMatrix;
 
   BField_type bField(0, 0, BzInT * UnitConstants::T);
-  Stepper_type atlas_stepper(std::move(bField));
+  Stepper_type atlas_stepper(bField);
   Propagator_type propagator(std::move(atlas_stepper));
 
   PropagatorOptions<> options(tgContext, mfContext, getDummyLogger());
   options.pathLimit = maxPathInM * UnitConstants::m;
 
+  // the cylindrical detector has material on all its sensitive modules
+  Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  MaterialPropagator_type materialPropagator{Stepper_type(bField),
+                                             Navigator(cGeometry())};
+  PropagatorOptions<ActionList<MaterialInteractor>> materialOptions(
+      tgContext, mfContext, getDummyLogger());
+  materialOptions.pathLimit = maxPathInM * UnitConstants::m;
+
   Vector4D pos4(0, 0, 0, 0);
   Vector3D dir(1, 0, 0);
   Covariance cov;
@@ -100,19 +115,24 @@ int main(int argc, char* argv[]) {
 
   double totalPathLength = 0;
   size_t num_iters = 0;
-  const auto propagation_bench_result = Acts::Test::microBenchmark(
-      [&] {
-        auto r = propagator.propagate(pars, options).value();
-        if (totalPathLength == 0.) {
-          ACTS_DEBUG("reached position "
-                     << r.endParameters->position(tgContext).transpose()
-                     << " in " << r.steps << " steps");
-        }
-        totalPathLength += r.pathLength;
-        ++num_iters;
-        return r;
-      },
-      1, toys);
+  auto propagate = [&](const auto& prop, const auto& opts) {
+    return Acts::Test::microBenchmark(
+        [&] {
+          auto r = prop.propagate(pars, opts).value();
+          if (totalPathLength == 0.) {
+            ACTS_DEBUG("reached position "
+                       << r.endParameters->position(tgContext).transpose()
+                       << " in " << r.steps << " steps");
+          }
+          totalPathLength += r.pathLength;
+          ++num_iters;
+          return r;
+        },
+        1, toys);
+  };
+  const auto propagation_bench_result =
+      withMaterial ? propagate(materialPropagator, materialOptions)
+                   : propagate(propagator, options);
 
   ACTS_INFO("Execution stats: " << propagation_bench_result);
   ACTS_INFO("average path length = " << totalPathLength / num_iters / 1_mm
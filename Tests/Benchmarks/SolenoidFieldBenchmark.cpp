@@ -14,8 +14,11 @@
 
 #include <chrono>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -92,4 +95,30 @@ int main(int argc, char* argv[]) {
   const auto map_rand_result = Acts::Test::microBenchmark(
       [&] { return bFieldMap.getField(genPos()); }, iters_map);
   std::cout << map_rand_result << std::endl;
+
+  // - The third benchmark repeats the random lookup on a grid that views
+  //   external values, as done for memory mapped field maps. It should not
+  //   differ from the second one.
+  const auto mapperCopy = bFieldMap.getMapper();
+  const auto& grid = mapperCopy.getGrid();
+  auto store = std::make_shared<std::vector<Acts::Vector2D>>();
+  store->reserve(grid.size());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    store->push_back(grid.at(bin));
+  }
+  const auto gridAxes = grid.axes();
+  auto makeAxis = [](const Acts::IAxis* axis) {
+    return Acts::detail::EquidistantAxis(axis->getMin(), axis->getMax(),
+                                         axis->getNBins());
+  };
+  std::decay_t<decltype(grid)> gridView(
+      std::make_tuple(makeAxis(gridAxes[0]), makeAxis(gridAxes[1])),
+      std::shared_ptr<const Acts::Vector2D>(store, store->data()));
+  BField_t bFieldMapView(BField_t::Config(Acts::fieldMapperRZ(gridView)));
+
+  std::cout << "Benchmarking random interpolated field lookup on a grid view: "
+            << std::flush;
+  const auto map_view_result = Acts::Test::microBenchmark(
+      [&] { return bFieldMapView.getField(genPos()); }, iters_map);
+  std::cout << map_view_result << std::endl;
 }
@@ -18,7 +18,9 @@
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceBatch.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 #include <cmath>
@@ -38,6 +40,7 @@ const bool testPlane = true;
 const bool testDisc = true;
 const bool testCylinder = true;
 const bool testStraw = true;
+const bool testBatch = true;
 
 // Create a test context
 GeometryContext tgContext = GeometryContext();
@@ -68,6 +71,32 @@ Vector3D origin(0., 0., 0.);
 // The origin for straw/line attempts
 Vector3D originStraw(0.3_m, -0.2_m, 11_m);
 
+// Define a barrel-like batch of plane surfaces, plus some discs and cylinders
+std::vector<std::shared_ptr<const Surface>> batchSurfaces = [] {
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  auto mb = std::make_shared<RectangleBounds>(8_cm, 32_cm);
+  for (unsigned int iz = 0; iz < 8; ++iz) {
+    for (unsigned int iphi = 0; iphi < 16; ++iphi) {
+      double phi = iphi * 2 * M_PI / 16;
+      Vector3D mc(0.3_m * std::cos(phi), 0.3_m * std::sin(phi),
+                  (iz - 3.5) * 0.6_m);
+      Transform3D mt = Transform3D::Identity() * Translation3D(mc) *
+                       AngleAxis3D(phi, Vector3D::UnitZ()) *
+                       AngleAxis3D(0.5 * M_PI, Vector3D::UnitY());
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(mt, mb));
+    }
+  }
+  for (unsigned int id = 0; id < 8; ++id) {
+    Transform3D dt(Translation3D(0., 0., (id + 3) * 0.5_m));
+    surfaces.push_back(Surface::makeShared<DiscSurface>(dt, 0.1_m, 1_m));
+  }
+  for (unsigned int ic = 0; ic < 8; ++ic) {
+    surfaces.push_back(Surface::makeShared<CylinderSurface>(
+        Transform3D::Identity(), (ic + 1) * 0.1_m, 3_m));
+  }
+  return surfaces;
+}();
+
 template <typename surface_t>
 MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
                                       double theta) {
@@ -86,6 +115,34 @@ MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
       nrepts);
 }
 
+MicroBenchmarkResult batchIntersectionTest(bool batched, double phi,
+                                           double theta) {
+  Vector3D direction(std::cos(phi) * std::sin(theta),
+                     std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  auto surfaces = unpack_shared_vector(batchSurfaces);
+  if (batched) {
+    SurfaceBatch batch(tgContext, surfaces);
+    std::vector<SurfaceIntersection> intersections;
+    return Acts::Test::microBenchmark(
+        [&] {
+          batch.intersect(origin, direction, boundaryCheck, intersections);
+          return intersections.size();
+        },
+        nrepts);
+  }
+  std::vector<SurfaceIntersection> intersections(surfaces.size());
+  return Acts::Test::microBenchmark(
+      [&] {
+        for (size_t is = 0; is < surfaces.size(); ++is) {
+          intersections[is] = surfaces[is]->intersect(
+              tgContext, origin, direction, boundaryCheck);
+        }
+        return intersections.size();
+      },
+      nrepts);
+}
+
 BOOST_DATA_TEST_CASE(
     benchmark_surface_intersections,
     bdata::random(
@@ -120,6 +177,14 @@ BOOST_DATA_TEST_CASE(
               << intersectionTest<StrawSurface>(*aStraw, phi, theta + M_PI)
               << std::endl;
   }
+  if (testBatch) {
+    std::cout << "- Batch of " << batchSurfaces.size()
+              << " (virtual): " << batchIntersectionTest(false, phi, theta)
+              << std::endl;
+    std::cout << "- Batch of " << batchSurfaces.size()
+              << " (batched): " << batchIntersectionTest(true, phi, theta)
+              << std::endl;
+  }
 }
 
 }  // namespace Test
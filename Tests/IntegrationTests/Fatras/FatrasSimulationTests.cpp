@@ -239,3 +239,94 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
     BOOST_CHECK(containsParticleId(simulatedFinal, hit));
   }
 }
+
+BOOST_AUTO_TEST_CASE(FatrasSimulationConcurrently) {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  Acts::Logging::Level logLevel = Acts::Logging::Level::INFO;
+
+  // construct the example detector, propagators, and simulator
+  Acts::Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
+  auto trackingGeometry = geoBuilder();
+  Navigator navigator(trackingGeometry);
+  ChargedStepper chargedStepper(Acts::ConstantBField(0, 0, 1_T));
+  ChargedPropagator chargedPropagator(std::move(chargedStepper), navigator);
+  NeutralPropagator neutralPropagator(NeutralStepper(), navigator);
+  ChargedSimulator simulatorCharged(std::move(chargedPropagator), logLevel);
+  NeutralSimulator simulatorNeutral(std::move(neutralPropagator), logLevel);
+  Simulator simulator(std::move(simulatorCharged), std::move(simulatorNeutral));
+
+  // create input particles with secondaries from the split energy loss
+  std::vector<ActsFatras::Particle> input;
+  const std::vector<Acts::PdgParticle> pdgs = {
+      Acts::PdgParticle::eElectron, Acts::PdgParticle::eMuon,
+      Acts::PdgParticle::ePionPlus, Acts::PdgParticle::ePionZero};
+  for (unsigned int i = 1; i <= 25; ++i) {
+    const auto pid = ActsFatras::Barcode().setVertexPrimary(1).setParticle(i);
+    const double phi = -M_PI + 0.25 * i;
+    const double eta = -2.0 + 0.16 * i;
+    const auto dir = Acts::makeDirectionUnitFromPhiEta(phi, eta);
+    input.push_back(ActsFatras::Particle(pid, pdgs[i % pdgs.size()])
+                        .setDirection(dir)
+                        .setAbsMomentum((i % 2 == 0) ? 1_GeV : 12_GeV));
+  }
+  // every primary uses its own generator derived from its particle id
+  auto makeGenerator = [](const ActsFatras::Particle& particle) {
+    return Generator(particle.particleId().value());
+  };
+
+  // reference: serial simulation, one primary at a time
+  std::vector<ActsFatras::Particle> serialInitial;
+  std::vector<ActsFatras::Particle> serialFinal;
+  std::vector<ActsFatras::Hit> serialHits;
+  for (const auto& particle : input) {
+    auto generator = makeGenerator(particle);
+    std::vector<ActsFatras::Particle> primary = {particle};
+    auto result = simulator.simulate(geoCtx, magCtx, generator, primary,
+                                     serialInitial, serialFinal, serialHits);
+    BOOST_CHECK(result.ok());
+  }
+  BOOST_CHECK_LT(input.size(), serialInitial.size());
+  BOOST_CHECK_LT(0u, serialHits.size());
+
+  // simulate the last chunk of primaries first; the output must still follow
+  // the input order and every primary must keep its own random stream
+  std::size_t numExecuted = 0;
+  auto reverseExecutor = [&](std::size_t numTasks, const auto& task) {
+    for (std::size_t i = numTasks; 0 < i; --i) {
+      task(i - 1);
+      ++numExecuted;
+    }
+  };
+  std::vector<ActsFatras::Particle> concurrentInitial;
+  std::vector<ActsFatras::Particle> concurrentFinal;
+  std::vector<ActsFatras::Hit> concurrentHits;
+  auto result = simulator.simulateConcurrently(
+      geoCtx, magCtx, makeGenerator, reverseExecutor, input, concurrentInitial,
+      concurrentFinal, concurrentHits, 4u);
+  BOOST_CHECK(result.ok());
+  BOOST_CHECK_EQUAL(numExecuted, 7u);
+
+  // identical output in identical order
+  BOOST_CHECK_EQUAL(concurrentInitial.size(), serialInitial.size());
+  BOOST_CHECK_EQUAL(concurrentFinal.size(), serialFinal.size());
+  BOOST_CHECK_EQUAL(concurrentHits.size(), serialHits.size());
+  for (std::size_t i = 0; i < concurrentInitial.size(); ++i) {
+    BOOST_CHECK_EQUAL(concurrentInitial[i].particleId(),
+                      serialInitial[i].particleId());
+    BOOST_CHECK_EQUAL(concurrentFinal[i].particleId(),
+                      serialFinal[i].particleId());
+    BOOST_CHECK_EQUAL(concurrentFinal[i].position4(),
+                      serialFinal[i].position4());
+    BOOST_CHECK_EQUAL(concurrentFinal[i].momentum4(),
+                      serialFinal[i].momentum4());
+  }
+  for (std::size_t i = 0; i < concurrentHits.size(); ++i) {
+    BOOST_CHECK_EQUAL(concurrentHits[i].particleId(),
+                      serialHits[i].particleId());
+    BOOST_CHECK_EQUAL(concurrentHits[i].geometryId(),
+                      serialHits[i].geometryId());
+    BOOST_CHECK_EQUAL(concurrentHits[i].position4(),
+                      serialHits[i].position4());
+  }
+}
@@ -0,0 +1,92 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+
+#include <limits>
+#include <utility>
+
+#include "PropagationDatasets.hpp"
+#include "PropagationTests.hpp"
+
+namespace {
+
+namespace ds = ActsTests::PropagationDatasets;
+using namespace Acts::UnitLiterals;
+
+using MagneticField = Acts::ConstantBField;
+using DoubleStepper = Acts::EigenStepper<MagneticField>;
+using DoublePropagator = Acts::Propagator<DoubleStepper>;
+using FloatStepper =
+    Acts::EigenStepper<MagneticField,
+                       Acts::StepperExtensionList<Acts::DefaultExtension>,
+                       Acts::detail::VoidAuctioneer, float>;
+using FloatPropagator = Acts::Propagator<FloatStepper>;
+
+// absolute parameter tolerances for position, direction, and absolute momentum
+constexpr auto epsPos = 1_um;
+constexpr auto epsDir = 0.125_mrad;
+constexpr auto epsMom = 1_eV;
+// relative covariance tolerance for the single precision transport
+constexpr auto epsCov = 0.001;
+
+const Acts::GeometryContext geoCtx;
+const Acts::MagneticFieldContext magCtx;
+
+inline std::pair<FloatPropagator, DoublePropagator> makePropagators(
+    double bz) {
+  MagneticField field(Acts::Vector3D(0.0, 0.0, bz));
+  return {FloatPropagator(FloatStepper(field)),
+          DoublePropagator(DoubleStepper(field))};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PropagationCompareEigenMixedPrecision)
+
+BOOST_DATA_TEST_CASE(Forward,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [floatPropagator, doublePropagator] = makePropagators(bz);
+  runForwardComparisonTest(
+      floatPropagator, doublePropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s, epsPos,
+      epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(ToCylinderAlongZ,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [floatPropagator, doublePropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      floatPropagator, doublePropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      ZCylinderSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_DATA_TEST_CASE(ToPlane,
+                     ds::phi* ds::thetaWithoutBeam* ds::absMomentum*
+                         ds::chargeNonZero* ds::pathLength* ds::magneticField,
+                     phi, theta, p, q, s, bz) {
+  auto [floatPropagator, doublePropagator] = makePropagators(bz);
+  runToSurfaceComparisonTest(
+      floatPropagator, doublePropagator, geoCtx, magCtx,
+      makeParametersCurvilinearWithCovariance(phi, theta, p, q), s,
+      PlaneSurfaceBuilder(), epsPos, epsDir, epsMom, epsCov);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
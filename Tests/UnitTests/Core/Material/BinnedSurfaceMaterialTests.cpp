@@ -14,6 +14,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 
 #include <climits>
+#include <memory>
 
 namespace Acts {
 
@@ -57,5 +58,41 @@ BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_construction_test) {
   BinnedSurfaceMaterial bsmMoveAssigned(std::move(bsmAssigned));
 }
 
+/// Test the tabulation of the interaction constants
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_interaction_constants_test) {
+  BinUtility xyBinning(2, -1., 1., open, binX);
+  xyBinning += BinUtility(2, -3., 3., open, binY);
+
+  MaterialSlabMatrix m = {
+      {MaterialSlab(Material::fromMolarDensity(1., 2., 3., 4., 5.), 6.),
+       MaterialSlab(Material::fromMolarDensity(2., 3., 4., 5., 6.), 7.)},
+      {MaterialSlab(Material::fromMolarDensity(3., 4., 5., 6., 7.), 8.),
+       MaterialSlab(Material::fromMolarDensity(4., 5., 6., 7., 8.), 9.)}};
+
+  BinnedSurfaceMaterial bsm(xyBinning, std::move(m));
+  BOOST_CHECK_EQUAL(bsm.interactionConstants(Vector3D(0.5, 1.5, 0.)), nullptr);
+
+  bsm.tabulateInteractionConstants();
+  // copies carry their own constants
+  auto bsmCopy = std::make_unique<BinnedSurfaceMaterial>(bsm);
+  bsm = BinnedSurfaceMaterial(xyBinning, MaterialSlabVector(2));
+  BOOST_CHECK_EQUAL(bsm.interactionConstants(Vector3D(0.5, 1.5, 0.)), nullptr);
+  // the constants are looked up in the same bin as the material
+  for (double x : {-0.5, 0.5}) {
+    for (double y : {-1.5, 1.5}) {
+      const Vector3D gp(x, y, 0.);
+      const auto* constants = bsmCopy->interactionConstants(gp);
+      BOOST_REQUIRE_NE(constants, nullptr);
+      MaterialInteractionConstants expected(
+          bsmCopy->materialSlab(gp).material());
+      BOOST_CHECK_EQUAL(constants->epsilonPerThickness,
+                        expected.epsilonPerThickness);
+      BOOST_CHECK_EQUAL(constants->invMeanExcitationEnergy2,
+                        expected.invMeanExcitationEnergy2);
+      BOOST_CHECK_EQUAL(constants->deltaHalfOffset, expected.deltaHalfOffset);
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
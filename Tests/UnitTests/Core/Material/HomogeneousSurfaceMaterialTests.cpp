@@ -43,6 +43,8 @@ BOOST_AUTO_TEST_CASE(HomogeneousSurfaceMaterial_construction_test) {
   HomogeneousSurfaceMaterial hsmAssignedMoved(std::move(hsmAssigned));
   // Test equality of the copy
   BOOST_CHECK_EQUAL(hsm, hsmAssignedMoved);
+  // The material is its own concrete material
+  BOOST_CHECK_EQUAL(&hsm.concreteMaterial(), &hsm);
 }
 
 // Test the Scaling
@@ -171,5 +173,24 @@ BOOST_AUTO_TEST_CASE(HomogeneousSurfaceMaterial_access_test) {
   BOOST_CHECK_EQUAL(mat, matFwdPre);
   BOOST_CHECK_EQUAL(vacuum, matBwdPre);
 }
+
+// Test the tabulation of the interaction constants
+BOOST_AUTO_TEST_CASE(HomogeneousSurfaceMaterial_interaction_constants_test) {
+  MaterialSlab mat(Material::fromMolarDensity(1., 2., 3., 4., 5.), 0.1);
+  HomogeneousSurfaceMaterial hsm(mat, 1.);
+  BOOST_CHECK_EQUAL(hsm.interactionConstants(Vector3D{0., 0., 0.}), nullptr);
+
+  hsm.tabulateInteractionConstants();
+  // scaling changes the thickness only, i.e. the constants stay valid
+  hsm *= 0.5;
+  const auto* constants = hsm.interactionConstants(Vector3D{1., 2., 3.});
+  BOOST_REQUIRE_NE(constants, nullptr);
+  MaterialInteractionConstants expected(mat.material());
+  BOOST_CHECK_EQUAL(constants->epsilonPerThickness,
+                    expected.epsilonPerThickness);
+  BOOST_CHECK_EQUAL(constants->invMeanExcitationEnergy2,
+                    expected.invMeanExcitationEnergy2);
+  BOOST_CHECK_EQUAL(constants->deltaHalfOffset, expected.deltaHalfOffset);
+}
 }  // namespace Test
 }  // namespace Acts
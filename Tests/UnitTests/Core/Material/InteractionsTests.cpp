@@ -10,6 +10,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Material/Interactions.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 #include "Acts/Utilities/PdgParticle.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -91,6 +92,19 @@ BOOST_DATA_TEST_CASE(multiple_scattering_consistency,
   BOOST_CHECK_LT(t2p, t0);
 }
 
+// precomputed material constants reproduce the direct computation
+BOOST_DATA_TEST_CASE(tabulated_material_constants,
+                     thickness* particle* momentum, x, i, m, q, p) {
+  const auto slab = Acts::MaterialSlab(material, x);
+  const auto constants = Acts::MaterialInteractionConstants(material);
+  const auto qOverP = q / p;
+
+  CHECK_CLOSE_REL(computeEnergyLossBethe(slab, constants, i, m, qOverP, q),
+                  computeEnergyLossBethe(slab, i, m, qOverP, q), 1e-5);
+  CHECK_CLOSE_REL(computeEnergyLossLandau(slab, constants, i, m, qOverP, q),
+                  computeEnergyLossLandau(slab, i, m, qOverP, q), 1e-5);
+}
+
 // no material -> no interactions
 BOOST_DATA_TEST_CASE(vacuum, thickness* particle* momentum, x, i, m, q, p) {
   const auto vacuum = Acts::MaterialSlab(Acts::Material(), x);
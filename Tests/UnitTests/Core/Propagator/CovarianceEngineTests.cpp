@@ -10,6 +10,7 @@
 
 #include "Acts/Propagator/detail/CovarianceEngine.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 
 namespace tt = boost::test_tools;
 
@@ -125,5 +126,59 @@ BOOST_AUTO_TEST_CASE(covariance_engine_test) {
   BOOST_CHECK_NE(std::get<1>(boundResult), 2. * Jacobian::Identity());
   BOOST_CHECK_EQUAL(std::get<2>(boundResult), 1337.);
 }
+
+/// The single precision transport has to reproduce the double precision
+/// reference within the expected float accuracy.
+BOOST_AUTO_TEST_CASE(covariance_engine_precision_test) {
+  GeometryContext tgContext = GeometryContext();
+
+  Vector3D position{1., 2., 3.};
+  double time = 4.;
+  Vector3D direction{sqrt(5. / 22.), 3. * sqrt(2. / 55.), 7. / sqrt(110.)};
+  double qop = 0.125;
+  FreeVector parameters;
+  parameters << position[0], position[1], position[2], time, direction[0],
+      direction[1], direction[2], qop;
+  auto surface = Surface::makeShared<PlaneSurface>(position, direction);
+
+  // Double precision reference
+  Covariance covariance = Covariance::Identity();
+  Jacobian jacobian = Jacobian::Identity();
+  FreeMatrix transportJacobian = FreeMatrix::Identity();
+  transportJacobian.topRightCorner<4, 4>().setConstant(0.25);
+  FreeVector derivatives;
+  derivatives << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8;
+  BoundToFreeMatrix jacobianLocalToGlobal = BoundToFreeMatrix::Identity();
+
+  // Single precision copies of the same inputs
+  detail::TransportBoundSymMatrix<float> covarianceF = covariance.cast<float>();
+  detail::TransportBoundMatrix<float> jacobianF = jacobian.cast<float>();
+  detail::TransportFreeMatrix<float> transportJacobianF =
+      transportJacobian.cast<float>();
+  detail::TransportFreeVector<float> derivativesF = derivatives.cast<float>();
+  detail::TransportBoundToFreeMatrix<float> jacobianLocalToGlobalF =
+      jacobianLocalToGlobal.cast<float>();
+
+  auto boundResult = detail::boundState(
+      tgContext, covariance, jacobian, transportJacobian, derivatives,
+      jacobianLocalToGlobal, parameters, true, 1337., *surface);
+  auto boundResultF = detail::boundState(
+      tgContext, covarianceF, jacobianF, transportJacobianF, derivativesF,
+      jacobianLocalToGlobalF, parameters, true, 1337., *surface);
+
+  BOOST_CHECK(std::get<0>(boundResultF).covariance().has_value());
+  CHECK_CLOSE_ABS(std::get<0>(boundResultF).parameters(),
+                  std::get<0>(boundResult).parameters(), 1e-12);
+  CHECK_CLOSE_COVARIANCE(*std::get<0>(boundResultF).covariance(),
+                         *std::get<0>(boundResult).covariance(), 1e-5);
+  CHECK_CLOSE_OR_SMALL(std::get<1>(boundResultF), std::get<1>(boundResult),
+                       1e-5, 1e-6);
+  // The jacobians are reinitialized identically in both precisions
+  CHECK_CLOSE_OR_SMALL(jacobianLocalToGlobalF.cast<double>(),
+                       jacobianLocalToGlobal, 1e-6, 1e-7);
+  BOOST_CHECK_EQUAL(transportJacobianF,
+                    detail::TransportFreeMatrix<float>::Identity());
+}
+
 }  // namespace Test
 }  // namespace Acts
\ No newline at end of file
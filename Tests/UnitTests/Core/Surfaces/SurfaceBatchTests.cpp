@@ -0,0 +1,149 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceBatch.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cmath>
+
+namespace bdata = boost::unit_test::data;
+
+namespace Acts {
+
+using namespace UnitLiterals;
+
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+/// Helper to build a rotated and shifted placement
+Transform3D placement(double x, double y, double z, double angle,
+                      const Vector3D& axis) {
+  return Transform3D::Identity() * Translation3D(x, y, z) *
+         AngleAxis3D(angle, axis.normalized());
+}
+
+/// Build a mixed set of surfaces, including some that are not handled
+/// by the dedicated batch kernels
+std::vector<std::shared_ptr<const Surface>> mixedSurfaces() {
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (int i = 0; i < 20; ++i) {
+    double phi = i * 2 * M_PI / 20;
+    Transform3D trf = placement(100_mm * std::cos(phi), 100_mm * std::sin(phi),
+                                (i - 10) * 20_mm, phi, Vector3D(0.1, 0.3, 1.));
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        trf, std::make_shared<RectangleBounds>(30_mm, 60_mm)));
+  }
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      placement(0., 0., 500_mm, 0.1, Vector3D(1., 0., 0.)), nullptr));
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      placement(0., 50_mm, 300_mm, 0.3, Vector3D(0., 1., 0.)),
+      std::make_shared<TrapezoidBounds>(20_mm, 40_mm, 50_mm)));
+  for (int i = 0; i < 5; ++i) {
+    surfaces.push_back(Surface::makeShared<DiscSurface>(
+        placement(0., 0., (i + 1) * 150_mm, 0.01 * i, Vector3D(1., 1., 0.)),
+        20_mm, 200_mm));
+  }
+  surfaces.push_back(Surface::makeShared<DiscSurface>(
+      placement(0., 0., -400_mm, 0., Vector3D(0., 0., 1.)), 20_mm, 200_mm,
+      0.5 * M_PI));
+  for (int i = 0; i < 4; ++i) {
+    surfaces.push_back(Surface::makeShared<CylinderSurface>(
+        placement(0., 0., 0., 0.02 * i, Vector3D(1., 0., 0.)), (i + 1) * 80_mm,
+        (i + 1) * 200_mm));
+  }
+  surfaces.push_back(Surface::makeShared<CylinderSurface>(
+      Transform3D::Identity(), 500_mm, 1_m, 0.25 * M_PI));
+  surfaces.push_back(Surface::makeShared<StrawSurface>(
+      placement(0., 300_mm, 0., 0.5 * M_PI, Vector3D(1., 0., 0.)), 5_mm,
+      1_m));
+  return surfaces;
+}
+
+/// Compare two intersections component-wise
+void checkIntersection(const Intersection3D& batch,
+                       const Intersection3D& reference) {
+  BOOST_CHECK(batch.status == reference.status);
+  if (reference.status != Intersection3D::Status::unreachable) {
+    CHECK_CLOSE_OR_SMALL(batch.pathLength, reference.pathLength, 1e-9, 1e-9);
+    CHECK_CLOSE_OR_SMALL(batch.position, reference.position, 1e-9, 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+BOOST_AUTO_TEST_CASE(SurfaceBatchGrouping) {
+  auto surfaces = mixedSurfaces();
+  SurfaceBatch batch(tgContext, unpack_shared_vector(surfaces));
+  BOOST_CHECK_EQUAL(batch.size(), surfaces.size());
+  // 21 planes, 5 discs and 4 cylinders are handled by the kernels
+  BOOST_CHECK_EQUAL(batch.vectorizedSize(), 30u);
+  for (size_t is = 0; is < surfaces.size(); ++is) {
+    BOOST_CHECK_EQUAL(batch.surfaces()[is], surfaces[is].get());
+  }
+}
+
+BOOST_DATA_TEST_CASE(
+    SurfaceBatchIntersection,
+    bdata::random((bdata::seed = 1,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 2,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(0.1, M_PI - 0.1))) ^
+        bdata::random((bdata::seed = 3,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-50_mm, 50_mm))) ^
+        bdata::xrange(100),
+    phi, theta, z, index) {
+  (void)index;
+  auto surfaces = mixedSurfaces();
+  SurfaceBatch batch(tgContext, unpack_shared_vector(surfaces));
+
+  Vector3D position(1_mm, -2_mm, z);
+  Vector3D direction(std::cos(phi) * std::sin(theta),
+                     std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  SymMatrix2D cov;
+  cov << 1_mm * 1_mm, 0., 0., 2_mm * 2_mm;
+  std::vector<BoundaryCheck> bchecks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 5_mm, 5_mm), BoundaryCheck(cov, 3.)};
+
+  std::vector<SurfaceIntersection> intersections;
+  for (const auto& bcheck : bchecks) {
+    batch.intersect(position, direction, bcheck, intersections);
+    BOOST_CHECK_EQUAL(intersections.size(), surfaces.size());
+    for (size_t is = 0; is < surfaces.size(); ++is) {
+      auto reference =
+          surfaces[is]->intersect(tgContext, position, direction, bcheck);
+      BOOST_CHECK_EQUAL(intersections[is].object, reference.object);
+      checkIntersection(intersections[is].intersection,
+                        reference.intersection);
+      checkIntersection(intersections[is].alternative, reference.alternative);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
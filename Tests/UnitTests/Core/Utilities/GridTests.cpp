@@ -13,7 +13,10 @@
 #include "Acts/Utilities/detail/Grid.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
+#include <stdexcept>
+#include <vector>
 
 namespace Acts {
 
@@ -1002,6 +1005,44 @@ BOOST_AUTO_TEST_CASE(grid_interpolation) {
   CHECK_CLOSE_REL(g.interpolate(Point({{2., 3., 4.}})), 80., 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(grid_view) {
+  using Point = std::array<double, 2>;
+  using Grid_t = Grid<double, EquidistantAxis, EquidistantAxis>;
+  auto axes = std::make_tuple(EquidistantAxis(0.0, 2.0, 2u),
+                              EquidistantAxis(0.0, 3.0, 3u));
+
+  Grid_t g(axes);
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    g.at(bin) = 0.5 * bin;
+  }
+
+  // external storage with ownership shared by all copies of the view
+  auto storage = std::make_shared<std::vector<double>>(g.size());
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    storage->at(bin) = 0.5 * bin;
+  }
+  std::shared_ptr<const double> values(storage, storage->data());
+  Grid_t view(axes, values);
+  const Grid_t viewCopy = view;
+  const Grid_t& constView = view;
+  storage.reset();
+  values.reset();
+
+  BOOST_CHECK_EQUAL(viewCopy.size(), g.size());
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    BOOST_CHECK_EQUAL(viewCopy.at(bin), g.at(bin));
+    BOOST_CHECK_EQUAL(&viewCopy.at(bin), &constView.at(bin));
+  }
+  for (const Point& p : {Point({{0.5, 0.5}}), Point({{1.2, 2.9}})}) {
+    BOOST_CHECK_EQUAL(viewCopy.atPosition(p), g.atPosition(p));
+    CHECK_CLOSE_REL(viewCopy.interpolate(p), g.interpolate(p), 1e-12);
+  }
+
+  // values of a view are read-only and bounds are checked
+  BOOST_CHECK_THROW(view.at(0) = 1., std::logic_error);
+  BOOST_CHECK_THROW(constView.at(g.size()), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_CASE(neighborhood) {
   using bins_t = std::vector<size_t>;
   using EAxis = EquidistantAxis;
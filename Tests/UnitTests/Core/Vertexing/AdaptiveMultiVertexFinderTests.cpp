@@ -14,6 +14,7 @@
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/VertexingDataHelper.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
@@ -24,9 +25,10 @@
 #include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
+#include <algorithm>
 #include <chrono>
-
-#include "VertexingDataHelper.hpp"
+#include <cmath>
+#include <functional>
 
 namespace Acts {
 namespace Test {
@@ -482,5 +484,265 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_grid_seed_finder_test) {
   }
 }
 
+using IPEstimator = ImpactPointEstimator<BoundTrackParameters, Propagator>;
+using Fitter = AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>;
+using SeedFinder =
+    TrackDensityVertexFinder<Fitter,
+                             GaussianTrackDensity<BoundTrackParameters>>;
+using Finder = AdaptiveMultiVertexFinder<Fitter, SeedFinder>;
+
+/// @brief Common set-up of the AMVF cache and z-slice tests with the
+/// Gaussian seed finder
+///
+/// Holds the tools and the reference event with the beam spot constraint,
+/// the finder configuration is created on demand such that the tests can
+/// adapt it.
+struct GaussianFinderSetup {
+  // Constant B-Field and propagator with void navigator
+  ConstantBField bField{Vector3D(0., 0., 2_T)};
+  std::shared_ptr<Propagator> propagator =
+      std::make_shared<Propagator>(EigenStepper<ConstantBField>(bField));
+
+  // IP 3D Estimator and linearizer for BoundTrackParameters
+  IPEstimator ipEstimator{IPEstimator::Config(bField, propagator)};
+  Linearizer linearizer{Linearizer::Config(bField, propagator)};
+
+  // The reference event
+  decltype(readTracksAndVertexCSV(toolString)) csvData =
+      readTracksAndVertexCSV(toolString);
+  std::vector<const BoundTrackParameters*> tracksPtr;
+  VertexingOptions<BoundTrackParameters> vertexingOptions{geoContext,
+                                                          magFieldContext};
+
+  GaussianFinderSetup() {
+    for (const auto& trk : tracks()) {
+      tracksPtr.push_back(&trk);
+    }
+    vertexingOptions.vertexConstraint = std::get<BeamSpotData>(csvData);
+  }
+
+  // The track pointers refer to the owned event
+  GaussianFinderSetup(const GaussianFinderSetup&) = delete;
+  GaussianFinderSetup& operator=(const GaussianFinderSetup&) = delete;
+
+  const std::vector<BoundTrackParameters>& tracks() const {
+    return std::get<TracksData>(csvData);
+  }
+
+  const std::vector<VertexInfo>& referenceVertices() const {
+    return std::get<VerticesData>(csvData);
+  }
+
+  /// The finder configuration with annealing and smoothing
+  Finder::Config makeFinderConfig() const {
+    std::vector<double> temperatures{8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+    AnnealingUtility::Config annealingConfig(temperatures);
+
+    Fitter::Config fitterCfg(ipEstimator);
+    fitterCfg.annealingTool = AnnealingUtility(annealingConfig);
+    // Test smoothing
+    fitterCfg.doSmoothing = true;
+
+    return Finder::Config(Fitter(fitterCfg), SeedFinder(), ipEstimator,
+                          linearizer);
+  }
+};
+
+/// @brief Checks that every reference vertex is matched in z by a found
+/// vertex with about the same number of tracks
+void checkVerticesMatchInZ(
+    const std::vector<Vertex<BoundTrackParameters>>& allVertices,
+    const std::vector<VertexInfo>& verticesInfo) {
+  const int expNRecoVertices = verticesInfo.size();
+
+  BOOST_CHECK_EQUAL(allVertices.size(), expNRecoVertices);
+  std::vector<bool> vtxFound(expNRecoVertices, false);
+
+  for (const auto& vtx : allVertices) {
+    double vtxZ = vtx.position()[eZ];
+    double diffZ = 1e5;
+    int foundVtxIdx = -1;
+    for (int i = 0; i < expNRecoVertices; i++) {
+      if (not vtxFound[i]) {
+        if (std::abs(vtxZ - verticesInfo[i].position[eZ]) < diffZ) {
+          diffZ = std::abs(vtxZ - verticesInfo[i].position[eZ]);
+          foundVtxIdx = i;
+        }
+      }
+    }
+    if (diffZ < 0.5_mm) {
+      vtxFound[foundVtxIdx] = true;
+      CHECK_CLOSE_ABS(vtx.tracks().size(), verticesInfo[foundVtxIdx].nTracks,
+                      1);
+    }
+  }
+  for (bool found : vtxFound) {
+    BOOST_CHECK_EQUAL(found, true);
+  }
+}
+
+/// @brief AMVF test finding the vertices in independent z-slices
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_zslices_test) {
+  // Set debug mode
+  bool debugMode = false;
+  GaussianFinderSetup setup;
+
+  Finder::Config finderConfig = setup.makeFinderConfig();
+  finderConfig.useZSlices = true;
+  // Find the vertices of the highest z-slice first: no slice may depend on
+  // the vertices or fitter state left behind by a neighbouring one
+  size_t nExecuted = 0;
+  finderConfig.zSliceExecutor = [&](size_t nSlices,
+                                    const std::function<void(size_t)>& func) {
+    for (size_t i = nSlices; i > 0; --i) {
+      func(i - 1);
+      ++nExecuted;
+    }
+  };
+  Finder finder(finderConfig);
+  Finder::State state;
+
+  auto t1 = std::chrono::system_clock::now();
+  auto findResult = finder.find(setup.tracksPtr, setup.vertexingOptions, state);
+  auto t2 = std::chrono::system_clock::now();
+
+  BOOST_CHECK(findResult.ok());
+  auto allVertices = *findResult;
+
+  if (debugMode) {
+    std::cout << "Found " << allVertices.size() << " vertices in "
+              << state.nZSlices << " z-slices, time needed: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1)
+                     .count()
+              << " ms" << std::endl;
+  }
+
+  BOOST_CHECK_GT(state.nZSlices, 1u);
+  BOOST_CHECK_EQUAL(nExecuted, state.nZSlices);
+
+  // Test expected outcomes from athena implementation
+  checkVerticesMatchInZ(allVertices, setup.referenceVertices());
+
+  // The iteration limit applies to every slice
+  Finder::Config limitedConfig = setup.makeFinderConfig();
+  limitedConfig.useZSlices = true;
+  limitedConfig.maxIterations = 1;
+  Finder limitedFinder(limitedConfig);
+  auto limitedResult =
+      limitedFinder.find(setup.tracksPtr, setup.vertexingOptions, state);
+  BOOST_REQUIRE(limitedResult.ok());
+  BOOST_CHECK_GT((*limitedResult).size(), 1u);
+  BOOST_CHECK_LE((*limitedResult).size(), state.nZSlices);
+}
+
+/// @brief AMVF test with a vertex sitting on a z-slice boundary
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_zslice_boundary_test) {
+  GaussianFinderSetup setup;
+  auto trackZ = [&](const BoundTrackParameters* trk) {
+    return trk->position(setup.vertexingOptions.geoContext)[eZ];
+  };
+
+  // The tracks of the vertex with the most tracks, ordered in z
+  Finder::Config finderConfig = setup.makeFinderConfig();
+  Finder finder(finderConfig);
+  Finder::State state;
+  auto findResult = finder.find(setup.tracksPtr, setup.vertexingOptions, state);
+  BOOST_REQUIRE(findResult.ok());
+  const auto allVertices = *findResult;
+  auto vertex = std::max_element(
+      allVertices.begin(), allVertices.end(),
+      [](const auto& a, const auto& b) {
+        return a.tracks().size() < b.tracks().size();
+      });
+  std::vector<const BoundTrackParameters*> vertexTracks;
+  for (const auto& trk : vertex->tracks()) {
+    vertexTracks.push_back(trk.originalParams);
+  }
+  std::sort(
+      vertexTracks.begin(), vertexTracks.end(),
+      [&](const auto* a, const auto* b) { return trackZ(a) < trackZ(b); });
+
+  // Put the slice boundary at the largest z difference in the central half
+  // of the tracks and keep the tracks on either side that are closer
+  const size_t nTracks = vertexTracks.size();
+  size_t iSplit = nTracks / 4;
+  for (size_t i = nTracks / 4; i < 3 * nTracks / 4; ++i) {
+    if (trackZ(vertexTracks[i + 1]) - trackZ(vertexTracks[i]) >
+        trackZ(vertexTracks[iSplit + 1]) - trackZ(vertexTracks[iSplit])) {
+      iSplit = i;
+    }
+  }
+  const double gap =
+      trackZ(vertexTracks[iSplit + 1]) - trackZ(vertexTracks[iSplit]);
+  size_t iBegin = iSplit;
+  while (iBegin > 0 and
+         trackZ(vertexTracks[iBegin]) - trackZ(vertexTracks[iBegin - 1]) <
+             gap) {
+    --iBegin;
+  }
+  size_t iEnd = iSplit + 1;
+  while (iEnd + 1 < nTracks and
+         trackZ(vertexTracks[iEnd + 1]) - trackZ(vertexTracks[iEnd]) < gap) {
+    ++iEnd;
+  }
+  std::vector<const BoundTrackParameters*> lowerTracks(
+      vertexTracks.begin() + iBegin, vertexTracks.begin() + iSplit + 1);
+  std::vector<const BoundTrackParameters*> upperTracks(
+      vertexTracks.begin() + iSplit + 1, vertexTracks.begin() + iEnd + 1);
+  BOOST_REQUIRE_GE(lowerTracks.size(), 2u);
+  BOOST_REQUIRE_GE(upperTracks.size(), 2u);
+
+  // The vertices found in either slice on its own
+  auto lowerResult = finder.find(lowerTracks, setup.vertexingOptions, state);
+  auto upperResult = finder.find(upperTracks, setup.vertexingOptions, state);
+  BOOST_REQUIRE(lowerResult.ok());
+  BOOST_REQUIRE(upperResult.ok());
+  auto sliceVertices = *lowerResult;
+  sliceVertices.insert(sliceVertices.end(), (*upperResult).begin(),
+                       (*upperResult).end());
+  size_t nSliceTracks = 0;
+  for (const auto& vtx : sliceVertices) {
+    nSliceTracks += vtx.tracks().size();
+  }
+
+  // Finding the vertices in z-slices merges the vertices at the boundary
+  std::vector<const BoundTrackParameters*> sliceTracks = lowerTracks;
+  sliceTracks.insert(sliceTracks.end(), upperTracks.begin(),
+                     upperTracks.end());
+  Finder::Config sliceConfig = setup.makeFinderConfig();
+  sliceConfig.useZSlices = true;
+  // all other track distances are smaller than the gap
+  sliceConfig.zSliceGap = std::nextafter(gap, 0.);
+  Finder sliceFinder(sliceConfig);
+  Finder::State sliceState;
+  auto sliceResult =
+      sliceFinder.find(sliceTracks, setup.vertexingOptions, sliceState);
+  BOOST_REQUIRE(sliceResult.ok());
+  const auto mergedVertices = *sliceResult;
+  BOOST_CHECK_EQUAL(sliceState.nZSlices, 2u);
+  BOOST_CHECK_LT(mergedVertices.size(), sliceVertices.size());
+
+  // No track of the merged vertices is lost, and every track is kept once
+  std::vector<const BoundTrackParameters*> outputTracks;
+  for (const auto& vtx : mergedVertices) {
+    for (const auto& trk : vtx.tracks()) {
+      outputTracks.push_back(trk.originalParams);
+    }
+  }
+  BOOST_CHECK_EQUAL(outputTracks.size(), nSliceTracks);
+  std::sort(outputTracks.begin(), outputTracks.end());
+  BOOST_CHECK(std::adjacent_find(outputTracks.begin(), outputTracks.end()) ==
+              outputTracks.end());
+
+  // The merged vertex is the one found without slices
+  auto merged = std::min_element(
+      mergedVertices.begin(), mergedVertices.end(),
+      [&](const auto& a, const auto& b) {
+        return std::abs(a.position()[eZ] - vertex->position()[eZ]) <
+               std::abs(b.position()[eZ] - vertex->position()[eZ]);
+      });
+  CHECK_CLOSE_ABS(merged->position()[eZ], vertex->position()[eZ], 0.5_mm);
+}
+
 }  // namespace Test
 }  // namespace Acts
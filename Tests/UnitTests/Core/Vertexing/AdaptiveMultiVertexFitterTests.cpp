@@ -13,6 +13,7 @@
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -123,17 +124,13 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
     vtxList.push_back(vtx);
   }
 
-  std::vector<Vertex<BoundTrackParameters>*> vtxPtrList;
-  int cv = 0;
   if (debugMode) {
+    int cv = 0;
     std::cout << "All vertices in test case: " << std::endl;
-  }
-  for (auto& vtx : vtxList) {
-    if (debugMode) {
+    for (auto& vtx : vtxList) {
       cv++;
       std::cout << "\t" << cv << ". vertex ptr: " << &vtx << std::endl;
     }
-    vtxPtrList.push_back(&vtx);
   }
 
   std::vector<BoundTrackParameters> allTracks;
@@ -179,35 +176,42 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>::State state(
       magFieldContext);
 
+  // The vertices and tracks are given by their index in the state, which
+  // is their index in vtxList and allTracks
+  for (auto& vtx : vtxList) {
+    state.vtxInfoMap.add(vtx);
+  }
+  for (auto& trk : allTracks) {
+    state.addTrack(&trk);
+  }
+
   for (unsigned int iTrack = 0; iTrack < nTracksPerVtx * vtxPosVec.size();
        iTrack++) {
     // Index of current vertex
     int vtxIdx = (int)(iTrack / nTracksPerVtx);
-    state.vtxInfoMap[&(vtxList[vtxIdx])].trackLinks.push_back(
-        &(allTracks[iTrack]));
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList[vtxIdx])),
-                       TrackAtVertex<BoundTrackParameters>(
-                           1., allTracks[iTrack], &(allTracks[iTrack]))));
+    state.vtxInfoMap[vtxIdx].trackLinks.push_back(iTrack);
+    state.tracksAtVerticesMap.emplace(
+        iTrack, vtxIdx,
+        TrackAtVertex<BoundTrackParameters>(1., allTracks[iTrack],
+                                            &(allTracks[iTrack])));
 
     // Use first track also for second vertex to let vtx1 and vtx2
     // share this track
     if (iTrack == 0) {
-      state.vtxInfoMap[&(vtxList.at(1))].trackLinks.push_back(
-          &(allTracks[iTrack]));
-      state.tracksAtVerticesMap.insert(
-          std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList.at(1))),
-                         TrackAtVertex<BoundTrackParameters>(
-                             1., allTracks[iTrack], &(allTracks[iTrack]))));
+      state.vtxInfoMap[1].trackLinks.push_back(iTrack);
+      state.tracksAtVerticesMap.emplace(
+          iTrack, 1,
+          TrackAtVertex<BoundTrackParameters>(1., allTracks[iTrack],
+                                              &(allTracks[iTrack])));
     }
   }
 
-  for (auto& vtx : vtxPtrList) {
-    state.addVertexToMultiMap(*vtx);
+  for (size_t iVtx = 0; iVtx < vtxList.size(); ++iVtx) {
+    state.attachVertexToTracks(iVtx);
     if (debugMode) {
-      std::cout << "Vertex, with ptr: " << vtx << std::endl;
-      for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
-        std::cout << "\t track ptr: " << trk << std::endl;
+      std::cout << "Vertex, with index: " << iVtx << std::endl;
+      for (auto& trk : state.vtxInfoMap[iVtx].trackLinks) {
+        std::cout << "\t track index: " << trk << std::endl;
       }
     }
   }
@@ -215,11 +219,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   if (debugMode) {
     std::cout << "Checking all vertices linked to a single track: "
               << std::endl;
-    for (auto& trk : allTracks) {
-      std::cout << "Track with ptr: " << &trk << std::endl;
-      auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-      for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-        std::cout << "\t used by vertex: " << vtxIter->second << std::endl;
+    for (size_t iTrk = 0; iTrk < allTracks.size(); ++iTrk) {
+      std::cout << "Track with index: " << iTrk << std::endl;
+      for (auto iVtx : state.trackToVertices[iTrk]) {
+        std::cout << "\t used by vertex: " << iVtx << std::endl;
       }
     }
   }
@@ -228,16 +231,13 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   // list in order to be able to compare later
   std::vector<Vertex<BoundTrackParameters>> seedListCopy = vtxList;
 
-  auto res1 =
-      fitter.addVtxToFit(state, vtxList.at(0), linearizer, vertexingOptions);
+  auto res1 = fitter.addVtxToFit(state, 0, linearizer, vertexingOptions);
   if (debugMode) {
     std::cout << "Tracks linked to each vertex AFTER fit: " << std::endl;
-    int c = 0;
-    for (auto& vtx : vtxPtrList) {
-      c++;
-      std::cout << c << ". vertex, with ptr: " << vtx << std::endl;
-      for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
-        std::cout << "\t track ptr: " << trk << std::endl;
+    for (size_t iVtx = 0; iVtx < vtxList.size(); ++iVtx) {
+      std::cout << iVtx << ". vertex" << std::endl;
+      for (auto& trk : state.vtxInfoMap[iVtx].trackLinks) {
+        std::cout << "\t track index: " << trk << std::endl;
       }
     }
   }
@@ -245,11 +245,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   if (debugMode) {
     std::cout << "Checking all vertices linked to a single track AFTER fit: "
               << std::endl;
-    for (auto& trk : allTracks) {
-      std::cout << "Track with ptr: " << &trk << std::endl;
-      auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-      for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-        std::cout << "\t used by vertex: " << vtxIter->second << std::endl;
+    for (size_t iTrk = 0; iTrk < allTracks.size(); ++iTrk) {
+      std::cout << "Track with index: " << iTrk << std::endl;
+      for (auto iVtx : state.trackToVertices[iTrk]) {
+        std::cout << "\t used by vertex: " << iVtx << std::endl;
       }
     }
   }
@@ -283,8 +282,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   CHECK_CLOSE_ABS(vtxList.at(1).fullPosition(),
                   seedListCopy.at(1).fullPosition(), 1_mm);
 
-  auto res2 =
-      fitter.addVtxToFit(state, vtxList.at(2), linearizer, vertexingOptions);
+  auto res2 = fitter.addVtxToFit(state, 2, linearizer, vertexingOptions);
   BOOST_CHECK(res2.ok());
 
   // Now also the third vertex should have been modified and fitted
@@ -414,11 +412,19 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
       BoundTrackParameters(geoContext, covMat2, pos2c, mom2c, -1, 0,
                            Surface::makeShared<PerigeeSurface>(pos2c)));
 
-  std::vector<Vertex<BoundTrackParameters>*> vtxList;
-
   AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>::State state(
       magFieldContext);
 
+  // The tracks of both vertices are given by their index in the state
+  std::vector<size_t> trackIndices1;
+  for (const auto& trk : params1) {
+    trackIndices1.push_back(state.addTrack(&trk));
+  }
+  std::vector<size_t> trackIndices2;
+  for (const auto& trk : params2) {
+    trackIndices2.push_back(state.addTrack(&trk));
+  }
+
   // The constraint vertex position covariance
   SymMatrix4D covConstr(SymMatrix4D::Identity());
   covConstr = covConstr * 1e+8;
@@ -428,9 +434,6 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   Vector3D vtxPos1(0.15_mm, 0.15_mm, 2.9_mm);
   Vertex<BoundTrackParameters> vtx1(vtxPos1);
 
-  // Add to vertex list
-  vtxList.push_back(&vtx1);
-
   // The constraint vtx for vtx1
   Vertex<BoundTrackParameters> vtx1Constr(vtxPos1);
   vtx1Constr.setFullCovariance(covConstr);
@@ -444,20 +447,20 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo1.oldPosition = vtxInfo1.linPoint;
   vtxInfo1.seedPosition = vtxInfo1.linPoint;
 
-  for (const auto& trk : params1) {
-    vtxInfo1.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx1),
-                       TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk)));
+  // Add to the vertices of the state
+  const size_t iVtx1 = state.vtxInfoMap.add(vtx1);
+
+  for (size_t i = 0; i < params1.size(); ++i) {
+    vtxInfo1.trackLinks.push_back(trackIndices1[i]);
+    state.tracksAtVerticesMap.emplace(
+        trackIndices1[i], iVtx1,
+        TrackAtVertex<BoundTrackParameters>(1.5, params1[i], &params1[i]));
   }
 
   // Prepare second vertex
   Vector3D vtxPos2(0.3_mm, -0.2_mm, -4.8_mm);
   Vertex<BoundTrackParameters> vtx2(vtxPos2);
 
-  // Add to vertex list
-  vtxList.push_back(&vtx2);
-
   // The constraint vtx for vtx2
   Vertex<BoundTrackParameters> vtx2Constr(vtxPos2);
   vtx2Constr.setFullCovariance(covConstr);
@@ -471,31 +474,38 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo2.oldPosition = vtxInfo2.linPoint;
   vtxInfo2.seedPosition = vtxInfo2.linPoint;
 
-  for (const auto& trk : params2) {
-    vtxInfo2.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx2),
-                       TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk)));
+  // Add to the vertices of the state
+  const size_t iVtx2 = state.vtxInfoMap.add(vtx2);
+
+  for (size_t i = 0; i < params2.size(); ++i) {
+    vtxInfo2.trackLinks.push_back(trackIndices2[i]);
+    state.tracksAtVerticesMap.emplace(
+        trackIndices2[i], iVtx2,
+        TrackAtVertex<BoundTrackParameters>(1.5, params2[i], &params2[i]));
   }
 
-  state.vtxInfoMap[&vtx1] = std::move(vtxInfo1);
-  state.vtxInfoMap[&vtx2] = std::move(vtxInfo2);
+  state.vtxInfoMap[iVtx1] = std::move(vtxInfo1);
+  state.vtxInfoMap[iVtx2] = std::move(vtxInfo2);
 
-  state.addVertexToMultiMap(vtx1);
-  state.addVertexToMultiMap(vtx2);
+  state.attachVertexToTracks(iVtx1);
+  state.attachVertexToTracks(iVtx2);
 
   // Fit vertices
-  fitter.fit(state, vtxList, linearizer, vertexingOptions);
-
-  auto vtx1Pos = state.vertexCollection.at(0)->position();
-  auto vtx1Cov = state.vertexCollection.at(0)->covariance();
-  // auto vtx1Trks = state.vertexCollection.at(0)->tracks();
-  auto vtx1FQ = state.vertexCollection.at(0)->fitQuality();
-
-  auto vtx2Pos = state.vertexCollection.at(1)->position();
-  auto vtx2Cov = state.vertexCollection.at(1)->covariance();
-  // auto vtx2Trks = state.vertexCollection.at(1)->tracks();
-  auto vtx2FQ = state.vertexCollection.at(1)->fitQuality();
+  fitter.fit(state, {iVtx1, iVtx2}, linearizer, vertexingOptions);
+
+  const auto& fittedVtx1 =
+      state.vtxInfoMap.vertex(state.vertexCollection.at(0));
+  auto vtx1Pos = fittedVtx1.position();
+  auto vtx1Cov = fittedVtx1.covariance();
+  // auto vtx1Trks = fittedVtx1.tracks();
+  auto vtx1FQ = fittedVtx1.fitQuality();
+
+  const auto& fittedVtx2 =
+      state.vtxInfoMap.vertex(state.vertexCollection.at(1));
+  auto vtx2Pos = fittedVtx2.position();
+  auto vtx2Cov = fittedVtx2.covariance();
+  // auto vtx2Trks = fittedVtx2.tracks();
+  auto vtx2FQ = fittedVtx2.fitQuality();
 
   if (debugMode) {
     // Vertex 1
@@ -560,5 +570,85 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   CHECK_CLOSE_ABS(vtx2FQ.second, expVtx2ndf, 0.001);
 }
 
+/// @brief Unit test for the flat vertex and track-at-vertex storage
+/// of the AdaptiveMultiVertexFitter state
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_state_storage_test) {
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+  BoundVector paramVec;
+  paramVec << 0.1_mm, 0.2_mm, 0.3, 1.2, 1. / 10_GeV, 0.;
+  Covariance covMat = Covariance::Identity();
+
+  std::vector<BoundTrackParameters> tracks;
+  for (int i = 0; i < 5; ++i) {
+    paramVec[eBoundLoc1] = i * 1_mm;
+    tracks.emplace_back(perigeeSurface, paramVec, covMat);
+  }
+  std::vector<Vertex<BoundTrackParameters>> vertices(3);
+
+  AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>::State state(
+      magFieldContext);
+
+  // Tracks and vertices are given consecutive indices
+  for (size_t it = 0; it < tracks.size(); ++it) {
+    BOOST_CHECK_EQUAL(state.addTrack(&tracks[it]), it);
+    BOOST_CHECK_EQUAL(state.tracks[it], &tracks[it]);
+  }
+  BOOST_CHECK_EQUAL(state.vtxInfoMap.add(vertices[1]), 0u);
+  state.vtxInfoMap[0].trackLinks.push_back(0);
+  auto& info = state.vtxInfoMap[0];
+  BOOST_CHECK_EQUAL(&state.vtxInfoMap.vertex(0), &vertices[1]);
+  BOOST_CHECK_EQUAL(state.vtxInfoMap.size(), 1u);
+  BOOST_CHECK_THROW(state.vtxInfoMap.at(1), std::out_of_range);
+  // References stay valid when more vertices are added
+  BOOST_CHECK_EQUAL(state.vtxInfoMap.add(vertices[0]), 1u);
+  BOOST_CHECK_EQUAL(state.vtxInfoMap.add(vertices[2]), 2u);
+  BOOST_CHECK_EQUAL(&info, &state.vtxInfoMap.at(0));
+  BOOST_CHECK_EQUAL(info.trackLinks.size(), 1u);
+
+  // Every (track, vertex) pair is stored once, in any insertion order
+  for (size_t iv = 0; iv < vertices.size(); ++iv) {
+    for (size_t it = tracks.size(); it-- > iv;) {
+      BOOST_CHECK(state.tracksAtVerticesMap.emplace(
+          it, iv,
+          TrackAtVertex<BoundTrackParameters>(1. * it + 10. * iv, tracks[it],
+                                              &tracks[it])));
+    }
+  }
+  BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.size(), 12u);
+  BOOST_CHECK(not state.tracksAtVerticesMap.emplace(
+      3, 1, TrackAtVertex<BoundTrackParameters>(-1., tracks[3], &tracks[3])));
+  BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.size(), 12u);
+
+  for (size_t iv = 0; iv < vertices.size(); ++iv) {
+    for (size_t it = 0; it < tracks.size(); ++it) {
+      if (it < iv) {
+        BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.find(it, iv), nullptr);
+        BOOST_CHECK_THROW(state.tracksAtVerticesMap.at(it, iv),
+                          std::out_of_range);
+      } else {
+        BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.at(it, iv).chi2Track,
+                          1. * it + 10. * iv);
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.find(0, 3), nullptr);
+  BOOST_CHECK_EQUAL(state.tracksAtVerticesMap.find(5, 0), nullptr);
+
+  // Vertices are attached to and detached from the tracks they hold
+  state.vtxInfoMap[1].trackLinks = {0, 2};
+  state.vtxInfoMap[2].trackLinks = {2, 4};
+  for (size_t iv = 0; iv < vertices.size(); ++iv) {
+    state.attachVertexToTracks(iv);
+  }
+  BOOST_CHECK(state.trackToVertices[0] == std::vector<size_t>({0, 1}));
+  BOOST_CHECK(state.trackToVertices[2] == std::vector<size_t>({1, 2}));
+  state.detachVertexFromTracks(1);
+  BOOST_CHECK(state.trackToVertices[0] == std::vector<size_t>({0}));
+  BOOST_CHECK(state.trackToVertices[2] == std::vector<size_t>({2}));
+  BOOST_CHECK(state.trackToVertices[4] == std::vector<size_t>({2}));
+  BOOST_CHECK(state.trackToVertices[1].empty());
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -370,5 +370,129 @@ BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_usertrack_test) {
   }
 }
 
+///
+/// @brief Unit test for FullBilloirVertexFitter without any fit iteration,
+/// reusing a state that holds the track blocks of a previous fit
+///
+BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_no_iteration_test) {
+  // Set up constant B-Field
+  ConstantBField bField(0.0, 0.0, 1_T);
+
+  // Set up Eigenstepper
+  EigenStepper<ConstantBField> stepper(bField);
+  // Set up propagator with void navigator
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  // Set up Billoir Vertex Fitters with and without iterations
+  using VertexFitter =
+      FullBilloirVertexFitter<BoundTrackParameters, Linearizer>;
+  VertexFitter::Config vertexFitterCfg;
+  VertexFitter billoirFitter(vertexFitterCfg);
+  VertexFitter::Config noIterationCfg;
+  noIterationCfg.maxIterations = 0;
+  VertexFitter noIterationFitter(noIterationCfg);
+  VertexFitter::State state(magFieldContext);
+
+  VertexingOptions<BoundTrackParameters> vfOptions(geoContext,
+                                                   magFieldContext);
+
+  // Tracks emerging from a vertex at z = 5 mm
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+  Covariance covMat = Covariance::Zero();
+  covMat.diagonal() << 20_um * 20_um, 20_um * 20_um, 1e-4, 1e-4, 1e-4, 1.;
+  std::vector<BoundTrackParameters> tracks;
+  for (double phi : {-2., -0.5, 1., 2.5}) {
+    BoundVector paramVec;
+    paramVec << 0., 5_mm, phi, 1.2, 1. / 2_GeV, 0.;
+    tracks.emplace_back(perigeeSurface, paramVec, covMat);
+  }
+  std::vector<const BoundTrackParameters*> tracksPtr;
+  for (const auto& trk : tracks) {
+    tracksPtr.push_back(&trk);
+  }
+
+  // A regular fit fills the per-track blocks of the state
+  Vertex<BoundTrackParameters> fittedVertex =
+      billoirFitter.fit(tracksPtr, linearizer, vfOptions, state).value();
+  BOOST_CHECK_EQUAL(fittedVertex.tracks().size(), tracks.size());
+
+  // Without an accepted iteration there are no refitted tracks
+  fittedVertex =
+      noIterationFitter.fit(tracksPtr, linearizer, vfOptions, state).value();
+  BOOST_CHECK(fittedVertex.tracks().empty());
+  BOOST_CHECK_EQUAL(fittedVertex.position(), Vector3D(0., 0., 0.));
+  BOOST_CHECK_EQUAL(fittedVertex.fullCovariance(), SymMatrix4D::Zero());
+}
+
+///
+/// @brief Unit test for FullBilloirVertexFitter with track weights that are
+/// not positive definite, which can not be fitted
+///
+BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_numeric_failure_test) {
+  // Set up constant B-Field
+  ConstantBField bField(0.0, 0.0, 1_T);
+
+  // Set up Eigenstepper
+  EigenStepper<ConstantBField> stepper(bField);
+  // Set up propagator with void navigator
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  // Set up Billoir Vertex Fitter
+  using VertexFitter =
+      FullBilloirVertexFitter<BoundTrackParameters, Linearizer>;
+  VertexFitter::Config vertexFitterCfg;
+  VertexFitter billoirFitter(vertexFitterCfg);
+  VertexFitter::State state(magFieldContext);
+
+  VertexingOptions<BoundTrackParameters> vfOptions(geoContext,
+                                                   magFieldContext);
+
+  // Tracks emerging from a vertex at z = 5 mm with the given covariance
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+  auto fitTracks = [&](const Covariance& covMat) {
+    std::vector<BoundTrackParameters> tracks;
+    for (double phi : {-2., -0.5, 1., 2.5}) {
+      BoundVector paramVec;
+      paramVec << 0., 5_mm, phi, 1.2, 1. / 2_GeV, 0.;
+      tracks.emplace_back(perigeeSurface, paramVec, covMat);
+    }
+    std::vector<const BoundTrackParameters*> tracksPtr;
+    for (const auto& trk : tracks) {
+      tracksPtr.push_back(&trk);
+    }
+    return billoirFitter.fit(tracksPtr, linearizer, vfOptions, state);
+  };
+
+  Covariance covMat = Covariance::Zero();
+  covMat.diagonal() << 20_um * 20_um, 20_um * 20_um, 1e-4, 1e-4, 1e-4, 1.;
+  BOOST_CHECK(fitTracks(covMat).ok());
+
+  // The momentum block of the track weights is negative definite
+  Covariance momentumCovMat = covMat;
+  momentumCovMat.diagonal().segment<3>(eBoundPhi) *= -1.;
+  auto momentumResult = fitTracks(momentumCovMat);
+  BOOST_REQUIRE(not momentumResult.ok());
+  BOOST_CHECK_EQUAL(momentumResult.error(),
+                    make_error_code(VertexingError::NumericFailure));
+
+  // The position block of the track weights is negative definite
+  Covariance positionCovMat = covMat;
+  positionCovMat.diagonal().segment<2>(eBoundLoc0) *= -1.;
+  auto positionResult = fitTracks(positionCovMat);
+  BOOST_REQUIRE(not positionResult.ok());
+  BOOST_CHECK_EQUAL(positionResult.error(),
+                    make_error_code(VertexingError::NumericFailure));
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -17,6 +17,10 @@
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/GaussianGridTrackDensity.hpp"
 
+#include <limits>
+#include <memory>
+#include <random>
+
 namespace bdata = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
 
@@ -280,5 +284,103 @@ BOOST_AUTO_TEST_CASE(gaussian_grid_seed_width_test) {
   BOOST_CHECK(width != 0.);
 }
 
+/// @brief Tests the seed width of maxima in the first and last bin
+BOOST_AUTO_TEST_CASE(gaussian_grid_seed_width_edge_test) {
+  const int mainGridSize = 50;
+  const int trkGridSize = 11;
+
+  double binSize = 0.1;  // mm
+  double zMinMax = mainGridSize / 2 * binSize;
+
+  GaussianGridTrackDensity<mainGridSize, trkGridSize>::Config cfg(zMinMax);
+  GaussianGridTrackDensity<mainGridSize, trkGridSize> grid(cfg);
+
+  // The grid is followed by a NaN, such that reading past its end results
+  // in an invalid width
+  struct {
+    ActsVectorF<mainGridSize> mainGrid = ActsVectorF<mainGridSize>::Zero();
+    float guard = std::numeric_limits<float>::quiet_NaN();
+  } padded;
+  auto& mainGrid = padded.mainGrid;
+
+  // Maximum in the last bin
+  mainGrid.tail<4>() << 0.5, 1.5, 3., 4.;
+  auto maxRes = grid.getMaxZPositionAndWidth(mainGrid);
+  BOOST_CHECK(maxRes.ok());
+  CHECK_CLOSE_ABS((*maxRes).first, zMinMax - 0.5 * binSize, 1e-5);
+  // The half maximum is reached within two bins of the maximum
+  BOOST_CHECK_GT((*maxRes).second, 0.);
+  BOOST_CHECK_LT((*maxRes).second, 4 * binSize / 2.355);
+
+  // Maximum in the first bin
+  mainGrid.setZero();
+  mainGrid.head<4>() << 4., 3., 1.5, 0.5;
+  maxRes = grid.getMaxZPositionAndWidth(mainGrid);
+  BOOST_CHECK(maxRes.ok());
+  CHECK_CLOSE_ABS((*maxRes).first, -zMinMax + 0.5 * binSize, 1e-5);
+  // The half maximum is reached within two bins of the maximum
+  BOOST_CHECK_GT((*maxRes).second, 0.);
+  BOOST_CHECK_LT((*maxRes).second, 4 * binSize / 2.355);
+}
+
+/// @brief Tests the incremental block maxima on a large grid
+BOOST_AUTO_TEST_CASE(gaussian_grid_block_maxima_test) {
+  // 0.1 mm bins over +-300 mm
+  const int mainGridSize = 6000;
+  const int trkGridSize = 15;
+
+  using GridDensity = GaussianGridTrackDensity<mainGridSize, trkGridSize>;
+  GridDensity::Config cfg(300_mm);
+  GridDensity grid(cfg);
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  std::mt19937 gen(31415);
+  std::uniform_real_distribution<> d0Dist(-0.2_mm, 0.2_mm);
+  std::uniform_real_distribution<> z0Dist(-305_mm, 305_mm);
+  std::uniform_real_distribution<> resDist(0.05_mm, 0.5_mm);
+
+  auto mainGrid = std::make_unique<ActsVectorF<mainGridSize>>(
+      ActsVectorF<mainGridSize>::Zero());
+  GridDensity::BlockMaxima maxima;
+
+  // Empty grid
+  BOOST_CHECK(!grid.getMaxZPosition(*mainGrid, maxima).ok());
+
+  std::vector<std::pair<int, ActsVectorF<trkGridSize>>> binAndTrackGrids;
+  for (int i = 0; i < 500; i++) {
+    BoundVector paramVec = BoundVector::Zero();
+    paramVec[eBoundLoc0] = d0Dist(gen);
+    paramVec[eBoundLoc1] = z0Dist(gen);
+    Covariance covMat = Covariance::Identity();
+    covMat(eBoundLoc0, eBoundLoc0) = std::pow(resDist(gen), 2);
+    covMat(eBoundLoc1, eBoundLoc1) = std::pow(resDist(gen), 2);
+    BoundTrackParameters params(perigeeSurface, paramVec, covMat);
+
+    auto binAndTrackGrid = grid.addTrack(params, *mainGrid, maxima);
+    if (binAndTrackGrid.first >= 0) {
+      binAndTrackGrids.push_back(binAndTrackGrid);
+    }
+    auto fullScan = grid.getMaxZPosition(*mainGrid);
+    auto tracked = grid.getMaxZPosition(*mainGrid, maxima);
+    BOOST_CHECK_EQUAL(fullScan.ok(), tracked.ok());
+    if (fullScan.ok()) {
+      BOOST_CHECK_EQUAL(*fullScan, *tracked);
+    }
+  }
+  BOOST_CHECK(not binAndTrackGrids.empty());
+
+  // Removing tracks updates the maximum without a rescan
+  for (const auto& [zBin, trackGrid] : binAndTrackGrids) {
+    grid.removeTrackGridFromMainGrid(zBin, trackGrid, *mainGrid, maxima);
+    int block = maxima.maxBlock();
+    int maxBin = -1;
+    float maxValue = mainGrid->maxCoeff(&maxBin);
+    BOOST_CHECK_EQUAL(maxima.values[block], maxValue);
+    BOOST_CHECK_EQUAL(maxima.bins[block], maxBin);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
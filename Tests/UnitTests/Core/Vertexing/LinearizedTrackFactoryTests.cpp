@@ -242,5 +242,167 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_straightline_test) {
   }
 }
 
+/// Propagator options with a proton mass hypothesis
+struct ProtonPropagatorOptions : public PropagatorOptions<> {
+  ProtonPropagatorOptions(
+      std::reference_wrapper<const GeometryContext> gctx,
+      std::reference_wrapper<const MagneticFieldContext> mctx,
+      LoggerWrapper loggerWrapper)
+      : PropagatorOptions<>(gctx, mctx, loggerWrapper) {
+    mass = 938.272_MeV;
+  }
+};
+
+///
+/// @brief Unit test for the analytical perigee transport of the
+/// HelicalTrackLinearizer, compared to the propagation
+///
+BOOST_AUTO_TEST_CASE(linearized_track_factory_analytical_test) {
+  // Number of tracks
+  unsigned int nTracks = 100;
+
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up constant B-Field
+  ConstantBField bField(0.0, 0.0, 2_T);
+
+  // Set up Eigenstepper
+  EigenStepper<ConstantBField> stepper(bField);
+
+  // Set up propagator with void navigator
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  // Create perigee surface
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linFactory(ltConfig);
+  Linearizer::Config ltConfigAnalytical(bField, propagator);
+  ltConfigAnalytical.analyticalPerigee = true;
+  Linearizer linFactoryAnalytical(ltConfigAnalytical);
+  Linearizer::State state(magFieldContext);
+
+  for (unsigned int iTrack = 0; iTrack < nTracks; iTrack++) {
+    // Construct positive or negative charge randomly
+    double q = qDist(gen) < 0 ? -1. : 1.;
+
+    // Construct random track parameters
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), 0.;
+
+    // Resolutions
+    double resD0 = resIPDist(gen);
+    double resZ0 = resIPDist(gen);
+    double resPh = resAngDist(gen);
+    double resTh = resAngDist(gen);
+    double resQp = resQoPDist(gen);
+
+    // Fill vector of track objects with simple covariance matrix
+    Covariance covMat;
+
+    covMat << resD0 * resD0, 0., 0., 0., 0., 0., 0., resZ0 * resZ0, 0., 0., 0.,
+        0., 0., 0., resPh * resPh, 0., 0., 0., 0., 0., 0., resTh * resTh, 0.,
+        0., 0., 0., 0., 0., resQp * resQp, 0., 0., 0., 0., 0., 0., 1.;
+    BoundTrackParameters parameters(perigeeSurface, paramVec,
+                                    std::move(covMat));
+
+    // Linearize w.r.t. a displaced point
+    Vector4D linPoint(vXYDist(gen), vXYDist(gen), vZDist(gen), 0.);
+
+    LinearizedTrack linTrack =
+        linFactory
+            .linearizeTrack(parameters, linPoint, geoContext, magFieldContext,
+                            state)
+            .value();
+    LinearizedTrack linTrackAnalytical =
+        linFactoryAnalytical
+            .linearizeTrack(parameters, linPoint, geoContext, magFieldContext,
+                            state)
+            .value();
+
+    // The propagation reaches the surface within its on-surface tolerance
+    CHECK_CLOSE_ABS(linTrackAnalytical.parametersAtPCA.head<5>(),
+                    linTrack.parametersAtPCA.head<5>(), 1_um);
+    CHECK_CLOSE_ABS(linTrackAnalytical.positionAtPCA.head<3>(),
+                    linTrack.positionAtPCA.head<3>(), 1_um);
+    CHECK_CLOSE_ABS(linTrackAnalytical.parametersAtPCA[eBoundTime],
+                    linTrack.parametersAtPCA[eBoundTime], 1_um);
+    // The time correlations are not transported analytically
+    ActsSymMatrixD<5> covAnalytical =
+        linTrackAnalytical.covarianceAtPCA.topLeftCorner<5, 5>();
+    ActsSymMatrixD<5> cov = linTrack.covarianceAtPCA.topLeftCorner<5, 5>();
+    CHECK_CLOSE_COVARIANCE(covAnalytical, cov, 1e-3);
+    CHECK_CLOSE_OR_SMALL(linTrackAnalytical.positionJacobian,
+                         linTrack.positionJacobian, 1e-6, 1e-9);
+    CHECK_CLOSE_OR_SMALL(linTrackAnalytical.momentumJacobian,
+                         linTrack.momentumJacobian, 1e-6, 1e-9);
+    CHECK_CLOSE_OR_SMALL(linTrackAnalytical.constantTerm.head<5>(),
+                         linTrack.constantTerm.head<5>(), 1e-6, 1e-9);
+  }
+}
+
+///
+/// @brief Unit test for the time of the analytical perigee transport with
+/// the mass hypothesis of the propagator options
+///
+BOOST_AUTO_TEST_CASE(linearized_track_factory_analytical_mass_test) {
+  using ProtonLinearizer =
+      HelicalTrackLinearizer<Propagator<EigenStepper<ConstantBField>>,
+                             ProtonPropagatorOptions>;
+
+  ConstantBField bField(0.0, 0.0, 2_T);
+  EigenStepper<ConstantBField> stepper(bField);
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  ProtonLinearizer::Config ltConfig(bField, propagator);
+  ProtonLinearizer linFactory(ltConfig);
+  ProtonLinearizer::Config ltConfigAnalytical(bField, propagator);
+  ltConfigAnalytical.analyticalPerigee = true;
+  ProtonLinearizer linFactoryAnalytical(ltConfigAnalytical);
+  ProtonLinearizer::State state(magFieldContext);
+  Linearizer::Config pionConfigAnalytical(bField, propagator);
+  pionConfigAnalytical.analyticalPerigee = true;
+  Linearizer pionLinFactoryAnalytical(pionConfigAnalytical);
+  Linearizer::State pionState(magFieldContext);
+
+  // A slow track far away from the linearization point
+  BoundVector paramVec;
+  paramVec << 0.01_mm, 0.1_mm, 0.5, 1.2, 1. / 0.5_GeV, 0.;
+  Covariance covMat = Covariance::Identity() * 1e-4;
+  BoundTrackParameters parameters(perigeeSurface, paramVec, std::move(covMat));
+  Vector4D linPoint(5_mm, -5_mm, 1_mm, 0.);
+
+  LinearizedTrack linTrack =
+      linFactory
+          .linearizeTrack(parameters, linPoint, geoContext, magFieldContext,
+                          state)
+          .value();
+  LinearizedTrack linTrackAnalytical =
+      linFactoryAnalytical
+          .linearizeTrack(parameters, linPoint, geoContext, magFieldContext,
+                          state)
+          .value();
+  LinearizedTrack linTrackPion =
+      pionLinFactoryAnalytical
+          .linearizeTrack(parameters, linPoint, geoContext, magFieldContext,
+                          pionState)
+          .value();
+
+  CHECK_CLOSE_ABS(linTrackAnalytical.parametersAtPCA[eBoundTime],
+                  linTrack.parametersAtPCA[eBoundTime], 1_um);
+  // the default pion hypothesis gives a clearly different time
+  BOOST_CHECK_GT(std::abs(linTrackPion.parametersAtPCA[eBoundTime] -
+                          linTrack.parametersAtPCA[eBoundTime]),
+                 1_mm);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+using Acts::GeometryID;
+using ActsExamples::sortByGeometryId;
+
+namespace {
+
+/// Element with a geometry id and its position in the unsorted input.
+struct Element {
+  GeometryID id;
+  size_t index = 0;
+
+  GeometryID geometryId() const { return id; }
+};
+
+bool operator==(const Element& lhs, const Element& rhs) {
+  return (lhs.id == rhs.id) and (lhs.index == rhs.index);
+}
+
+std::vector<Element> makeElements(const std::vector<GeometryID>& ids) {
+  std::vector<Element> elements(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    elements[i] = {ids[i], i};
+  }
+  return elements;
+}
+
+/// Random ids from a few modules, i.e. with many duplicates.
+std::vector<GeometryID> makeModuleIds(size_t n, std::mt19937& rng) {
+  std::uniform_int_distribution<GeometryID::Value> volume(1u, 3u);
+  std::uniform_int_distribution<GeometryID::Value> layer(1u, 4u);
+  std::uniform_int_distribution<GeometryID::Value> sensitive(1u, 300u);
+  std::vector<GeometryID> ids(n);
+  for (auto& id : ids) {
+    id = GeometryID()
+             .setVolume(volume(rng))
+             .setLayer(2u * layer(rng))
+             .setSensitive(sensitive(rng));
+  }
+  return ids;
+}
+
+/// Random ids with all bits used, i.e. every radix pass is needed.
+std::vector<GeometryID> makeEncodedIds(size_t n, std::mt19937& rng) {
+  std::uniform_int_distribution<GeometryID::Value> encoded;
+  std::vector<GeometryID> ids(n);
+  for (auto& id : ids) {
+    id = GeometryID(encoded(rng));
+  }
+  return ids;
+}
+
+void checkSortByGeometryId(std::vector<Element> elements) {
+  auto expected = elements;
+  std::stable_sort(expected.begin(), expected.end(),
+                   ActsExamples::detail::CompareGeometryId{});
+  sortByGeometryId(elements);
+  BOOST_CHECK(elements == expected);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesGeometryContainers)
+
+BOOST_AUTO_TEST_CASE(SortByGeometryIdEmptyAndSingle) {
+  checkSortByGeometryId({});
+  checkSortByGeometryId(makeElements({GeometryID().setVolume(2u)}));
+  checkSortByGeometryId(makeElements({GeometryID(~GeometryID::Value(0))}));
+}
+
+BOOST_AUTO_TEST_CASE(SortByGeometryIdRandom) {
+  std::mt19937 rng(12345u);
+  for (size_t n : {2u, 10u, 1000u, 10000u}) {
+    BOOST_TEST_CONTEXT(n << " elements") {
+      checkSortByGeometryId(makeElements(makeModuleIds(n, rng)));
+      checkSortByGeometryId(makeElements(makeEncodedIds(n, rng)));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SortByGeometryIdDuplicates) {
+  std::mt19937 rng(2020u);
+  // all elements with the same id must keep their order
+  checkSortByGeometryId(
+      makeElements(std::vector<GeometryID>(100u, GeometryID().setLayer(2u))));
+  // only two distinct ids that differ in a single byte
+  auto ids = makeModuleIds(1000u, rng);
+  for (auto& id : ids) {
+    id = GeometryID().setSensitive(id.sensitive() % 2u);
+  }
+  checkSortByGeometryId(makeElements(ids));
+}
+
+BOOST_AUTO_TEST_CASE(SortByGeometryIdOrderedInput) {
+  std::mt19937 rng(42u);
+  for (auto ids : {makeModuleIds(1000u, rng), makeEncodedIds(1000u, rng)}) {
+    std::sort(ids.begin(), ids.end());
+    // already sorted
+    checkSortByGeometryId(makeElements(ids));
+    // reversed, i.e. duplicates are also in reverse input order
+    std::reverse(ids.begin(), ids.end());
+    checkSortByGeometryId(makeElements(ids));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SortByGeometryIdMapItems) {
+  std::mt19937 rng(7u);
+  const auto ids = makeModuleIds(1000u, rng);
+  std::vector<std::pair<GeometryID, size_t>> items;
+  for (size_t i = 0; i < ids.size(); ++i) {
+    items.emplace_back(ids[i], i);
+  }
+  auto expected = items;
+  std::stable_sort(expected.begin(), expected.end(),
+                   ActsExamples::detail::CompareGeometryId{});
+  sortByGeometryId(items);
+  BOOST_CHECK(items == expected);
+
+  // the sorted sequence is a valid ordered range for the multimap
+  ActsExamples::GeometryIdMultimap<size_t> map(
+      boost::container::ordered_range, items.begin(), items.end());
+  BOOST_CHECK_EQUAL(map.size(), items.size());
+  BOOST_CHECK(std::equal(map.begin(), map.end(), expected.begin()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/PhiloxRandomEngine.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using ActsExamples::PhiloxRandomEngine;
+
+namespace {
+
+using Block = std::array<uint32_t, 4>;
+using Key = std::array<uint32_t, 2>;
+
+/// The 64 bit engine key from the two key words
+uint64_t engineKey(const Key& key) {
+  return (static_cast<uint64_t>(key[1]) << 32) | key[0];
+}
+
+/// Draw the next numbers from an engine
+std::vector<uint32_t> draw(PhiloxRandomEngine& engine, size_t n) {
+  std::vector<uint32_t> numbers;
+  for (size_t i = 0; i < n; ++i) {
+    numbers.push_back(engine());
+  }
+  return numbers;
+}
+
+/// Draw the next block of four numbers from an engine
+Block drawBlock(PhiloxRandomEngine& engine) {
+  return {engine(), engine(), engine(), engine()};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesPhiloxRandomEngine)
+
+// Known answer tests of the Random123 reference implementation, see the
+// philox4x32 10 entries of its kat_vectors file.
+BOOST_AUTO_TEST_CASE(KnownAnswers) {
+  // zero counter and key
+  BOOST_CHECK(PhiloxRandomEngine::generateBlock({0u, 0u, 0u, 0u}, {0u, 0u}) ==
+              (Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+  // all bits set
+  BOOST_CHECK(PhiloxRandomEngine::generateBlock(
+                  {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                  {0xffffffffu, 0xffffffffu}) ==
+              (Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+  // digits of pi
+  BOOST_CHECK(PhiloxRandomEngine::generateBlock(
+                  {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                  {0xa4093822u, 0x299f31d0u}) ==
+              (Block{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+BOOST_AUTO_TEST_CASE(EngineOutput) {
+  // The engine output is the sequence of blocks for the increasing counter
+  PhiloxRandomEngine zero;
+  BOOST_CHECK(drawBlock(zero) ==
+              (Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+  BOOST_CHECK(drawBlock(zero) ==
+              PhiloxRandomEngine::generateBlock({1u, 0u, 0u, 0u}, {0u, 0u}));
+
+  // The stream index is the upper half of the counter
+  Key key = {0xa4093822u, 0x299f31d0u};
+  PhiloxRandomEngine stream(engineKey(key), 0x0370734413198a2eu);
+  BOOST_CHECK(drawBlock(stream) ==
+              PhiloxRandomEngine::generateBlock(
+                  {0u, 0u, 0x13198a2eu, 0x03707344u}, key));
+
+  // The block counter carries into its upper word
+  PhiloxRandomEngine carry(engineKey(key));
+  carry.discard(4ull << 32);
+  BOOST_CHECK(drawBlock(carry) ==
+              PhiloxRandomEngine::generateBlock({0u, 1u, 0u, 0u}, key));
+}
+
+BOOST_AUTO_TEST_CASE(Discard) {
+  // discard(n) is equivalent to n calls, from any position within a block
+  for (size_t offset = 0; offset < 4; ++offset) {
+    for (uint64_t n : {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 13u, 64u, 1001u}) {
+      PhiloxRandomEngine skipped(0x123456789abcdefu, 42u);
+      PhiloxRandomEngine stepped(0x123456789abcdefu, 42u);
+      draw(skipped, offset);
+      draw(stepped, offset);
+      skipped.discard(n);
+      draw(stepped, n);
+      BOOST_CHECK(skipped == stepped);
+      BOOST_CHECK(draw(skipped, 9) == draw(stepped, 9));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Streams) {
+  // Equal keys and streams reproduce, different ones differ
+  PhiloxRandomEngine engine(17u, 3u);
+  PhiloxRandomEngine same(17u, 3u);
+  PhiloxRandomEngine otherStream(17u, 4u);
+  PhiloxRandomEngine otherKey(18u, 3u);
+  BOOST_CHECK(engine == same);
+  BOOST_CHECK(engine != otherStream);
+  auto numbers = draw(engine, 16);
+  BOOST_CHECK(numbers == draw(same, 16));
+  BOOST_CHECK(numbers != draw(otherStream, 16));
+  BOOST_CHECK(numbers != draw(otherKey, 16));
+
+  // Usable with the standard library distributions
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  for (size_t i = 0; i < 100; ++i) {
+    double u = uniform(engine);
+    BOOST_CHECK_GE(u, 0.);
+    BOOST_CHECK_LT(u, 1.);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,187 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ActsExamples::AlgorithmContext;
+using ActsExamples::ProcessCode;
+using ActsExamples::Sequencer;
+
+namespace {
+
+constexpr size_t kNoEvent = SIZE_MAX;
+
+/// Stores the event number, optionally failing for one event.
+class DummyReader final : public ActsExamples::IReader {
+ public:
+  DummyReader(size_t nEvents, size_t failingEvent = kNoEvent)
+      : m_nEvents(nEvents), m_failingEvent(failingEvent) {}
+
+  std::string name() const final override { return "DummyReader"; }
+
+  std::pair<size_t, size_t> availableEvents() const final override {
+    return {0u, m_nEvents};
+  }
+
+  ProcessCode read(const AlgorithmContext& context) final override {
+    ++numRead;
+    if (context.eventNumber == m_failingEvent) {
+      return ProcessCode::ABORT;
+    }
+    context.eventStore.add("event", size_t(context.eventNumber));
+    return ProcessCode::SUCCESS;
+  }
+
+  /// The number of read calls, including the failing one
+  std::atomic<size_t> numRead{0};
+
+ private:
+  size_t m_nEvents;
+  size_t m_failingEvent;
+};
+
+/// Records the processed events and checks the stored event number.
+class DummyAlgorithm final : public ActsExamples::BareAlgorithm {
+ public:
+  /// @param failingEvent Event for which the execution fails
+  /// @param failAfterReads Number of reads to wait for before failing
+  DummyAlgorithm(const DummyReader& reader, size_t failingEvent = kNoEvent,
+                 size_t failAfterReads = 0u)
+      : ActsExamples::BareAlgorithm("DummyAlgorithm", Acts::Logging::WARNING),
+        m_reader(reader),
+        m_failingEvent(failingEvent),
+        m_failAfterReads(failAfterReads) {}
+
+  ProcessCode execute(const AlgorithmContext& context) const final override {
+    if (context.eventNumber == m_failingEvent) {
+      while (m_reader.numRead < m_failAfterReads) {
+        std::this_thread::yield();
+      }
+      // give the reader time to block on the full queue
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      return ProcessCode::ABORT;
+    }
+    if (context.eventStore.get<size_t>("event") != context.eventNumber) {
+      return ProcessCode::ABORT;
+    }
+    std::lock_guard<std::mutex> lock(m_processedMutex);
+    m_processed.push_back(context.eventNumber);
+    return ProcessCode::SUCCESS;
+  }
+
+  std::vector<size_t> processed() const {
+    std::lock_guard<std::mutex> lock(m_processedMutex);
+    auto events = m_processed;
+    std::sort(events.begin(), events.end());
+    return events;
+  }
+
+ private:
+  const DummyReader& m_reader;
+  size_t m_failingEvent;
+  size_t m_failAfterReads;
+  mutable std::mutex m_processedMutex;
+  mutable std::vector<size_t> m_processed;
+};
+
+Sequencer::Config makeConfig(size_t prefetchEvents, int numThreads) {
+  Sequencer::Config cfg;
+  cfg.logLevel = Acts::Logging::WARNING;
+  cfg.numThreads = numThreads;
+  cfg.prefetchEvents = prefetchEvents;
+  return cfg;
+}
+
+bool isReadFailure(const std::runtime_error& e) {
+  return std::string(e.what()) == "Failed to read input data";
+}
+
+bool isProcessFailure(const std::runtime_error& e) {
+  return std::string(e.what()) == "Failed to process event data";
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesSequencer)
+
+BOOST_AUTO_TEST_CASE(RunToCompletion, *boost::unit_test::timeout(60)) {
+  const size_t nEvents = 20u;
+  std::vector<size_t> expected(nEvents);
+  for (size_t i = 0; i < nEvents; ++i) {
+    expected[i] = i;
+  }
+
+  for (size_t prefetchEvents : {0u, 1u, 4u}) {
+    BOOST_TEST_CONTEXT("Prefetch " << prefetchEvents << " events") {
+      auto reader = std::make_shared<DummyReader>(nEvents);
+      auto algorithm = std::make_shared<DummyAlgorithm>(*reader);
+      Sequencer sequencer(makeConfig(prefetchEvents, 3));
+      sequencer.addReader(reader);
+      sequencer.addAlgorithm(algorithm);
+
+      BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+      BOOST_CHECK_EQUAL(reader->numRead.load(), nEvents);
+      BOOST_CHECK(algorithm->processed() == expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchReaderFailure, *boost::unit_test::timeout(60)) {
+  for (int numThreads : {1, 3}) {
+    BOOST_TEST_CONTEXT(numThreads << " threads") {
+      auto reader = std::make_shared<DummyReader>(20u, 7u);
+      auto algorithm = std::make_shared<DummyAlgorithm>(*reader);
+      Sequencer sequencer(makeConfig(2u, numThreads));
+      sequencer.addReader(reader);
+      sequencer.addAlgorithm(algorithm);
+
+      // the reader stops at the failing event and run does not wait for
+      // the events that are never read
+      BOOST_CHECK_EXCEPTION(sequencer.run(), std::runtime_error,
+                            isReadFailure);
+      BOOST_CHECK_EQUAL(reader->numRead.load(), 8u);
+      BOOST_CHECK_LE(algorithm->processed().size(), 7u);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchAlgorithmFailure,
+                     *boost::unit_test::timeout(60)) {
+  // with a single worker and a single queue slot, the reader has read the
+  // processed event, the queued one, and blocks on pushing the third
+  auto reader = std::make_shared<DummyReader>(20u);
+  auto algorithm = std::make_shared<DummyAlgorithm>(*reader, 0u, 3u);
+  Sequencer sequencer(makeConfig(1u, 1));
+  sequencer.addReader(reader);
+  sequencer.addAlgorithm(algorithm);
+
+  // the blocked reader is released and run returns with the error
+  BOOST_CHECK_EXCEPTION(sequencer.run(), std::runtime_error, isProcessFailure);
+  BOOST_CHECK_LT(reader->numRead.load(), 20u);
+  BOOST_CHECK(algorithm->processed().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ActsExamples::WhiteBoard;
+
+namespace {
+
+/// A movable type that can not be emptied for reuse
+struct Opaque {
+  int value = 0;
+};
+
+/// A movable type that can be emptied, but not be move-assigned
+struct Fixed {
+  const int value;
+  std::vector<int> numbers;
+
+  Fixed(int v) : value(v) {}
+  void clear() { numbers.clear(); }
+};
+
+std::vector<int> makeNumbers(size_t n) {
+  std::vector<int> numbers(n);
+  for (size_t i = 0; i < n; ++i) {
+    numbers[i] = i;
+  }
+  return numbers;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesWhiteBoard)
+
+BOOST_AUTO_TEST_CASE(AddGet) {
+  WhiteBoard store;
+  store.add("numbers", makeNumbers(3u));
+  BOOST_CHECK(store.get<std::vector<int>>("numbers") == makeNumbers(3u));
+  BOOST_CHECK_THROW(store.add("", makeNumbers(1u)), std::invalid_argument);
+  BOOST_CHECK_THROW(store.add("numbers", makeNumbers(1u)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(store.get<std::vector<int>>("missing"), std::out_of_range);
+  BOOST_CHECK_THROW(store.get<std::vector<double>>("numbers"),
+                    std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(KeptObjectIsNotStored) {
+  WhiteBoard store;
+  store.add("numbers", makeNumbers(3u));
+  store.clear({"numbers"});
+  // the object is only kept for reuse, but no longer readable
+  BOOST_CHECK_THROW(store.get<std::vector<int>>("numbers"), std::out_of_range);
+  // and it is emptied
+  BOOST_CHECK(store.recycled<std::vector<int>>("numbers").empty());
+}
+
+BOOST_AUTO_TEST_CASE(RecycledKeepsCapacity) {
+  WhiteBoard store;
+  store.add("numbers", makeNumbers(100u));
+  store.clear({"numbers"});
+
+  auto numbers = store.recycled<std::vector<int>>("numbers");
+  BOOST_CHECK(numbers.empty());
+  BOOST_CHECK_GE(numbers.capacity(), 100u);
+  // the kept object can only be taken once
+  BOOST_CHECK_EQUAL(store.recycled<std::vector<int>>("numbers").capacity(),
+                    0u);
+}
+
+BOOST_AUTO_TEST_CASE(RecycledTypeMismatch) {
+  WhiteBoard store;
+  store.add("numbers", makeNumbers(100u));
+  store.clear({"numbers"});
+
+  auto other = store.recycled<std::vector<double>>("numbers");
+  BOOST_CHECK(other.empty());
+  BOOST_CHECK_EQUAL(other.capacity(), 0u);
+  BOOST_CHECK_EQUAL(store.recycled<std::string>("numbers"), std::string());
+  BOOST_CHECK(store.recycled<std::vector<int>>("missing").empty());
+  // a mismatched request leaves the kept object untouched
+  BOOST_CHECK_GE(store.recycled<std::vector<int>>("numbers").capacity(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(ReAddReusable) {
+  WhiteBoard store;
+  store.add("numbers", makeNumbers(3u));
+  const auto* stored = &store.get<std::vector<int>>("numbers");
+
+  for (size_t event = 0; event < 3u; ++event) {
+    store.clear({"numbers"});
+    auto numbers = store.recycled<std::vector<int>>("numbers");
+    numbers = makeNumbers(5u + event);
+    store.add("numbers", std::move(numbers));
+    // the holder of the previous event is reused
+    BOOST_CHECK_EQUAL(&store.get<std::vector<int>>("numbers"), stored);
+    BOOST_CHECK(store.get<std::vector<int>>("numbers") ==
+                makeNumbers(5u + event));
+    BOOST_CHECK_THROW(store.add("numbers", makeNumbers(1u)),
+                      std::invalid_argument);
+  }
+
+  // a kept object can be replaced by an object of another type
+  store.clear({"numbers"});
+  store.add("numbers", std::vector<double>{1., 2.});
+  BOOST_CHECK_THROW(store.get<std::vector<int>>("numbers"), std::out_of_range);
+  BOOST_CHECK_EQUAL(store.get<std::vector<double>>("numbers").size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(ClearDropsObjects) {
+  WhiteBoard store;
+  store.add("opaque", Opaque{3});
+  store.add("kept", makeNumbers(10u));
+  store.add("dropped", makeNumbers(10u));
+  store.clear({"opaque", "kept"});
+
+  // objects without clear() can not be kept
+  BOOST_CHECK_THROW(store.get<Opaque>("opaque"), std::out_of_range);
+  BOOST_CHECK_EQUAL(store.recycled<Opaque>("opaque").value, 0);
+  // objects that are not requested are not kept
+  BOOST_CHECK_EQUAL(store.recycled<std::vector<int>>("dropped").capacity(),
+                    0u);
+  BOOST_CHECK_GE(store.recycled<std::vector<int>>("kept").capacity(), 10u);
+
+  // all names can be used again
+  store.add("opaque", Opaque{4});
+  store.add("kept", makeNumbers(1u));
+  store.add("dropped", makeNumbers(1u));
+  BOOST_CHECK_EQUAL(store.get<Opaque>("opaque").value, 4);
+
+  // clearing without reusable objects drops everything
+  store.clear();
+  BOOST_CHECK(store.recycled<std::vector<int>>("kept").empty());
+  BOOST_CHECK_EQUAL(store.recycled<std::vector<int>>("kept").capacity(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(NotMoveAssignable) {
+  WhiteBoard store;
+  store.add("fixed", Fixed(1));
+  // objects that can not be move-assigned are not kept
+  store.clear({"fixed"});
+  BOOST_CHECK_THROW(store.get<Fixed>("fixed"), std::out_of_range);
+  store.add("fixed", Fixed(2));
+  BOOST_CHECK_EQUAL(store.get<Fixed>("fixed").value, 2);
+
+  // and can replace a kept object of another type
+  store.add("numbers", makeNumbers(3u));
+  store.clear({"numbers"});
+  store.add("numbers", Fixed(3));
+  BOOST_CHECK_EQUAL(store.get<Fixed>("numbers").value, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
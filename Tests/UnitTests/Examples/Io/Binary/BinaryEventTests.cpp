@@ -0,0 +1,296 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/IndexContainers.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimIdentifier.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFile.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using ActsExamples::BinaryEventReader;
+using ActsExamples::BinaryEventWriter;
+using ActsExamples::ProcessCode;
+
+namespace {
+
+Acts::GeometryContext tgContext = Acts::GeometryContext();
+
+using Clusters = ActsExamples::GeometryIdMultimap<Acts::PlanarModuleCluster>;
+
+/// The content of a single event
+struct Event {
+  ActsExamples::SimParticleContainer particles;
+  ActsExamples::SimHitContainer simHits;
+  Clusters clusters;
+};
+
+/// An event with a number of entries that depends on the event number.
+///
+/// Every module gets one simulated hit per particle, the clusters on a module
+/// refer to all its simulated hits.
+Event makeEvent(size_t eventNumber,
+                const std::vector<const Acts::Surface*>& modules) {
+  Event event;
+  const size_t nParticles = 1u + eventNumber % 3u;
+  for (size_t i = 0; i < nParticles; ++i) {
+    ActsFatras::Particle particle(
+        ActsFatras::Barcode().setVertexPrimary(1u).setParticle(1u + i),
+        (i % 2u == 0u) ? Acts::PdgParticle::eMuon : Acts::PdgParticle::ePionPlus,
+        (i % 2u == 0u) ? -1_e : 1_e, (i % 2u == 0u) ? 105_MeV : 140_MeV);
+    particle.setProcess(static_cast<ActsFatras::ProcessType>(i));
+    particle.setPosition4(0.1_mm * i, -0.2_mm, 10_mm * eventNumber, 1_ns * i);
+    particle.setDirection(1., 0.5 * i, -0.25);
+    particle.setAbsMomentum(1_GeV + 0.5_GeV * eventNumber);
+    event.particles.insert(std::move(particle));
+  }
+
+  const size_t nModules = 1u + eventNumber % modules.size();
+  for (size_t m = 0; m < nModules; ++m) {
+    const Acts::Surface& surface = *modules[m];
+    for (const auto& particle : event.particles) {
+      ActsFatras::Hit::Vector4 pos4(10_mm * m, 1_mm * eventNumber,
+                                    particle.position4()[2], 1_ns * m);
+      ActsFatras::Hit::Vector4 before4(1_GeV, 0.5_GeV, 0., 1.5_GeV);
+      ActsFatras::Hit::Vector4 after4(0.9_GeV, 0.5_GeV, 0.1_GeV, 1.4_GeV);
+      event.simHits.emplace_hint(event.simHits.end(), surface.geometryId(),
+                                 particle.particleId(), pos4, before4, after4,
+                                 m);
+    }
+  }
+
+  // the simulated hit indices are the positions in the ordered container
+  for (size_t m = 0; m < nModules; ++m) {
+    const Acts::Surface& surface = *modules[m];
+    std::vector<size_t> simHitIndices;
+    for (size_t i = 0; i < event.simHits.size(); ++i) {
+      if (event.simHits.nth(i)->geometryId() == surface.geometryId()) {
+        simHitIndices.push_back(i);
+      }
+    }
+    Acts::ActsSymMatrixD<3> cov;
+    cov << 0.01 * (m + 1), 0.001, 0., 0.001, 0.04, 0., 0., 0., 1.;
+    std::vector<Acts::DigitizationCell> cells;
+    for (size_t c = 0; c <= m % 3u; ++c) {
+      cells.emplace_back(c + m, 2u * c + eventNumber, 0.5f + c);
+    }
+    Acts::PlanarModuleCluster cluster(
+        surface.getSharedPtr(),
+        Identifier(identifier_type(surface.geometryId().value()),
+                   std::move(simHitIndices)),
+        std::move(cov), 0.1_mm * m, -0.2_mm * eventNumber, 1_ns, cells);
+    event.clusters.emplace_hint(event.clusters.end(), surface.geometryId(),
+                                std::move(cluster));
+  }
+  return event;
+}
+
+void checkParticles(const ActsExamples::SimParticleContainer& read,
+                    const ActsExamples::SimParticleContainer& written) {
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  auto it = read.begin();
+  for (const auto& particle : written) {
+    BOOST_CHECK_EQUAL(it->particleId(), particle.particleId());
+    BOOST_CHECK_EQUAL(it->pdg(), particle.pdg());
+    BOOST_CHECK(it->process() == particle.process());
+    BOOST_CHECK_EQUAL(it->charge(), particle.charge());
+    BOOST_CHECK_EQUAL(it->mass(), particle.mass());
+    BOOST_CHECK_EQUAL(it->position4(), particle.position4());
+    BOOST_CHECK_EQUAL(it->unitDirection(), particle.unitDirection());
+    BOOST_CHECK_EQUAL(it->absMomentum(), particle.absMomentum());
+    ++it;
+  }
+}
+
+void checkSimHits(const ActsExamples::SimHitContainer& read,
+                  const ActsExamples::SimHitContainer& written) {
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  auto it = read.begin();
+  for (const auto& simHit : written) {
+    BOOST_CHECK_EQUAL(it->geometryId(), simHit.geometryId());
+    BOOST_CHECK_EQUAL(it->particleId(), simHit.particleId());
+    BOOST_CHECK_EQUAL(it->index(), simHit.index());
+    BOOST_CHECK_EQUAL(it->position4(), simHit.position4());
+    BOOST_CHECK_EQUAL(it->momentum4Before(), simHit.momentum4Before());
+    BOOST_CHECK_EQUAL(it->momentum4After(), simHit.momentum4After());
+    ++it;
+  }
+}
+
+void checkClusters(const Clusters& read, const Clusters& written) {
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  auto it = read.begin();
+  for (const auto& [geoId, cluster] : written) {
+    const auto& readCluster = it->second;
+    BOOST_CHECK_EQUAL(it->first, geoId);
+    BOOST_CHECK_EQUAL(&readCluster.referenceObject(),
+                      &cluster.referenceObject());
+    BOOST_CHECK_EQUAL(readCluster.sourceLink().value(),
+                      cluster.sourceLink().value());
+    BOOST_CHECK(readCluster.sourceLink().indices() ==
+                cluster.sourceLink().indices());
+    BOOST_CHECK_EQUAL(readCluster.parameters(), cluster.parameters());
+    BOOST_CHECK_EQUAL(readCluster.covariance(), cluster.covariance());
+    const auto& readCells = readCluster.digitizationCells();
+    const auto& cells = cluster.digitizationCells();
+    BOOST_REQUIRE_EQUAL(readCells.size(), cells.size());
+    for (size_t c = 0; c < cells.size(); ++c) {
+      BOOST_CHECK_EQUAL(readCells[c].channel0, cells[c].channel0);
+      BOOST_CHECK_EQUAL(readCells[c].channel1, cells[c].channel1);
+      BOOST_CHECK_EQUAL(readCells[c].data, cells[c].data);
+    }
+    ++it;
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBinaryEvent)
+
+BOOST_AUTO_TEST_CASE(WriterReaderRoundTrip) {
+  const std::string fileName = "BinaryEventTests_events.actsevt";
+
+  Acts::Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  std::shared_ptr<const Acts::TrackingGeometry> geometry = cGeometry();
+  std::vector<const Acts::Surface*> modules;
+  geometry->visitSurfaces([&](const Acts::Surface* surface) {
+    if (surface->geometryId().sensitive() != 0u and modules.size() < 5u) {
+      modules.push_back(surface);
+    }
+  });
+  BOOST_REQUIRE_EQUAL(modules.size(), 5u);
+
+  // Events are written out of order and event 3 is missing
+  const std::vector<size_t> eventNumbers = {4u, 1u, 6u, 0u, 2u, 5u};
+  std::vector<Event> events(7u);
+  {
+    BinaryEventWriter::Config cfg;
+    cfg.inputParticles = "particles";
+    cfg.inputSimulatedHits = "simhits";
+    cfg.inputClusters = "clusters";
+    cfg.filePath = fileName;
+    BinaryEventWriter writer(cfg, Acts::Logging::WARNING);
+    for (auto eventNumber : eventNumbers) {
+      events[eventNumber] = makeEvent(eventNumber, modules);
+      ActsExamples::WhiteBoard store;
+      store.add("particles", ActsExamples::SimParticleContainer(
+                                 events[eventNumber].particles));
+      store.add("simhits",
+                ActsExamples::SimHitContainer(events[eventNumber].simHits));
+      store.add("clusters", Clusters(events[eventNumber].clusters));
+      ActsExamples::AlgorithmContext ctx(0, eventNumber, store);
+      BOOST_CHECK(writer.write(ctx) == ProcessCode::SUCCESS);
+    }
+    BOOST_CHECK(writer.endRun() == ProcessCode::SUCCESS);
+  }
+
+  // The index is sorted by event number and skips the missing event
+  ActsExamples::BinaryEventFile file(fileName);
+  BOOST_CHECK_EQUAL(file.size(), eventNumbers.size());
+  BOOST_CHECK_EQUAL(file.availableEvents().first, 0u);
+  BOOST_CHECK_EQUAL(file.availableEvents().second, 7u);
+  for (auto eventNumber : eventNumbers) {
+    auto view = file.event(eventNumber);
+    BOOST_CHECK_EQUAL(view.eventNumber, eventNumber);
+    BOOST_CHECK_EQUAL(view.particles.size(),
+                      events[eventNumber].particles.size());
+    BOOST_CHECK_EQUAL(view.simHits.size(), events[eventNumber].simHits.size());
+    BOOST_CHECK_EQUAL(view.hits.size(), events[eventNumber].clusters.size());
+  }
+  BOOST_CHECK_THROW(file.event(3u), std::out_of_range);
+  BOOST_CHECK_THROW(file.event(7u), std::out_of_range);
+
+  BinaryEventReader::Config cfg;
+  cfg.filePath = fileName;
+  cfg.outputParticles = "particles";
+  cfg.outputSimulatedHits = "simhits";
+  cfg.outputClusters = "clusters";
+  cfg.outputHitIds = "hitids";
+  cfg.outputHitParticlesMap = "hitparticles";
+  cfg.trackingGeometry = geometry;
+  BinaryEventReader reader(cfg, Acts::Logging::WARNING);
+  BOOST_CHECK(reader.availableEvents() == file.availableEvents());
+
+  // Read back in yet another order
+  std::vector<size_t> readOrder = eventNumbers;
+  std::sort(readOrder.begin(), readOrder.end());
+  std::reverse(readOrder.begin(), readOrder.end());
+  for (auto eventNumber : readOrder) {
+    BOOST_TEST_CONTEXT("Event " << eventNumber) {
+      const auto& event = events[eventNumber];
+      ActsExamples::WhiteBoard store;
+      ActsExamples::AlgorithmContext ctx(0, eventNumber, store);
+      BOOST_REQUIRE(reader.read(ctx) == ProcessCode::SUCCESS);
+
+      checkParticles(
+          store.get<ActsExamples::SimParticleContainer>("particles"),
+          event.particles);
+      checkSimHits(store.get<ActsExamples::SimHitContainer>("simhits"),
+                   event.simHits);
+      checkClusters(store.get<Clusters>("clusters"), event.clusters);
+
+      // The hits are numbered in container order
+      const auto& hitIds = store.get<std::vector<uint64_t>>("hitids");
+      BOOST_REQUIRE_EQUAL(hitIds.size(), event.clusters.size());
+      for (size_t i = 0; i < hitIds.size(); ++i) {
+        BOOST_CHECK_EQUAL(hitIds[i], i);
+      }
+
+      // Every hit is mapped to the particles of its simulated hits
+      const auto& hitParticles =
+          store.get<ActsExamples::IndexMultimap<ActsFatras::Barcode>>(
+              "hitparticles");
+      size_t hitIndex = 0;
+      size_t nEntries = 0;
+      for (const auto& [geoId, cluster] : event.clusters) {
+        auto particles = hitParticles.equal_range(hitIndex);
+        const auto& indices = cluster.sourceLink().indices();
+        BOOST_REQUIRE_EQUAL(std::distance(particles.first, particles.second),
+                            indices.size());
+        auto it = particles.first;
+        for (auto index : indices) {
+          BOOST_CHECK_EQUAL(it->second,
+                            event.simHits.nth(index)->particleId());
+          ++it;
+        }
+        nEntries += indices.size();
+        ++hitIndex;
+      }
+      BOOST_CHECK_EQUAL(hitParticles.size(), nEntries);
+    }
+  }
+
+  // A missing event aborts the reading
+  ActsExamples::WhiteBoard store;
+  ActsExamples::AlgorithmContext ctx(0, 3u, store);
+  BOOST_CHECK(reader.read(ctx) == ProcessCode::ABORT);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,260 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/CuboidVolumeBuilder.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometryBuilder.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
+#include "Acts/Plugins/Identification/IdentifiedDetectorElement.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryValidation.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryWriter.hpp"
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace Acts::UnitLiterals;
+
+Acts::GeometryContext tgContext = Acts::GeometryContext();
+
+/// Identified planar detector element with a digitization module
+class IdentifiedElement final : public Acts::IdentifiedDetectorElement {
+ public:
+  IdentifiedElement(
+      const Acts::Transform3D& transform,
+      std::shared_ptr<const Acts::RectangleBounds> bounds, double thickness,
+      Identifier identifier,
+      std::shared_ptr<const Acts::DigitizationModule> digitizationModule)
+      : m_transform(transform),
+        m_thickness(thickness),
+        m_identifier(std::move(identifier)),
+        m_digitizationModule(std::move(digitizationModule)) {
+    m_surface =
+        Acts::Surface::makeShared<Acts::PlaneSurface>(std::move(bounds), *this);
+  }
+
+  const Acts::Transform3D& transform(
+      const Acts::GeometryContext& /*gctx*/) const final {
+    return m_transform;
+  }
+  const Acts::Surface& surface() const final { return *m_surface; }
+  double thickness() const final { return m_thickness; }
+  Identifier identifier() const final { return m_identifier; }
+  const std::shared_ptr<const Acts::DigitizationModule> digitizationModule()
+      const final {
+    return m_digitizationModule;
+  }
+
+ private:
+  Acts::Transform3D m_transform;
+  double m_thickness;
+  Identifier m_identifier;
+  std::shared_ptr<const Acts::DigitizationModule> m_digitizationModule;
+  std::shared_ptr<const Acts::Surface> m_surface;
+};
+
+/// Telescope of identified pixel planes along the global x axis
+std::shared_ptr<const Acts::TrackingGeometry> makeTelescope(
+    std::vector<std::unique_ptr<IdentifiedElement>>& elements) {
+  auto bounds = std::make_shared<const Acts::RectangleBounds>(10_mm, 20_mm);
+  // one module is shared by all planes, the other one has a lorentz angle and
+  // the opposite readout direction
+  std::vector<std::shared_ptr<const Acts::DigitizationModule>> modules = {
+      std::make_shared<const Acts::DigitizationModule>(
+          std::make_shared<const Acts::CartesianSegmentation>(bounds, 400u,
+                                                              800u),
+          0.15_mm, 1, 0., 0.),
+      std::make_shared<const Acts::DigitizationModule>(
+          std::make_shared<const Acts::CartesianSegmentation>(bounds, 200u,
+                                                              160u),
+          0.125_mm, -1, 0.0324, 0.01, true)};
+
+  Acts::RotationMatrix3D rotation;
+  rotation.col(0) = Acts::Vector3D(0., 1., 0.);
+  rotation.col(1) = Acts::Vector3D(0., 0., 1.);
+  rotation.col(2) = Acts::Vector3D(1., 0., 0.);
+
+  Acts::CuboidVolumeBuilder::VolumeConfig vConf;
+  vConf.position = {0., 0., 0.};
+  vConf.length = {1_m, 0.2_m, 0.2_m};
+  vConf.name = "Telescope";
+  for (int i = 0; i < 4; ++i) {
+    Acts::CuboidVolumeBuilder::SurfaceConfig sConf;
+    sConf.position = {-300_mm + i * 200_mm, 0., 0.};
+    sConf.rotation = rotation;
+    sConf.rBounds = bounds;
+    // the builder bins the layers within 1um around the plane
+    sConf.thickness = 1_um;
+    sConf.detElementConstructor =
+        [&, i](const Acts::Transform3D& transform,
+               std::shared_ptr<const Acts::RectangleBounds> rBounds,
+               double thickness) {
+          elements.push_back(std::make_unique<IdentifiedElement>(
+              transform, std::move(rBounds), thickness,
+              Identifier(identifier_type(100u + i)), modules[i % 2]));
+          return elements.back().get();
+        };
+    Acts::CuboidVolumeBuilder::LayerConfig lConf;
+    lConf.surfaceCfg = sConf;
+    vConf.layerCfg.push_back(lConf);
+  }
+
+  Acts::CuboidVolumeBuilder::Config conf;
+  conf.position = {0., 0., 0.};
+  conf.length = {1_m, 0.2_m, 0.2_m};
+  conf.volumeCfg = {vConf};
+  Acts::CuboidVolumeBuilder cvb(conf);
+
+  Acts::TrackingGeometryBuilder::Config tgbCfg;
+  tgbCfg.trackingVolumeBuilders.push_back(
+      [=](const auto& context, const auto& inner, const auto& vb) {
+        return cvb.trackingVolume(context, inner, vb);
+      });
+  return Acts::TrackingGeometryBuilder(tgbCfg).trackingGeometry(tgContext);
+}
+
+/// The identified detector elements of the geometry by geometry identifier
+std::map<Acts::GeometryID, const Acts::IdentifiedDetectorElement*>
+identifiedElements(const Acts::TrackingGeometry& geometry) {
+  std::map<Acts::GeometryID, const Acts::IdentifiedDetectorElement*> elements;
+  geometry.visitSurfaces([&](const Acts::Surface* surface) {
+    const auto* element = dynamic_cast<const Acts::IdentifiedDetectorElement*>(
+        surface->associatedDetectorElement());
+    if (element != nullptr) {
+      elements.emplace(surface->geometryId(), element);
+    }
+  });
+  return elements;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBinaryGeometry)
+
+BOOST_AUTO_TEST_CASE(WriteReadNavigateRoundTrip) {
+  const std::string fileName = "BinaryGeometryTests.actsgeo";
+
+  Acts::Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  std::shared_ptr<const Acts::TrackingGeometry> geometry = cGeometry();
+
+  ActsExamples::BinaryGeometryWriter::Config writerCfg;
+  writerCfg.fileName = fileName;
+  ActsExamples::BinaryGeometryWriter(writerCfg).write(*geometry);
+
+  ActsExamples::BinaryGeometryReader::Config readerCfg;
+  readerCfg.fileName = fileName;
+  auto restored = ActsExamples::BinaryGeometryReader(readerCfg).read();
+  BOOST_REQUIRE(restored != nullptr);
+
+  // The sensitive and material surfaces crossed by straight lines agree
+  auto logger =
+      Acts::getDefaultLogger("BinaryGeometryTests", Acts::Logging::INFO);
+  size_t nMismatches = ActsExamples::compareNavigation(
+      geometry, restored, 40, 32, Acts::LoggerWrapper(*logger));
+  BOOST_CHECK_EQUAL(nMismatches, 0u);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(WriteReadDigitizeRoundTrip) {
+  const std::string fileName = "BinaryGeometryDigitizationTests.actsgeo";
+
+  std::vector<std::unique_ptr<IdentifiedElement>> elements;
+  auto geometry = makeTelescope(elements);
+
+  ActsExamples::BinaryGeometryWriter::Config writerCfg;
+  writerCfg.fileName = fileName;
+  ActsExamples::BinaryGeometryWriter(writerCfg).write(*geometry);
+
+  ActsExamples::BinaryGeometryReader::Config readerCfg;
+  readerCfg.fileName = fileName;
+  auto restored = ActsExamples::BinaryGeometryReader(readerCfg).read();
+  BOOST_REQUIRE(restored != nullptr);
+  std::remove(fileName.c_str());
+
+  auto original = identifiedElements(*geometry);
+  auto cached = identifiedElements(*restored);
+  BOOST_REQUIRE_EQUAL(original.size(), 4u);
+  BOOST_REQUIRE_EQUAL(cached.size(), original.size());
+
+  // Tracks with different incidence angles through every plane give the same
+  // digitization steps on the original and on the restored modules
+  Acts::PlanarModuleStepper stepper;
+  const std::vector<Acts::Vector2D> positions = {
+      {0.0123_mm, -0.0457_mm}, {-9.7_mm, 19.2_mm}, {4.56_mm, -13.3_mm}};
+  const std::vector<Acts::Vector3D> directions = {
+      Acts::Vector3D(0., 0., 1.), Acts::Vector3D(0.3, -0.2, 1.).normalized(),
+      Acts::Vector3D(-1.5, 0.7, 1.).normalized()};
+  std::vector<const Acts::DigitizationModule*> cachedModules;
+  for (const auto& [geoId, element] : original) {
+    BOOST_TEST_CONTEXT("Surface " << geoId) {
+      BOOST_REQUIRE_EQUAL(cached.count(geoId), 1u);
+      const auto* restoredElement = cached.at(geoId);
+      BOOST_CHECK_EQUAL(identifier_type(restoredElement->identifier()),
+                        identifier_type(element->identifier()));
+      BOOST_CHECK_EQUAL(restoredElement->thickness(), element->thickness());
+
+      const auto module = element->digitizationModule();
+      const auto restoredModule = restoredElement->digitizationModule();
+      BOOST_REQUIRE(restoredModule != nullptr);
+      cachedModules.push_back(restoredModule.get());
+      BOOST_CHECK_EQUAL(restoredModule->halfThickness(),
+                        module->halfThickness());
+      BOOST_CHECK_EQUAL(restoredModule->readoutDirection(),
+                        module->readoutDirection());
+      BOOST_CHECK_EQUAL(restoredModule->lorentzAngle(), module->lorentzAngle());
+      BOOST_CHECK_EQUAL(restoredModule->energyThreshold(),
+                        module->energyThreshold());
+      BOOST_CHECK_EQUAL(restoredModule->analogue(), module->analogue());
+
+      for (const auto& position : positions) {
+        for (const auto& direction : directions) {
+          auto steps =
+              stepper.cellSteps(tgContext, *module, position, direction);
+          auto restoredSteps = stepper.cellSteps(tgContext, *restoredModule,
+                                                 position, direction);
+          BOOST_REQUIRE(not steps.empty());
+          BOOST_REQUIRE_EQUAL(restoredSteps.size(), steps.size());
+          for (size_t i = 0; i < steps.size(); ++i) {
+            const auto& step = steps[i];
+            const auto& restoredStep = restoredSteps[i];
+            BOOST_CHECK_EQUAL(restoredStep.stepCell.channel0,
+                              step.stepCell.channel0);
+            BOOST_CHECK_EQUAL(restoredStep.stepCell.channel1,
+                              step.stepCell.channel1);
+            CHECK_CLOSE_ABS(restoredStep.stepLength, step.stepLength, 1e-12);
+            CHECK_CLOSE_ABS(restoredStep.stepCellCenter,
+                            step.stepCellCenter, 1e-6);
+          }
+        }
+      }
+    }
+  }
+  // The modules shared by the detector elements are restored only once
+  BOOST_CHECK_EQUAL(cachedModules[0], cachedModules[2]);
+  BOOST_CHECK_EQUAL(cachedModules[1], cachedModules[3]);
+  BOOST_CHECK_NE(cachedModules[0], cachedModules[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
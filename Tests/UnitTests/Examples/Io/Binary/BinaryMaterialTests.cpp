@@ -0,0 +1,198 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryGeometryWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialDecorator.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialWriter.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+using namespace Acts::UnitLiterals;
+using ActsExamples::BinaryMaterialDecorator;
+
+namespace {
+
+Acts::GeometryContext tgContext = Acts::GeometryContext();
+
+/// The complete content of a file
+std::string readFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+/// Material maps with all supported surface material types
+Acts::DetectorMaterialMaps makeMaterialMaps() {
+  Acts::MaterialSlab silicon(Acts::Test::makeSilicon(), 0.5_mm);
+  Acts::MaterialSlab beryllium(Acts::Test::makeBeryllium(), 1_mm);
+  Acts::BinUtility binUtility(4, -1_m, 1_m, Acts::open, Acts::binZ);
+  binUtility += Acts::BinUtility(3, -M_PI, M_PI, Acts::closed, Acts::binPhi);
+  Acts::MaterialSlabMatrix slabs(
+      3, Acts::MaterialSlabVector(4, Acts::MaterialSlab()));
+  for (size_t i = 0; i < slabs.size(); ++i) {
+    for (size_t j = 0; j < slabs[i].size(); ++j) {
+      slabs[i][j] = ((i + j) % 2 == 0) ? silicon : beryllium;
+    }
+  }
+
+  Acts::DetectorMaterialMaps maps;
+  maps.first[Acts::GeometryID().setVolume(1).setLayer(2)] =
+      std::make_shared<Acts::HomogeneousSurfaceMaterial>(silicon, 0.5);
+  maps.first[Acts::GeometryID().setVolume(1).setLayer(4)] =
+      std::make_shared<Acts::BinnedSurfaceMaterial>(binUtility, slabs);
+  maps.first[Acts::GeometryID().setVolume(2).setBoundary(3)] =
+      std::make_shared<Acts::ProtoSurfaceMaterial>(binUtility);
+  return maps;
+}
+
+/// Decorate free surfaces and collect their material again
+Acts::DetectorMaterialMaps decorateSurfaces(
+    const BinaryMaterialDecorator& decorator,
+    const Acts::DetectorMaterialMaps& maps) {
+  Acts::DetectorMaterialMaps decorated;
+  for (const auto& entry : maps.first) {
+    auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+        Acts::Vector3D(0., 0., 0.), Acts::Vector3D(1., 0., 0.));
+    surface->assignGeometryId(entry.first);
+    decorator.decorate(*surface);
+    decorated.first[entry.first] = surface->surfaceMaterialSharedPtr();
+  }
+  return decorated;
+}
+
+/// Write the material maps into a file
+void writeMaterialMaps(const std::string& fileName,
+                       const Acts::DetectorMaterialMaps& maps) {
+  ActsExamples::BinaryMaterialWriter::Config cfg;
+  cfg.fileName = fileName;
+  ActsExamples::BinaryMaterialWriter(cfg).write(maps);
+}
+
+/// Write a tracking geometry into a cache file
+void writeGeometry(const std::string& fileName,
+                   const Acts::TrackingGeometry& geometry) {
+  ActsExamples::BinaryGeometryWriter::Config cfg;
+  cfg.fileName = fileName;
+  ActsExamples::BinaryGeometryWriter(cfg).write(geometry);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBinaryMaterial)
+
+BOOST_AUTO_TEST_CASE(DecoratorWriterRoundTrip) {
+  const std::string fileName = "BinaryMaterialTests_maps.actsmat";
+  auto maps = makeMaterialMaps();
+  writeMaterialMaps(fileName, maps);
+  const std::string written = readFile(fileName);
+
+  for (bool lazy : {false, true}) {
+    BinaryMaterialDecorator::Config cfg;
+    cfg.fileName = fileName;
+    cfg.lazyDecoding = lazy;
+    BinaryMaterialDecorator decorator(cfg);
+    auto decorated = decorateSurfaces(decorator, maps);
+
+    // The decoded material has the type of the written one
+    for (const auto& [geoId, material] : decorated.first) {
+      BOOST_REQUIRE(material != nullptr);
+      const auto& decoded = material->concreteMaterial();
+      const auto& original = *maps.first.at(geoId);
+      BOOST_CHECK(typeid(decoded) == typeid(original));
+      BOOST_CHECK_EQUAL((&decoded == material.get()), not lazy);
+    }
+
+    // Writing the decorated material reproduces the file
+    const std::string rewrittenName =
+        std::string("BinaryMaterialTests_rewritten") + (lazy ? "_lazy" : "") +
+        ".actsmat";
+    writeMaterialMaps(rewrittenName, decorated);
+    BOOST_CHECK(readFile(rewrittenName) == written);
+    std::remove(rewrittenName.c_str());
+  }
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(DecoratorGeometryCacheRoundTrip) {
+  const std::string materialName = "BinaryMaterialTests_geometry.actsmat";
+  const std::string geometryName = "BinaryMaterialTests_geometry.actsgeo";
+
+  // The material of the test geometry as material maps
+  Acts::Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  auto geometry = cGeometry();
+  Acts::DetectorMaterialMaps maps;
+  geometry->visitSurfaces([&](const Acts::Surface* surface) {
+    if (surface->surfaceMaterial() != nullptr) {
+      maps.first[surface->geometryId()] = surface->surfaceMaterialSharedPtr();
+    }
+  });
+  BOOST_REQUIRE(not maps.first.empty());
+  writeMaterialMaps(materialName, maps);
+  writeGeometry(geometryName, *geometry);
+
+  ActsExamples::BinaryGeometryReader::Config readerCfg;
+  readerCfg.fileName = geometryName;
+  ActsExamples::BinaryGeometryReader reader(readerCfg);
+
+  std::string cached;
+  for (bool lazy : {false, true}) {
+    BinaryMaterialDecorator::Config cfg;
+    cfg.fileName = materialName;
+    cfg.lazyDecoding = lazy;
+    BinaryMaterialDecorator decorator(cfg);
+
+    // The restored geometry is decorated with the material of the maps
+    auto restored = reader.read(&decorator);
+    size_t nMaterial = 0;
+    restored->visitSurfaces([&](const Acts::Surface* surface) {
+      auto it = maps.first.find(surface->geometryId());
+      BOOST_REQUIRE(it != maps.first.end());
+      BOOST_REQUIRE(surface->surfaceMaterial() != nullptr);
+      const auto& decoded = surface->surfaceMaterial()->concreteMaterial();
+      BOOST_CHECK(typeid(decoded) == typeid(*it->second));
+      BOOST_CHECK(decoded.materialSlab(0, 0) == it->second->materialSlab(0, 0));
+      ++nMaterial;
+    });
+    BOOST_CHECK_EQUAL(nMaterial, maps.first.size());
+
+    // The lazily decorated geometry can be cached again
+    const std::string rewrittenName =
+        std::string("BinaryMaterialTests_rewritten") + (lazy ? "_lazy" : "") +
+        ".actsgeo";
+    writeGeometry(rewrittenName, *restored);
+    if (cached.empty()) {
+      cached = readFile(rewrittenName);
+    } else {
+      BOOST_CHECK(readFile(rewrittenName) == cached);
+    }
+    std::remove(rewrittenName.c_str());
+  }
+  std::remove(materialName.c_str());
+  std::remove(geometryName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
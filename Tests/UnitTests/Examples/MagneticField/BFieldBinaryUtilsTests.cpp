@@ -0,0 +1,139 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+#include "ActsExamples/Plugins/BField/BFieldUtils.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+using namespace Acts::UnitLiterals;
+namespace binary = ActsExamples::BField::binary;
+
+namespace {
+
+using Acts::detail::EquidistantAxis;
+using Grid2D =
+    Acts::detail::Grid<Acts::Vector2D, EquidistantAxis, EquidistantAxis>;
+using Grid3D = Acts::detail::Grid<Acts::Vector3D, EquidistantAxis,
+                                  EquidistantAxis, EquidistantAxis>;
+
+/// Compare two grids bin by bin, including the under-/overflow bins
+template <typename grid_t>
+void checkGrids(const grid_t& read, const grid_t& written) {
+  BOOST_CHECK(read.numLocalBins() == written.numLocalBins());
+  BOOST_CHECK(read.minPosition() == written.minPosition());
+  BOOST_CHECK(read.maxPosition() == written.maxPosition());
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  for (size_t bin = 0; bin < written.size(); ++bin) {
+    BOOST_CHECK(read.at(bin) == written.at(bin));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBFieldBinaryUtils)
+
+BOOST_AUTO_TEST_CASE(RoundTripRZ) {
+  const std::string file = "BFieldBinaryUtilsTests_rz.bfmap";
+  Grid2D grid(std::make_tuple(EquidistantAxis(0_m, 1_m, 4),
+                              EquidistantAxis(-2_m, 2_m, 5)));
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    grid.at(bin) = Acts::Vector2D(0.1_T * bin, -0.2_T * bin);
+  }
+  binary::writeFieldMap(file, grid);
+
+  BOOST_CHECK_EQUAL(binary::fieldMapDimension(file), 2u);
+  auto mapper = binary::fieldMapperRZ(file);
+  checkGrids(mapper.getGrid(), grid);
+
+  // The interpolated field is the one of the written grid
+  auto reference = Acts::fieldMapperRZ(grid);
+  for (const auto& pos : {Acts::Vector3D(0.1_m, 0.2_m, -1.5_m),
+                          Acts::Vector3D(-0.3_m, 0.4_m, 0.3_m),
+                          Acts::Vector3D(0., 0.7_m, 1.9_m)}) {
+    BOOST_CHECK(mapper.isInside(pos));
+    BOOST_CHECK(mapper.getField(pos) == reference.getField(pos));
+  }
+
+  // The map can not be read with the wrong dimension
+  BOOST_CHECK_THROW(binary::fieldMapperXYZ(file), std::runtime_error);
+  std::remove(file.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(RoundTripXYZ) {
+  const std::string file = "BFieldBinaryUtilsTests_xyz.bfmap";
+  Grid3D grid(std::make_tuple(EquidistantAxis(-1_m, 1_m, 3),
+                              EquidistantAxis(-1_m, 1_m, 4),
+                              EquidistantAxis(-2_m, 2_m, 5)));
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    grid.at(bin) = Acts::Vector3D(0.1_T * bin, -0.2_T * bin, 0.3_T * bin);
+  }
+  binary::writeFieldMap(file, grid);
+
+  BOOST_CHECK_EQUAL(binary::fieldMapDimension(file), 3u);
+  auto mapper = binary::fieldMapperXYZ(file);
+  checkGrids(mapper.getGrid(), grid);
+
+  // The interpolated field is the one of the written grid
+  auto reference = Acts::fieldMapperXYZ(grid);
+  for (const auto& pos : {Acts::Vector3D(0.1_m, 0.2_m, -1.5_m),
+                          Acts::Vector3D(-0.3_m, 0.4_m, 0.3_m),
+                          Acts::Vector3D(0.9_m, -0.7_m, 1.9_m)}) {
+    BOOST_CHECK(mapper.isInside(pos));
+    BOOST_CHECK(mapper.getField(pos) == reference.getField(pos));
+  }
+
+  // The map can not be read with the wrong dimension
+  BOOST_CHECK_THROW(binary::fieldMapperRZ(file), std::runtime_error);
+  std::remove(file.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidFiles) {
+  const std::string file = "BFieldBinaryUtilsTests_invalid.bfmap";
+  {
+    std::ofstream out(file);
+    out << "this is not a binary field map";
+  }
+  BOOST_CHECK_THROW(binary::fieldMapDimension(file), std::runtime_error);
+  BOOST_CHECK_THROW(binary::fieldMapperRZ(file), std::runtime_error);
+  std::remove(file.c_str());
+
+  // Truncated maps are rejected
+  Grid2D grid(std::make_tuple(EquidistantAxis(0_m, 1_m, 4),
+                              EquidistantAxis(-2_m, 2_m, 5)));
+  binary::writeFieldMap(file, grid);
+  std::string content;
+  {
+    std::ifstream in(file, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size() - sizeof(double));
+  }
+  BOOST_CHECK_THROW(binary::fieldMapDimension(file), std::runtime_error);
+  BOOST_CHECK_THROW(binary::fieldMapperRZ(file), std::runtime_error);
+  std::remove(file.c_str());
+
+  BOOST_CHECK_THROW(binary::fieldMapDimension("does_not_exist.bfmap"),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
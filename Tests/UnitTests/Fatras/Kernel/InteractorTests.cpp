@@ -239,4 +239,31 @@ BOOST_AUTO_TEST_CASE(NoHitsMaterialSurface) {
                   f.interactor.particle.energy(), eps);
 }
 
+BOOST_AUTO_TEST_CASE(HitsInExternalBuffer) {
+  Fixture<EverySurface> f(0.5, makeMaterialSurface());
+
+  // the buffers already contain outputs of a previous particle
+  std::vector<Hit> hits(3u);
+  std::vector<Particle> generated(2u);
+  f.interactor.hits = &hits;
+  f.interactor.hitsBegin = hits.size();
+  f.interactor.generatedParticles = &generated;
+
+  // call interactor twice: outputs are appended to the external buffers
+  f.interactor(f.state, f.stepper, f.result);
+  f.interactor(f.state, f.stepper, f.result);
+  BOOST_CHECK_EQUAL(f.result.generatedParticles.size(), 0u);
+  BOOST_CHECK_EQUAL(f.result.hits.size(), 0u);
+  BOOST_CHECK_EQUAL(generated.size(), 4u);
+  BOOST_CHECK_EQUAL(hits.size(), 5u);
+  // hit index is counted along the current particle trajectory
+  BOOST_CHECK_EQUAL(hits[3].index(), 0u);
+  BOOST_CHECK_EQUAL(hits[4].index(), 1u);
+  BOOST_CHECK_EQUAL(hits[3].particleId(), f.interactor.particle.particleId());
+  BOOST_CHECK_EQUAL(hits[4].particleId(), f.interactor.particle.particleId());
+  // particle energy has changed due to interactions
+  CHECK_CLOSE_REL((f.result.particle.energy() + 1),
+                  f.interactor.particle.energy(), eps);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
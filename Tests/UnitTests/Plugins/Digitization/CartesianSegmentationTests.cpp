@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2019 CERN for the benefit of the Acts project
+// Copyright (C) 2019-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,12 +11,22 @@
 
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
 using namespace Acts::UnitLiterals;
@@ -120,5 +130,163 @@ BOOST_AUTO_TEST_CASE(cartesian_segmentation) {
   CHECK_CLOSE_REL(tAngle, lAngle, 0.001);
 }
 
+/// @brief Unit test for the cell stepping through the Cartesian segmentation
+///
+BOOST_AUTO_TEST_CASE(cartesian_segmentation_cell_steps) {
+  std::vector<DigitizationStep> steps;
+
+  // A perpendicular track stays within a single cell
+  cSegmentation.cellSteps(Vector2D(0.05_mm, 0.05_mm), Vector3D(0., 0., 1.),
+                          hThickness, 1, 0., steps);
+  BOOST_CHECK_EQUAL(steps.size(), 1u);
+  BOOST_CHECK_EQUAL(steps[0].stepCell.channel0, 50u);
+  BOOST_CHECK_EQUAL(steps[0].stepCell.channel1, 100u);
+  CHECK_CLOSE_REL(steps[0].stepLength, 2 * hThickness, 1e-9);
+
+  // An inclined track crosses three cells along x, the buffer is reused
+  Vector3D direction = Vector3D(1., 0., 1.).normalized();
+  cSegmentation.cellSteps(Vector2D(0.05_mm, 0.05_mm), direction, hThickness, 1,
+                          0., steps);
+  BOOST_CHECK_EQUAL(steps.size(), 3u);
+  double totalLength = 0.;
+  for (const auto& step : steps) {
+    BOOST_CHECK_EQUAL(step.stepCell.channel1, 100u);
+    totalLength += step.stepLength;
+  }
+  CHECK_CLOSE_REL(totalLength, 2 * hThickness * std::sqrt(2.), 1e-9);
+  // stepping starts at the readout side, i.e. at positive z
+  BOOST_CHECK_EQUAL(steps.front().stepCell.channel0, 51u);
+  BOOST_CHECK_EQUAL(steps.back().stepCell.channel0, 49u);
+
+  // The lorentz angle changes the cells but not the path length
+  for (int readoutDirection : {-1, 1}) {
+    cSegmentation.cellSteps(Vector2D(0.05_mm, 0.05_mm), direction, hThickness,
+                            readoutDirection, lAngle, steps);
+    BOOST_CHECK(not steps.empty());
+    totalLength = 0.;
+    for (const auto& step : steps) {
+      totalLength += step.stepLength;
+    }
+    CHECK_CLOSE_REL(totalLength, 2 * hThickness * std::sqrt(2.), 1e-9);
+  }
+}
+
+/// The steps of the surface based stepping, i.e. the track is intersected with
+/// the boundary surfaces of the module and stepped through the segmentation
+/// surfaces between the closest boundary intersections on both sides of the
+/// start position, which has to be within the sensitive volume
+std::vector<DigitizationStep> surfaceCellSteps(
+    const PlanarModuleStepper& stepper, const DigitizationModule& dModule,
+    const Vector2D& position, const Vector3D& direction) {
+  const Vector3D start(position.x(), position.y(), 0.);
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  Intersection3D entry(start, -inf, Intersection3D::Status::missed);
+  Intersection3D exit(start, inf, Intersection3D::Status::missed);
+  for (const auto& bSurface : dModule.boundarySurfaces()) {
+    auto bIntersection = bSurface->intersect(tgContext, start, direction, true);
+    if (not bIntersection) {
+      continue;
+    }
+    const auto& intersection = bIntersection.intersection;
+    if (intersection.pathLength < 0. and
+        intersection.pathLength > entry.pathLength) {
+      entry = intersection;
+    } else if (intersection.pathLength > 0. and
+               intersection.pathLength < exit.pathLength) {
+      exit = intersection;
+    }
+  }
+  if (not entry or not exit) {
+    return {};
+  }
+  return stepper.cellSteps(tgContext, dModule, entry.position, exit.position);
+}
+
+/// The path length per cell
+std::map<std::pair<size_t, size_t>, double> cellLengths(
+    const std::vector<DigitizationStep>& steps) {
+  std::map<std::pair<size_t, size_t>, double> lengths;
+  for (const auto& step : steps) {
+    lengths[{step.stepCell.channel0, step.stepCell.channel1}] +=
+        step.stepLength;
+  }
+  return lengths;
+}
+
+/// @brief Unit test of the analytical cell stepping against the surface based
+/// stepping through the segmentation surfaces
+///
+BOOST_AUTO_TEST_CASE(cartesian_segmentation_cell_steps_surface_stepping) {
+  const double sguardX = 2 * hThickness * std::tan(lAngle);
+  PlanarModuleStepper pmStepper;
+  std::mt19937 rng(2112);
+  std::uniform_real_distribution<double> xDist(-5_mm + sguardX, 5_mm - sguardX);
+  std::uniform_real_distribution<double> yDist(-10_mm, 10_mm);
+  std::uniform_real_distribution<double> edgeDist(0.5 * sguardX, sguardX);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> cosThetaDist(0.2, 1.);
+  std::uniform_int_distribution<int> signDist(0, 1);
+
+  std::vector<DigitizationStep> steps;
+  for (double lorentzAngle : {0., lAngle}) {
+    for (int readoutDirection : {-1, 1}) {
+      auto segmentation = std::make_shared<const CartesianSegmentation>(
+          moduleBounds, nbinsx, nbinsy);
+      DigitizationModule dModule(segmentation, hThickness, readoutDirection,
+                                 lorentzAngle);
+      for (size_t itrack = 0; itrack < 4000; ++itrack) {
+        // every other track starts close to the edges in x, one of them
+        // follows the lorentz angle and is half the guard away from the
+        // module edge in the central plane
+        const double sign = signDist(rng) ? 1. : -1.;
+        Vector2D position(
+            (itrack % 2) ? sign * (5_mm - edgeDist(rng)) : xDist(rng),
+            yDist(rng));
+        const double cosTheta = cosThetaDist(rng);
+        const double sinTheta = std::sqrt(1. - cosTheta * cosTheta);
+        const double phi = phiDist(rng);
+        Vector3D direction(sinTheta * std::cos(phi), sinTheta * std::sin(phi),
+                           (itrack % 3) ? cosTheta : -cosTheta);
+
+        auto reference =
+            surfaceCellSteps(pmStepper, dModule, position, direction);
+        segmentation->cellSteps(position, direction, hThickness,
+                                readoutDirection, lorentzAngle, steps);
+        BOOST_TEST_CONTEXT("Lorentz angle "
+                           << lorentzAngle << ", readout direction "
+                           << readoutDirection << ", track " << itrack
+                           << " at " << position.transpose() << " along "
+                           << direction.transpose()) {
+          BOOST_REQUIRE(not reference.empty());
+          BOOST_REQUIRE(not steps.empty());
+          // same entry and exit of the sensitive volume
+          double totalLength = 0.;
+          double referenceLength = 0.;
+          for (const auto& step : steps) {
+            totalLength += step.stepLength;
+          }
+          for (const auto& step : reference) {
+            referenceLength += step.stepLength;
+          }
+          CHECK_CLOSE_ABS(totalLength, referenceLength, 1e-9);
+          // same path in every cell
+          auto lengths = cellLengths(steps);
+          auto referenceLengths = cellLengths(reference);
+          for (const auto& [cell, length] : referenceLengths) {
+            auto it = lengths.find(cell);
+            CHECK_CLOSE_ABS((it != lengths.end()) ? it->second : 0., length,
+                            1e-9);
+          }
+          for (const auto& [cell, length] : lengths) {
+            if (referenceLengths.count(cell) == 0u) {
+              CHECK_SMALL(length, 1e-9);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -520,5 +520,59 @@ BOOST_AUTO_TEST_CASE(create_Clusters2) {
   }
   CHECK_CLOSE_REL(data9, (nClustersNoTouch * 2) * 2, 1e-5);
 }
+
+/// This test checks a single cluster winding through the whole module, which
+/// is found without any recursion, and the ordering of the clusters and their
+/// cells by increasing global index.
+BOOST_AUTO_TEST_CASE(create_Clusters_serpentine) {
+  size_t nBins0 = 400;
+  size_t nBins1 = 400;
+  std::unordered_map<size_t, std::pair<Acts::DigitizationCell, bool>> testCells;
+  auto addCell = [&](size_t a, size_t b) {
+    testCells.insert(
+        {a + nBins0 * b, {Acts::DigitizationCell(a, b, 1), false}});
+  };
+  // full even rows, connected alternately at the right and the left edge
+  size_t nCells = 0;
+  for (size_t b = 0; b < nBins1; ++b) {
+    if (b % 2 == 0) {
+      for (size_t a = 0; a < nBins0; ++a) {
+        addCell(a, b);
+      }
+      nCells += nBins0;
+    } else {
+      addCell((b % 4 == 1) ? nBins0 - 1 : 0, b);
+      nCells += 1;
+    }
+  }
+  // an isolated cell before the first cell of the serpentine, which is
+  // separated by a gap of two cells
+  testCells.erase(0);
+  testCells.erase(1);
+  addCell(0, 0);
+  nCells -= 1;
+
+  for (bool commonCorner : {true, false}) {
+    for (auto& cell : testCells) {
+      cell.second.second = false;
+    }
+    auto mergedCells = Acts::createClusters<Acts::DigitizationCell>(
+        testCells, nBins0, commonCorner, 0.);
+    BOOST_CHECK_EQUAL(mergedCells.size(), 2u);
+    BOOST_CHECK_EQUAL(mergedCells.at(0).size(), 1u);
+    BOOST_CHECK_EQUAL(mergedCells.at(1).size(), nCells - 1);
+    for (const auto& cells : mergedCells) {
+      BOOST_CHECK(std::is_sorted(
+          cells.begin(), cells.end(), [](const auto& lhs, const auto& rhs) {
+            return std::make_pair(lhs.channel1, lhs.channel0) <
+                   std::make_pair(rhs.channel1, rhs.channel0);
+          }));
+    }
+    // all cells are flagged as used
+    for (const auto& cell : testCells) {
+      BOOST_CHECK(cell.second.second);
+    }
+  }
+}
 }  // namespace Test
 }  // namespace Acts
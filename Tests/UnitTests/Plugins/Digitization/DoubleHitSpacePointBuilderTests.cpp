@@ -15,6 +15,11 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
 
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
@@ -147,5 +152,156 @@ BOOST_DATA_TEST_CASE(DoubleHitsSpacePointBuilder_basic, bdata::xrange(1),
   BOOST_CHECK_EQUAL(resultSP.size(), 1u);
 }
 
+using ClusterPairs = std::vector<
+    std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>;
+
+/// The pairing which tests all combinations, as it was done before the back
+/// clusters were sorted in phi. The limits are passed in the same order.
+ClusterPairs makeClusterPairsReference(
+    const DoubleHitSpacePointConfig& cfg,
+    const std::vector<const PlanarModuleCluster*>& clustersFront,
+    const std::vector<const PlanarModuleCluster*>& clustersBack) {
+  auto globalCoords = [](const PlanarModuleCluster& cluster) {
+    const auto& par = cluster.parameters();
+    Vector2D local(par[eBoundLoc0], par[eBoundLoc1]);
+    return cluster.referenceObject().localToGlobal(tgContext, local,
+                                                   Vector3D(1., 1., 1.));
+  };
+  auto difference = [&](const Vector3D& pos1, const Vector3D& pos2) {
+    if ((pos1 - pos2).norm() > cfg.diffDist) {
+      return -1.;
+    }
+    double diffTheta = VectorHelpers::theta(pos1 - cfg.vertex) -
+                       VectorHelpers::theta(pos2 - cfg.vertex);
+    if (diffTheta * diffTheta > cfg.diffPhi2) {
+      return -1.;
+    }
+    double diffPhi = VectorHelpers::phi(pos1 - cfg.vertex) -
+                     VectorHelpers::phi(pos2 - cfg.vertex);
+    if (diffPhi * diffPhi > cfg.diffTheta2) {
+      return -1.;
+    }
+    return diffTheta * diffTheta + diffPhi * diffPhi;
+  };
+  ClusterPairs clusterPairs;
+  for (const auto* front : clustersFront) {
+    double diffMin = std::numeric_limits<double>::max();
+    size_t clusterMinDist = clustersBack.size();
+    for (size_t iBack = 0; iBack < clustersBack.size(); ++iBack) {
+      double currentDiff =
+          difference(globalCoords(*front), globalCoords(*clustersBack[iBack]));
+      if (currentDiff < diffMin && currentDiff >= 0.) {
+        diffMin = currentDiff;
+        clusterMinDist = iBack;
+      }
+    }
+    if (clusterMinDist < clustersBack.size()) {
+      clusterPairs.emplace_back(front, clustersBack[clusterMinDist]);
+    }
+  }
+  return clusterPairs;
+}
+
+/// A strip module with the given stereo angle, at the given radius on the x
+/// axis with the strips along the z axis.
+Transform3D stripModuleTransform(double radius, double stereo) {
+  RotationMatrix3D rotation;
+  rotation.col(0) = Vector3D(0., std::cos(stereo), std::sin(stereo));
+  rotation.col(1) = Vector3D(0., -std::sin(stereo), std::cos(stereo));
+  rotation.col(2) = Vector3D(1., 0., 0.);
+  Transform3D transform(rotation);
+  transform.translation() = Vector3D(radius, 0., 0.);
+  return transform;
+}
+
+/// Unit test for the cluster pairing on a strip module pair: the pairs found
+/// within the phi window of the sorted back clusters have to be the same as
+/// the ones found by testing all combinations.
+BOOST_DATA_TEST_CASE(DoubleHitsSpacePointBuilder_pairing,
+                     bdata::make({1u, 10u, 50u, 200u}), nTracks) {
+  std::mt19937 rng(42);
+
+  constexpr size_t nStrips = 768;
+  constexpr double pitch = 80_um;
+  constexpr double halfX = 0.5 * nStrips * pitch;
+  constexpr double halfY = 25_mm;
+  constexpr double radiusFront = 300_mm;
+  constexpr double radiusBack = 302_mm;
+  auto bounds = std::make_shared<const RectangleBounds>(halfX, halfY);
+  auto segmentation =
+      std::make_shared<const CartesianSegmentation>(bounds, nStrips);
+  const DigitizationModule digMod(segmentation, 0.15_mm, 1, 0.);
+  DetectorElementStub elementFront(stripModuleTransform(radiusFront, 20e-3));
+  DetectorElementStub elementBack(stripModuleTransform(radiusBack, -20e-3));
+  auto surfaceFront = Surface::makeShared<PlaneSurface>(bounds, elementFront);
+  auto surfaceBack = Surface::makeShared<PlaneSurface>(bounds, elementBack);
+
+  // Creates a strip cluster centered on the strip that contains the position
+  auto makeCluster = [&](const std::shared_ptr<const Surface>& surface,
+                         double x) {
+    size_t strip = std::min<size_t>((x + halfX) / pitch, nStrips - 1);
+    ActsSymMatrixD<3> cov = ActsSymMatrixD<3>::Zero();
+    return PlanarModuleCluster(
+        surface, {}, cov, -halfX + (strip + 0.5) * pitch, 0., 0.,
+        {DigitizationCell(strip, 0, 1.)}, &digMod);
+  };
+
+  // Straight tracks from the origin through both modules, together with
+  // unrelated clusters on both modules
+  std::uniform_real_distribution<double> xDist(-0.95 * halfX, 0.95 * halfX);
+  std::uniform_real_distribution<double> yDist(-0.95 * halfY, 0.95 * halfY);
+  std::vector<PlanarModuleCluster> front, back;
+  front.reserve(2 * nTracks);
+  back.reserve(2 * nTracks);
+  while (front.size() < nTracks) {
+    Vector3D globalFront = surfaceFront->localToGlobal(
+        tgContext, Vector2D(xDist(rng), yDist(rng)), Vector3D(1., 0., 0.));
+    Vector3D globalBack = globalFront * radiusBack / globalFront.x();
+    auto localBack =
+        surfaceBack->globalToLocal(tgContext, globalBack, Vector3D(1., 0., 0.));
+    auto localFront = surfaceFront->globalToLocal(tgContext, globalFront,
+                                                  Vector3D(1., 0., 0.));
+    if (not localBack.ok() or not localFront.ok() or
+        std::abs(localBack.value().x()) > halfX or
+        std::abs(localBack.value().y()) > halfY) {
+      continue;
+    }
+    front.push_back(makeCluster(surfaceFront, localFront.value().x()));
+    back.push_back(makeCluster(surfaceBack, localBack.value().x()));
+  }
+  for (size_t i = 0; i < nTracks; ++i) {
+    front.push_back(makeCluster(surfaceFront, xDist(rng)));
+    back.push_back(makeCluster(surfaceBack, xDist(rng)));
+  }
+  std::vector<const PlanarModuleCluster*> clustersFront, clustersBack;
+  for (size_t i = 0; i < front.size(); ++i) {
+    clustersFront.push_back(&front[i]);
+    clustersBack.push_back(&back[i]);
+  }
+  std::shuffle(clustersBack.begin(), clustersBack.end(), rng);
+
+  DoubleHitSpacePointConfig dhsp_cfg;
+  dhsp_cfg.diffTheta2 = 1e-4;
+  dhsp_cfg.diffPhi2 = 1e-4;
+  SpacePointBuilder<SpacePoint<PlanarModuleCluster>> dhsp(dhsp_cfg);
+
+  ClusterPairs clusterPairs;
+  dhsp.makeClusterPairs(tgContext, clustersFront, clustersBack, clusterPairs);
+  ClusterPairs reference =
+      makeClusterPairsReference(dhsp_cfg, clustersFront, clustersBack);
+
+  BOOST_CHECK_GE(clusterPairs.size(), nTracks);
+  BOOST_CHECK(clusterPairs == reference);
+
+  // The same pairs have to result in the same space points
+  std::vector<SpacePoint<PlanarModuleCluster>> resultSP, referenceSP;
+  dhsp.calculateSpacePoints(tgContext, clusterPairs, resultSP);
+  dhsp.calculateSpacePoints(tgContext, reference, referenceSP);
+  BOOST_REQUIRE_EQUAL(resultSP.size(), referenceSP.size());
+  for (size_t i = 0; i < resultSP.size(); ++i) {
+    BOOST_CHECK_EQUAL(resultSP[i].vector, referenceSP[i].vector);
+  }
+}
+
 }  // end of namespace Test
 }  // end of namespace Acts
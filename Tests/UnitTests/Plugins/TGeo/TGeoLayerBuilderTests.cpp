@@ -13,12 +13,22 @@
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Plugins/TGeo/ITGeoIdentifierProvider.hpp"
+#include "Acts/Plugins/TGeo/TGeoDetectorElement.hpp"
 #include "Acts/Plugins/TGeo/TGeoLayerBuilder.hpp"
 #include "Acts/Tests/CommonHelpers/DataDirectory.hpp"
 #include "Acts/Visualization/GeometryView3D.hpp"
 #include "Acts/Visualization/ObjVisualization3D.hpp"
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "TGeoManager.h"
+#include "TGeoNode.h"
+#include "TROOT.h"
 
 namespace Acts {
 
@@ -105,6 +115,83 @@ BOOST_AUTO_TEST_CASE(TGeoLayerBuilderTests) {
   }
 }
 
+/// @brief Identifier provider that is safe for concurrent calls
+struct CountingIdentifierProvider : public ITGeoIdentifierProvider {
+  mutable std::atomic<size_t> nCalls{0};
+
+  Identifier identify(const GeometryContext& /*gctx*/,
+                      const TGeoNode& tgnode) const final {
+    ++nCalls;
+    return Identifier(tgnode.GetNumber());
+  }
+};
+
+/// @brief Unit test comparing the sequential and the threaded layer building
+BOOST_AUTO_TEST_CASE(TGeoLayerBuilderConcurrentTests) {
+  // The threaded executor creates ROOT objects from several threads
+  ROOT::EnableThreadSafety();
+
+  TGeoLayerBuilder::LayerConfig b0Config;
+  b0Config.volumeName = "*";
+  b0Config.sensorNames = {"PixelActiveo2", "PixelActiveo4", "PixelActiveo5",
+                          "PixelActiveo6"};
+  b0Config.localAxes = "XYZ";
+  b0Config.parseRanges = {{binR, {0., 40_mm}}, {binZ, {-60_mm, 15_mm}}};
+  b0Config.envelope = {0_mm, 0_mm};
+
+  LayerCreator::Config lcConfig;
+  lcConfig.surfaceArrayCreator = std::make_shared<const SurfaceArrayCreator>();
+  ProtoLayerHelper::Config plhConfig;
+
+  auto build = [&](bool threaded,
+                   std::shared_ptr<const CountingIdentifierProvider> provider) {
+    TGeoLayerBuilder::Config tglbConfig;
+    tglbConfig.configurationName = "Pixels";
+    tglbConfig.layerConfigurations[1] = {b0Config};
+    tglbConfig.layerCreator = std::make_shared<const LayerCreator>(lcConfig);
+    tglbConfig.protoLayerHelper =
+        std::make_shared<const ProtoLayerHelper>(plhConfig);
+    tglbConfig.identifierProvider = std::move(provider);
+    if (threaded) {
+      tglbConfig.executor = [](size_t nTasks,
+                               const std::function<void(size_t)>& func) {
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> threads;
+        for (size_t it = 0; it < 4; ++it) {
+          threads.emplace_back([&]() {
+            for (size_t i = next++; i < nTasks; i = next++) {
+              func(i);
+            }
+          });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      };
+    }
+    TGeoLayerBuilder tglb(tglbConfig);
+    auto layers = tglb.centralLayers(tgContext);
+    BOOST_CHECK_EQUAL(layers.size(), 1u);
+    return tglb.detectorElements();
+  };
+
+  auto sequentialProvider = std::make_shared<CountingIdentifierProvider>();
+  auto threadedProvider = std::make_shared<CountingIdentifierProvider>();
+  auto sequential = build(false, sequentialProvider);
+  auto threaded = build(true, threadedProvider);
+
+  // Every element is identified once, in the same order and placement
+  BOOST_CHECK_EQUAL(sequential.size(), 14u);
+  BOOST_CHECK_EQUAL(sequentialProvider->nCalls.load(), sequential.size());
+  BOOST_CHECK_EQUAL(threadedProvider->nCalls.load(), threaded.size());
+  BOOST_REQUIRE_EQUAL(threaded.size(), sequential.size());
+  for (size_t i = 0; i < sequential.size(); ++i) {
+    BOOST_CHECK_EQUAL(threaded[i]->identifier(), sequential[i]->identifier());
+    BOOST_CHECK(threaded[i]->transform(tgContext).isApprox(
+        sequential[i]->transform(tgContext)));
+  }
+}
+
 }  // namespace Test
 
 }  // namespace Acts
\ No newline at end of file
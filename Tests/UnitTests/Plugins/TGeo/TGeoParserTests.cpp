@@ -16,7 +16,16 @@
 #include "Acts/Visualization/GeometryView3D.hpp"
 #include "Acts/Visualization/ObjVisualization3D.hpp"
 
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "TGeoManager.h"
+#include "TGeoMaterial.h"
+#include "TGeoMatrix.h"
+#include "TGeoMedium.h"
+#include "TGeoVolume.h"
 
 namespace Acts {
 
@@ -103,5 +112,124 @@ BOOST_AUTO_TEST_CASE(TGeoParser_Pixel_SelectInnermost) {
   }
 }
 
+/// @brief Unit test parsing the daughter branches independently
+BOOST_AUTO_TEST_CASE(TGeoParser_Pixel_SelectConcurrently) {
+  if (gGeoManager != nullptr) {
+    TGeoParser::Options tgpOptions;
+    tgpOptions.volumeNames = {"*"};
+    tgpOptions.targetNames = {"PixelActiveo2", "PixelActiveo4", "PixelActiveo5",
+                              "PixelActiveo6"};
+    tgpOptions.parseRanges.push_back({binZ, {-60., 15.}});
+    tgpOptions.unit = 10.;
+
+    TGeoParser::State tgpState;
+    tgpState.volume = gGeoManager->GetTopVolume();
+    TGeoParser::select(tgpState, tgpOptions);
+
+    // Run the branches in reverse order to check the merging order
+    size_t nBranches = 0;
+    tgpOptions.executor = [&](size_t n,
+                              const std::function<void(size_t)>& func) {
+      nBranches = n;
+      for (size_t i = n; i > 0; --i) {
+        func(i - 1);
+      }
+    };
+    TGeoParser::State tgpConcurrentState;
+    tgpConcurrentState.volume = gGeoManager->GetTopVolume();
+    TGeoParser::selectConcurrently(tgpConcurrentState, tgpOptions);
+
+    BOOST_CHECK_GT(nBranches, 0u);
+    BOOST_CHECK_GT(tgpState.selectedNodes.size(), 0u);
+    BOOST_REQUIRE_EQUAL(tgpConcurrentState.selectedNodes.size(),
+                        tgpState.selectedNodes.size());
+    for (size_t i = 0; i < tgpState.selectedNodes.size(); ++i) {
+      const auto& expected = tgpState.selectedNodes[i];
+      const auto& actual = tgpConcurrentState.selectedNodes[i];
+      BOOST_CHECK_EQUAL(actual.node, expected.node);
+      for (size_t j = 0; j < 3; ++j) {
+        BOOST_CHECK_EQUAL(actual.transform->GetTranslation()[j],
+                          expected.transform->GetTranslation()[j]);
+      }
+      for (size_t j = 0; j < 9; ++j) {
+        BOOST_CHECK_EQUAL(actual.transform->GetRotationMatrix()[j],
+                          expected.transform->GetRotationMatrix()[j]);
+      }
+    }
+  }
+}
+
+/// @brief Unit test comparing the sequential and the concurrent parsing
+/// for selected and not selected top volumes
+BOOST_AUTO_TEST_CASE(TGeoParser_SelectConcurrently_Branches) {
+  // A world with a service, a barrel and a support volume, all with sensors
+  TGeoManager* previousManager = gGeoManager;
+  auto manager = new TGeoManager("ParserBranches", "Parser branch test");
+  auto vacuum = new TGeoMedium("Vacuum", 1, new TGeoMaterial("Vacuum"));
+  TGeoVolume* world = manager->MakeBox("World", vacuum, 100., 100., 100.);
+  manager->SetTopVolume(world);
+  TGeoVolume* service = manager->MakeBox("Service", vacuum, 10., 10., 10.);
+  TGeoVolume* barrel = manager->MakeBox("Barrel", vacuum, 10., 10., 10.);
+  TGeoVolume* support = manager->MakeBox("Support", vacuum, 10., 10., 10.);
+  TGeoVolume* sensor = manager->MakeBox("Sensor", vacuum, 1., 1., 1.);
+  service->AddNode(sensor, 1, new TGeoTranslation(0., 0., 0.));
+  barrel->AddNode(sensor, 1, new TGeoTranslation(0., 0., -5.));
+  barrel->AddNode(sensor, 2, new TGeoTranslation(0., 0., 5.));
+  support->AddNode(sensor, 1, new TGeoTranslation(0., 0., 0.));
+  world->AddNode(service, 1, new TGeoTranslation(0., 50., 0.));
+  world->AddNode(barrel, 1, new TGeoTranslation(-50., 0., 0.));
+  world->AddNode(support, 1, new TGeoTranslation(50., 0., 0.));
+  manager->CloseGeometry();
+
+  size_t nBranches = 0;
+  auto parse = [&](const std::string& volumeName, bool concurrently) {
+    TGeoParser::Options tgpOptions;
+    tgpOptions.volumeNames = {volumeName};
+    tgpOptions.targetNames = {"Sensor"};
+    // The last daughter is parsed first, the merged selection must not
+    // depend on which branch finishes first
+    tgpOptions.executor = [&](size_t n,
+                              const std::function<void(size_t)>& func) {
+      nBranches = n;
+      for (size_t i = n; i > 0; --i) {
+        func(i - 1);
+      }
+    };
+    TGeoParser::State tgpState;
+    tgpState.volume = world;
+    if (concurrently) {
+      TGeoParser::selectConcurrently(tgpState, tgpOptions);
+    } else {
+      TGeoParser::select(tgpState, tgpOptions);
+    }
+    std::vector<std::pair<const TGeoNode*, double>> nodes;
+    for (const auto& snode : tgpState.selectedNodes) {
+      nodes.push_back({snode.node, snode.transform->GetTranslation()[2]});
+    }
+    return nodes;
+  };
+
+  // Sequential selection size for the different volume names, the
+  // sequential parsing stays on the branch for all following daughters
+  std::vector<std::pair<std::string, size_t>> cases = {
+      {"World", 4u},   {"*", 4u},       {"Service", 4u},
+      {"Barrel", 3u},  {"Support", 1u}, {"Nothing", 0u}};
+  for (const auto& [volumeName, nSelected] : cases) {
+    BOOST_TEST_CONTEXT("Volume name " << volumeName) {
+      nBranches = 0;
+      auto sequential = parse(volumeName, false);
+      auto concurrent = parse(volumeName, true);
+      BOOST_CHECK_EQUAL(sequential.size(), nSelected);
+      BOOST_CHECK(concurrent == sequential);
+      // Only a selected top volume is split into its daughter branches
+      bool splitTop = (volumeName == "World" or volumeName == "*");
+      BOOST_CHECK_EQUAL(nBranches, splitTop ? 3u : 0u);
+    }
+  }
+
+  delete manager;
+  gGeoManager = previousManager;
+}
+
 }  // namespace Test
 }  // namespace Acts